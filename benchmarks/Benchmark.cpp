@@ -0,0 +1,214 @@
+// Benchmark.cpp
+//
+// Banc de mesure des chemins critiques de LineaCore. Les résultats sont écrits en JSON, avec des
+// noms stables pour être comparés d'une version à l'autre.
+//
+// Usage : LineaCoreBench [--filter <sous-chaîne>] [--min-time <ms>] [--samples <n>] [--out <fichier.json>] [--list]
+
+#include "Benchmark.hpp"
+#include "LineaCore/Geometry/Alignments/Horizontal/FresnelKernel.hpp"
+#include "LineaCore/Utils/JsonUtils.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace LineaCore::Benchmarks {
+
+using Utils::JsonUtils;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Options {
+    std::string Filter;
+    double MinTimeMs = 50.0;   // Durée minimale d'un échantillon
+    int Samples = 5;
+    std::string Output;
+    bool List = false;
+};
+
+struct Result {
+    std::string Name;
+    std::uint64_t Iterations;   // Itérations par échantillon
+    std::size_t ItemsPerIteration;
+    double MedianNs;            // Durée médiane d'une itération
+    double MinNs;
+    double MaxNs;
+};
+
+volatile double Sink = 0.0;
+
+double Seconds(Clock::duration duration) {
+    return std::chrono::duration<double>(duration).count();
+}
+
+double Sample(const BenchmarkBody& body, std::uint64_t iterations) {
+    double sum = 0.0;
+    const Clock::time_point start = Clock::now();
+    for (std::uint64_t i = 0; i < iterations; ++i) {
+        sum += body();
+    }
+    const double elapsed = Seconds(Clock::now() - start);
+    Sink = Sink + sum;
+    return elapsed;
+}
+
+Result Run(const Benchmark& benchmark, const Options& options) {
+    std::size_t items = benchmark.ItemsPerIteration;
+    const BenchmarkBody body = benchmark.Setup(items);
+    const double minTime = options.MinTimeMs * 1e-3;
+
+    // Calibrage : nombre d'itérations tel qu'un échantillon dure au moins minTime
+    std::uint64_t iterations = 1;
+    double elapsed = Sample(body, iterations);
+    while (elapsed < minTime && iterations < (std::uint64_t(1) << 40)) {
+        const double factor = elapsed > 0.0 ? std::clamp(1.2 * minTime / elapsed, 2.0, 100.0) : 100.0;
+        iterations = static_cast<std::uint64_t>(static_cast<double>(iterations) * factor);
+        elapsed = Sample(body, iterations);
+    }
+
+    std::vector<double> samples;
+    for (int i = 0; i < options.Samples; ++i) {
+        samples.push_back(Sample(body, iterations) * 1e9 / static_cast<double>(iterations));
+    }
+    std::sort(samples.begin(), samples.end());
+    return Result{benchmark.Name, iterations, items, samples[samples.size() / 2], samples.front(), samples.back()};
+}
+
+const char* ImplementationName(Geometry::Alignments::Horizontal::FresnelKernel::Implementation implementation) {
+    using Implementation = Geometry::Alignments::Horizontal::FresnelKernel::Implementation;
+    switch (implementation) {
+    case Implementation::AVX512:
+        return "AVX512";
+    case Implementation::AVX2:
+        return "AVX2";
+    default:
+        return "Scalar";
+    }
+}
+
+std::string Compiler() {
+#if defined(__clang__)
+    return "clang " __clang_version__;
+#elif defined(__GNUC__)
+    return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+    return "msvc " + std::to_string(_MSC_VER);
+#else
+    return "unknown";
+#endif
+}
+
+void WriteJson(std::ostream& stream, const std::vector<Result>& results) {
+    char date[32];
+    const std::time_t now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+
+    stream << "{\n  \"context\": {\n"
+           << "    \"date\": " << JsonUtils::String(date) << ",\n"
+           << "    \"compiler\": " << JsonUtils::String(Compiler()) << ",\n"
+#ifdef NDEBUG
+           << "    \"build\": \"release\",\n"
+#else
+           << "    \"build\": \"debug\",\n"
+#endif
+           << "    \"hardware_threads\": " << std::thread::hardware_concurrency() << ",\n"
+           << "    \"fresnel_kernel\": " << JsonUtils::String(ImplementationName(Geometry::Alignments::Horizontal::FresnelKernel::ActiveImplementation())) << "\n"
+           << "  },\n  \"benchmarks\": [";
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const Result& result = results[i];
+        const double items = static_cast<double>(result.ItemsPerIteration);
+        stream << (i == 0 ? "\n" : ",\n")
+               << "    {\"name\": " << JsonUtils::String(result.Name)
+               << ", \"iterations\": " << result.Iterations
+               << ", \"ns_per_iteration\": " << JsonUtils::Number(result.MedianNs, 6)
+               << ", \"min_ns_per_iteration\": " << JsonUtils::Number(result.MinNs, 6)
+               << ", \"max_ns_per_iteration\": " << JsonUtils::Number(result.MaxNs, 6)
+               << ", \"items_per_iteration\": " << result.ItemsPerIteration
+               << ", \"ns_per_item\": " << JsonUtils::Number(result.MedianNs / items, 6)
+               << ", \"items_per_second\": " << JsonUtils::Number(items * 1e9 / result.MedianNs, 6) << "}";
+    }
+    stream << "\n  ]\n}\n";
+}
+
+bool ParseOptions(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string argument = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (argument == "--filter" && hasValue) {
+            options.Filter = argv[++i];
+        } else if (argument == "--min-time" && hasValue) {
+            options.MinTimeMs = std::stod(argv[++i]);
+        } else if (argument == "--samples" && hasValue) {
+            options.Samples = std::max(1, std::stoi(argv[++i]));
+        } else if (argument == "--out" && hasValue) {
+            options.Output = argv[++i];
+        } else if (argument == "--list") {
+            options.List = true;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+} // namespace LineaCore::Benchmarks
+
+int main(int argc, char** argv) {
+    using namespace LineaCore::Benchmarks;
+
+    Options options;
+    try {
+        if (!ParseOptions(argc, argv, options)) {
+            std::cerr << "Usage: " << argv[0] << " [--filter <substring>] [--min-time <ms>] [--samples <n>] [--out <file.json>] [--list]\n";
+            return 2;
+        }
+
+        BenchmarkRegistry registry;
+        RegisterGeometryBenchmarks(registry);
+        RegisterLandXMLBenchmarks(registry);
+
+        std::vector<Result> results;
+        for (const Benchmark& benchmark : registry) {
+            if (benchmark.Name.find(options.Filter) == std::string::npos) {
+                continue;
+            }
+            if (options.List) {
+                std::cout << benchmark.Name << "\n";
+                continue;
+            }
+            std::cerr << benchmark.Name << "... " << std::flush;
+            results.push_back(Run(benchmark, options));
+            std::cerr << JsonUtils::Number(results.back().MedianNs / static_cast<double>(results.back().ItemsPerIteration), 6) << " ns/item\n";
+        }
+        if (options.List) {
+            return 0;
+        }
+
+        if (options.Output.empty()) {
+            WriteJson(std::cout, results);
+        } else {
+            std::ofstream stream(options.Output);
+            if (!stream) {
+                std::cerr << "Cannot write '" << options.Output << "'\n";
+                return 1;
+            }
+            WriteJson(stream, results);
+        }
+    } catch (const std::exception& ex) {
+        std::cerr << "Error: " << ex.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
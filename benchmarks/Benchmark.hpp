@@ -0,0 +1,37 @@
+// Benchmark.hpp
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace LineaCore::Benchmarks {
+
+/**
+ * @brief Corps d'un microbenchmark : une itération du traitement mesuré.
+ *
+ * La valeur retournée est accumulée par le banc de mesure pour que le compilateur ne puisse pas
+ * supprimer le calcul.
+ */
+using BenchmarkBody = std::function<double()>;
+
+/**
+ * @brief Microbenchmark enregistré sous un nom stable (« Famille/Classe/Opération »).
+ *
+ * La préparation (lecture de fichiers, construction des éléments) est faite par Setup, hors de
+ * la mesure, et seulement si le benchmark est sélectionné. Setup peut corriger le nombre
+ * d'opérations par itération lorsqu'il dépend des données préparées.
+ */
+struct Benchmark {
+    std::string Name;
+    std::size_t ItemsPerIteration;   ///< Nombre d'opérations élémentaires par itération (points, octets, etc.)
+    std::function<BenchmarkBody(std::size_t& itemsPerIteration)> Setup;
+};
+
+using BenchmarkRegistry = std::vector<Benchmark>;
+
+void RegisterGeometryBenchmarks(BenchmarkRegistry& registry);
+void RegisterLandXMLBenchmarks(BenchmarkRegistry& registry);
+
+} // namespace LineaCore::Benchmarks
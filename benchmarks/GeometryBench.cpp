@@ -0,0 +1,471 @@
+// GeometryBench.cpp
+
+#include "Benchmark.hpp"
+#include "LineaCore/Geometry/GeometryUtils.hpp"
+#include "LineaCore/Geometry/Alignments/AlignmentClearance.hpp"
+#include "LineaCore/Geometry/Alignments/AlignmentCursor.hpp"
+#include "LineaCore/Geometry/Alignments/AlignmentProjector.hpp"
+#include "LineaCore/Geometry/Alignments/AlignmentSampler.hpp"
+#include "LineaCore/Geometry/Alignments/BoundsTree.hpp"
+#include "LineaCore/Geometry/Alignments/CantTable.hpp"
+#include "LineaCore/Geometry/Alignments/Horizontal/ClotoideApproximant.hpp"
+#include "LineaCore/Geometry/Alignments/OffsetCurves.hpp"
+#include "LineaCore/Geometry/Alignments/SegmentIntersector.hpp"
+#include "LineaCore/Geometry/Alignments/StationEquationTable.hpp"
+#include "LineaCore/Geometry/Alignments/ViewportTessellator.hpp"
+#include "LineaCore/Geometry/Alignments/Horizontal/ClotoideTransition.hpp"
+#include "LineaCore/Geometry/Alignments/Horizontal/CurvedAlignment.hpp"
+#include "LineaCore/Geometry/Alignments/Horizontal/StraightAlignment.hpp"
+#include "LineaCore/LandXML/LandXMLAlignmentLoader.hpp"
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace LineaCore::Benchmarks {
+
+using namespace Geometry;
+using namespace Geometry::Alignments;
+using namespace Geometry::Alignments::Horizontal;
+
+namespace {
+
+constexpr std::size_t StationCount = 1024;
+constexpr double MaxThrow = 1e-3;
+constexpr std::size_t CantSampleCount = 262144;   // Dévers : 65 km tous les 0,25 m
+constexpr std::size_t ProjectionCount = 1 << 20;
+
+// Éléments de référence, proches de ceux des fichiers d'exemple
+std::shared_ptr<HorizontalAlignment> MakeElement(int type) {
+    switch (type) {
+    case 0:
+        return std::make_shared<StraightAlignment>(Point2D(1319630.077, 6248132.875), Vector2D(-0.5654, -0.8248).Normalized(), 250.0);
+    case 1:
+        return std::make_shared<CurvedAlignment>(Point2D(1319000.0, 6248000.0), 1000.0, 1.0, 0.5, 300.0);
+    default:
+        return std::make_shared<ClotoideTransition>(373.9820021, 0.0, 111.7202365, Vector2D(-0.5654, -0.8248).Normalized(),
+                                                    Vector2D(1319630.077000, 6248132.874953));
+    }
+}
+
+const char* ElementName(int type) {
+    return type == 0 ? "StraightAlignment" : type == 1 ? "CurvedAlignment" : "ClotoideTransition";
+}
+
+std::vector<double> Stations(double length) {
+    std::vector<double> stations(StationCount);
+    for (std::size_t i = 0; i < StationCount; ++i) {
+        stations[i] = length * (static_cast<double>(i) + 0.5) / StationCount;
+    }
+    return stations;
+}
+
+void RegisterElementBenchmarks(BenchmarkRegistry& registry, int type) {
+    const std::string prefix = std::string("Horizontal/") + ElementName(type) + "/";
+
+    registry.push_back({prefix + "Point", StationCount, [type](std::size_t&) {
+        auto element = MakeElement(type);
+        auto stations = Stations(element->Length());
+        return BenchmarkBody([element, stations] {
+            double sum = 0.0;
+            for (const double s : stations) {
+                sum += element->Point(s).X;
+            }
+            return sum;
+        });
+    }});
+    registry.push_back({prefix + "Normal", StationCount, [type](std::size_t&) {
+        auto element = MakeElement(type);
+        auto stations = Stations(element->Length());
+        return BenchmarkBody([element, stations] {
+            double sum = 0.0;
+            for (const double s : stations) {
+                sum += element->Normal(s).X;
+            }
+            return sum;
+        });
+    }});
+    registry.push_back({prefix + "Curvature", StationCount, [type](std::size_t&) {
+        auto element = MakeElement(type);
+        auto stations = Stations(element->Length());
+        return BenchmarkBody([element, stations] {
+            double sum = 0.0;
+            for (const double s : stations) {
+                sum += element->Curvature(s);
+            }
+            return sum;
+        });
+    }});
+    registry.push_back({prefix + "PointBatch", StationCount, [type](std::size_t&) {
+        auto element = MakeElement(type);
+        auto stations = Stations(element->Length());
+        auto points = std::make_shared<std::vector<Point2D>>(StationCount);
+        return BenchmarkBody([element, stations, points] {
+            element->Point(stations, *points);
+            return points->back().X;
+        });
+    }});
+
+    registry.push_back({prefix + "Points", 1, [type](std::size_t& itemsPerIteration) {
+        auto element = MakeElement(type);
+        itemsPerIteration = element->PointCount(MaxThrow);
+        auto points = std::make_shared<std::vector<Point2D>>(element->PointCount(MaxThrow));
+        return BenchmarkBody([element, points] {
+            element->Points(MaxThrow, *points);
+            return points->back().X;
+        });
+    }});
+}
+
+} // namespace
+
+void RegisterGeometryBenchmarks(BenchmarkRegistry& registry) {
+    registry.push_back({"Horizontal/ClotoideTransition/PtLoc", StationCount, [](std::size_t&) {
+        const double A = 373.9820021;
+        std::vector<double> abscissas(StationCount);
+        for (std::size_t i = 0; i < StationCount; ++i) {
+            abscissas[i] = -2.0 * A + 4.0 * A * static_cast<double>(i) / StationCount;
+        }
+        return BenchmarkBody([abscissas, A] {
+            double sum = 0.0;
+            for (const double s : abscissas) {
+                sum += ClotoideTransition::PtLoc(s, A).Y;
+            }
+            return sum;
+        });
+    }});
+
+    for (int type = 0; type < 3; ++type) {
+        RegisterElementBenchmarks(registry, type);
+    }
+
+    for (const char* operation : {"Point", "Normal"}) {
+        registry.push_back({std::string("Horizontal/ClotoideApproximant/") + operation, StationCount, [operation](std::size_t&) {
+            auto approximant = std::make_shared<ClotoideApproximant>();
+            ClotoideApproximant::TryBuild(static_cast<const ClotoideTransition&>(*MakeElement(2)), 1e-6, *approximant);
+            auto stations = Stations(approximant->Length());
+            if (std::string(operation) == "Point") {
+                return BenchmarkBody([approximant, stations] {
+                    double sum = 0.0;
+                    for (const double s : stations) {
+                        sum += approximant->Point(s).X;
+                    }
+                    return sum;
+                });
+            }
+            return BenchmarkBody([approximant, stations] {
+                double sum = 0.0;
+                for (const double s : stations) {
+                    sum += approximant->Normal(s).X;
+                }
+                return sum;
+            });
+        }});
+    }
+
+    registry.push_back({"Horizontal/ClotoideTransition/TryFromVectorAndCurvatures", 1, [](std::size_t&) {
+        auto reference = std::static_pointer_cast<ClotoideTransition>(MakeElement(2));
+        const Point2D start = reference->getStartingPoint();
+        const Vector2D chord = reference->getEndingPoint() - start;
+        const double endingCurvature = reference->Curvature(reference->Length());
+        return BenchmarkBody([start, chord, endingCurvature] {
+            ClotoideTransition clotoide;
+            ClotoideTransition::TryFromVectorAndCurvatures(start, chord, 0.0, endingCurvature, clotoide);
+            return clotoide.Length();
+        });
+    }});
+
+    registry.push_back({"Geometry/GeometryUtils/BrentFunctionValue", 1, [](std::size_t&) {
+        return BenchmarkBody([] {
+            return GeometryUtils::BrentFunctionValue(0.0, 5.0, 0.0, 1.0, [](double x) { return x * x - 4.0; }, nullptr).X;
+        });
+    }});
+
+    // Profil en long du fichier d'exemple principal, stations croissantes
+    for (const bool batch : {false, true}) {
+        registry.push_back({batch ? "Vertical/VerticalAlignment/ElevationBatch/TAE_Centre_01_01" : "Vertical/VerticalAlignment/Elevation/TAE_Centre_01_01",
+                            StationCount, [batch](std::size_t&) {
+            auto alignments = std::make_shared<std::vector<Alignment>>(
+                LandXML::LandXMLAlignmentLoader::ReadFile(std::string(LINEACORE_EXAMPLES_DIR) + "/TAE_Centre_01_01.xml", 1));
+            const Vertical::VerticalAlignment& profile = alignments->front().Profile(0);
+            auto stations = std::make_shared<std::vector<double>>(StationCount);
+            for (std::size_t i = 0; i < StationCount; ++i) {
+                (*stations)[i] = profile.StaStart() + (profile.StaEnd() - profile.StaStart()) * static_cast<double>(i) / StationCount;
+            }
+            auto elevations = std::make_shared<std::vector<double>>(StationCount);
+            return BenchmarkBody([alignments, &profile, stations, elevations, batch] {
+                if (batch) {
+                    profile.Elevation(*stations, *elevations);
+                    return elevations->back();
+                }
+                double sum = 0.0;
+                for (const double s : *stations) {
+                    sum += profile.Elevation(s);
+                }
+                return sum;
+            });
+        }});
+    }
+
+    // Dévers : rampes et paliers alternés tous les 100 m
+    for (const bool batch : {false, true}) {
+        registry.push_back({batch ? "Alignments/CantTable/AppliedCantBatch" : "Alignments/CantTable/AppliedCant", CantSampleCount, [batch](std::size_t&) {
+            std::vector<CantStation> cantStations;
+            for (std::size_t i = 0; i <= 650; ++i) {
+                cantStations.push_back({100.0 * static_cast<double>(i), (i / 2) % 2 == 0 ? 0.0 : 150.0});
+            }
+            auto cant = std::make_shared<CantTable>("Bench", 1.435, "insideRail", cantStations);
+            auto stations = std::make_shared<std::vector<double>>(CantSampleCount);
+            for (std::size_t i = 0; i < CantSampleCount; ++i) {
+                (*stations)[i] = 0.25 * static_cast<double>(i);
+            }
+            auto cants = std::make_shared<std::vector<double>>(CantSampleCount);
+            return BenchmarkBody([cant, stations, cants, batch] {
+                if (batch) {
+                    cant->AppliedCant(*stations, *cants);
+                    return cants->back();
+                }
+                double sum = 0.0;
+                for (const double s : *stations) {
+                    sum += cant->AppliedCant(s);
+                }
+                return sum;
+            });
+        }});
+    }
+
+    // Conversion de stations internes en chaînage externe, 8 équations sur 65 km
+    for (const bool batch : {false, true}) {
+        registry.push_back({batch ? "Alignments/StationEquationTable/ExternalStations" : "Alignments/StationEquationTable/ExternalStation",
+                            CantSampleCount, [batch](std::size_t&) {
+            std::vector<StationEquation> equations;
+            for (int k = 1; k <= 8; ++k) {
+                equations.push_back({7000.0 * k, 7000.0 * k + 5.0 * (k - 1), 7000.0 * k + 5.0 * k});
+            }
+            auto table = std::make_shared<StationEquationTable>(std::move(equations));
+            auto stations = std::make_shared<std::vector<double>>(CantSampleCount);
+            for (std::size_t i = 0; i < CantSampleCount; ++i) {
+                (*stations)[i] = 0.25 * static_cast<double>(i);
+            }
+            auto external = std::make_shared<std::vector<double>>(CantSampleCount);
+            return BenchmarkBody([table, stations, external, batch] {
+                if (batch) {
+                    table->ExternalStations(*stations, *external);
+                    return external->back();
+                }
+                double sum = 0.0;
+                for (const double s : *stations) {
+                    sum += table->ExternalStation(s);
+                }
+                return sum;
+            });
+        }});
+    }
+
+    // Échantillonnage 3D de l'axe de v1.xml tous les 0,25 m : passe fusionnée, puis évaluations séparées
+    for (const bool fused : {true, false}) {
+        registry.push_back({fused ? "Alignments/AlignmentSampler/Sample/v1" : "Alignments/AlignmentSampler/Separate/v1", 1,
+                            [fused](std::size_t& itemsPerIteration) {
+            auto alignments = std::make_shared<std::vector<Alignment>>(
+                LandXML::LandXMLAlignmentLoader::ReadFile(std::string(LINEACORE_EXAMPLES_DIR) + "/v1.xml", 1));
+            const Alignment& alignment = alignments->front();
+            auto stations = std::make_shared<std::vector<double>>();
+            for (double s = alignment.StaStart(); s < alignment.StaEnd(); s += 0.25) {
+                stations->push_back(s);
+            }
+            itemsPerIteration = stations->size();
+            auto samples = std::make_shared<AlignmentSamples>();
+            return BenchmarkBody([alignments, stations, samples, fused] {
+                const Alignment& alignment = alignments->front();
+                if (fused) {
+                    AlignmentSampler(alignment).Sample(*stations, *samples, 1);
+                    return samples->X.back();
+                }
+                double sum = 0.0;
+                for (const double s : *stations) {
+                    const Vector2D normal = alignment.Normal(s);
+                    sum += alignment.Point(s).X + std::atan2(normal.X, -normal.Y) + alignment.Curvature(s) +
+                           alignment.Profile(0).Elevation(s) + alignment.Profile(0).Grade(s) + alignment.Cant(0).AppliedCant(s);
+                }
+                return sum;
+            });
+        }});
+    }
+
+    // Parcours à pas constant (0,25 m) : curseur par récurrences, puis évaluations exactes station par station
+    for (const bool cursor : {true, false}) {
+        registry.push_back({cursor ? "Alignments/AlignmentCursor/Next/TAE_Centre_01_01" : "Alignments/Alignment/PointNormal/TAE_Centre_01_01", 1,
+                            [cursor](std::size_t& itemsPerIteration) {
+            auto alignments = std::make_shared<std::vector<Alignment>>(
+                LandXML::LandXMLAlignmentLoader::ReadFile(std::string(LINEACORE_EXAMPLES_DIR) + "/TAE_Centre_01_01.xml", 1));
+            const Alignment& alignment = alignments->front();
+            const std::size_t count = static_cast<std::size_t>((alignment.StaEnd() - alignment.StaStart()) / 0.25);
+            itemsPerIteration = count;
+            return BenchmarkBody([alignments, count, cursor] {
+                const Alignment& alignment = alignments->front();
+                double sum = 0.0;
+                if (cursor) {
+                    AlignmentCursor position(alignment, alignment.StaStart(), 0.25);
+                    for (std::size_t i = 0; i < count; ++i) {
+                        sum += position.Point().X + position.Normal().Y;
+                        position.Next();
+                    }
+                    return sum;
+                }
+                for (std::size_t i = 0; i < count; ++i) {
+                    const double s = alignment.StaStart() + 0.25 * static_cast<double>(i);
+                    sum += alignment.Point(s).X + alignment.Normal(s).Y;
+                }
+                return sum;
+            });
+        }});
+    }
+
+    // Huit courbes décalées tous les 0,25 m : une évaluation de l'axe par station, puis une par décalage et par station
+    for (const bool fused : {true, false}) {
+        registry.push_back({fused ? "Alignments/OffsetCurves/Points/TAE_Centre_01_01" : "Alignments/Alignment/OffsetPoints/TAE_Centre_01_01", 1,
+                            [fused](std::size_t& itemsPerIteration) {
+            auto alignments = std::make_shared<std::vector<Alignment>>(
+                LandXML::LandXMLAlignmentLoader::ReadFile(std::string(LINEACORE_EXAMPLES_DIR) + "/TAE_Centre_01_01.xml", 1));
+            const Alignment& alignment = alignments->front();
+            auto stations = std::make_shared<std::vector<double>>();
+            for (double s = alignment.StaStart(); s < alignment.StaEnd(); s += 0.25) {
+                stations->push_back(s);
+            }
+            auto offsets = std::make_shared<std::vector<double>>(std::vector<double>{-4.5, -3.0, -1.5, -0.7175, 0.7175, 1.5, 3.0, 4.5});
+            itemsPerIteration = stations->size() * offsets->size();
+            auto curves = std::make_shared<std::vector<std::vector<Point2D>>>(offsets->size(), std::vector<Point2D>(stations->size()));
+            return BenchmarkBody([alignments, stations, offsets, curves, fused] {
+                const Alignment& alignment = alignments->front();
+                if (fused) {
+                    const std::vector<std::span<Point2D>> outputs(curves->begin(), curves->end());
+                    OffsetCurves(alignment, *offsets).Points(*stations, outputs);
+                    return curves->back().back().X;
+                }
+                for (std::size_t k = 0; k < offsets->size(); ++k) {
+                    for (std::size_t j = 0; j < stations->size(); ++j) {
+                        const double s = (*stations)[j];
+                        const double side = alignment.Element(alignment.ElementIndex(s)).NormalSide();
+                        (*curves)[k][j] = alignment.Point(s) + alignment.Normal(s) * (side * (*offsets)[k]);
+                    }
+                }
+                return curves->back().back().X;
+            });
+        }});
+    }
+
+    // Entraxe centre / rail tous les mètres : minimum exact par hiérarchie de boîtes et profil échantillonné
+    registry.push_back({"Alignments/AlignmentClearance/Profile/TAE_Centre_01_01_Rail", 1, [](std::size_t& itemsPerIteration) {
+        auto centre = std::make_shared<std::vector<Alignment>>(
+            LandXML::LandXMLAlignmentLoader::ReadFile(std::string(LINEACORE_EXAMPLES_DIR) + "/TAE_Centre_01_01.xml", 1));
+        auto rail = std::make_shared<std::vector<Alignment>>(
+            LandXML::LandXMLAlignmentLoader::ReadFile(std::string(LINEACORE_EXAMPLES_DIR) + "/TAE_Centre_01_01_Rail.xml", 1));
+        auto centreClearance = std::make_shared<AlignmentClearance>(centre->front());
+        auto railClearance = std::make_shared<AlignmentClearance>(rail->front());
+        itemsPerIteration = centreClearance->Profile(*railClearance, 1.0).Stations.size();
+        return BenchmarkBody([centre, rail, centreClearance, railClearance] {
+            return centreClearance->Profile(*railClearance, 1.0).Minimum.Distance;
+        });
+    }});
+
+    // Projection de points tirés le long de l'axe à ±50 m, sur un thread (index construit hors mesure)
+    registry.push_back({"Alignments/AlignmentProjector/Project/TAE_Centre_01_01", ProjectionCount, [](std::size_t&) {
+        auto alignments = std::make_shared<std::vector<Alignment>>(
+            LandXML::LandXMLAlignmentLoader::ReadFile(std::string(LINEACORE_EXAMPLES_DIR) + "/TAE_Centre_01_01.xml", 1));
+        const Alignment& alignment = alignments->front();
+        auto projector = std::make_shared<AlignmentProjector>(alignment);
+        std::mt19937 generator(4);
+        std::uniform_real_distribution<double> station(alignment.StaStart(), alignment.StaEnd());
+        std::uniform_real_distribution<double> offset(-50.0, 50.0);
+        auto points = std::make_shared<std::vector<Point2D>>(ProjectionCount);
+        for (Point2D& point : *points) {
+            const double s = station(generator);
+            point = alignment.Point(s) + alignment.Normal(s) * offset(generator);
+        }
+        auto results = std::make_shared<std::vector<StationOffset>>(ProjectionCount);
+        return BenchmarkBody([alignments, projector, points, results] {
+            projector->Project(*points, *results, 1);
+            return results->back().Station;
+        });
+    }});
+
+    // Croisements de l'axe avec 200 000 segments aléatoires autour de lui (index compris)
+    registry.push_back({"Alignments/SegmentIntersector/Intersect/TAE_Centre_01_01", 1, [](std::size_t& itemsPerIteration) {
+        auto alignments = std::make_shared<std::vector<Alignment>>(
+            LandXML::LandXMLAlignmentLoader::ReadFile(std::string(LINEACORE_EXAMPLES_DIR) + "/TAE_Centre_01_01.xml", 1));
+        const Alignment& alignment = alignments->front();
+        std::mt19937 generator(3);
+        std::uniform_real_distribution<double> station(alignment.StaStart(), alignment.StaEnd());
+        std::uniform_real_distribution<double> offset(-200.0, 200.0);
+        auto starts = std::make_shared<std::vector<Point2D>>(200000);
+        auto ends = std::make_shared<std::vector<Point2D>>(starts->size());
+        for (std::size_t k = 0; k < starts->size(); ++k) {
+            const Point2D centre = alignment.Point(station(generator));
+            (*starts)[k] = centre + Vector2D(offset(generator), offset(generator));
+            (*ends)[k] = (*starts)[k] + Vector2D(offset(generator), offset(generator)) * 0.1;
+        }
+        itemsPerIteration = starts->size();
+        return BenchmarkBody([alignments, starts, ends] {
+            const SegmentIntersector intersector(*starts, *ends);
+            return static_cast<double>(intersector.Intersect(alignments->front(), 0.01, 1).size());
+        });
+    }});
+
+    // Boîtes des éléments : arbre des boîtes exactes, comparé aux étendues tirées de la discrétisation
+    registry.push_back({"Alignments/BoundsTree/Build/TAE_Centre_01_01", 1, [](std::size_t& itemsPerIteration) {
+        auto alignments = std::make_shared<std::vector<Alignment>>(
+            LandXML::LandXMLAlignmentLoader::ReadFile(std::string(LINEACORE_EXAMPLES_DIR) + "/TAE_Centre_01_01.xml", 1));
+        itemsPerIteration = alignments->front().ElementCount();
+        return BenchmarkBody([alignments] {
+            const BoundsTree tree(alignments->front());
+            return tree.Bounds().MaxX;
+        });
+    }});
+
+    registry.push_back({"Alignments/Alignment/PointsExtent/TAE_Centre_01_01", 1, [](std::size_t& itemsPerIteration) {
+        auto alignments = std::make_shared<std::vector<Alignment>>(
+            LandXML::LandXMLAlignmentLoader::ReadFile(std::string(LINEACORE_EXAMPLES_DIR) + "/TAE_Centre_01_01.xml", 1));
+        itemsPerIteration = alignments->front().ElementCount();
+        return BenchmarkBody([alignments] {
+            const Alignment& alignment = alignments->front();
+            BoundingBox bounds;
+            for (std::size_t i = 0; i < alignment.ElementCount(); ++i) {
+                for (const Point2D& p : alignment.Element(i).Points(0.01)) {
+                    bounds.Extend(p);
+                }
+            }
+            return bounds.MaxX;
+        });
+    }});
+
+    // Fenêtre d'affichage de 500 m à 0,5 m par pixel, comparée à Alignments/Alignment/Points (axe complet)
+    registry.push_back({"Alignments/ViewportTessellator/Tessellate/TAE_Centre_01_01", 1, [](std::size_t& itemsPerIteration) {
+        auto alignments = std::make_shared<std::vector<Alignment>>(
+            LandXML::LandXMLAlignmentLoader::ReadFile(std::string(LINEACORE_EXAMPLES_DIR) + "/TAE_Centre_01_01.xml", 1));
+        const Alignment& alignment = alignments->front();
+        auto tessellator = std::make_shared<ViewportTessellator>(alignment);
+        const Point2D centre = alignment.Point(alignment.StaStart() + 0.4 * alignment.Length());
+        const BoundingBox window(centre.X - 250.0, centre.Y - 250.0, centre.X + 250.0, centre.Y + 250.0);
+        itemsPerIteration = 0;
+        for (const std::vector<Point2D>& polyline : tessellator->Tessellate(window, 0.5)) {
+            itemsPerIteration += polyline.size();
+        }
+        return BenchmarkBody([alignments, tessellator, window] {
+            return static_cast<double>(tessellator->Tessellate(window, 0.5).size());
+        });
+    }});
+
+    // Axe complet du fichier d'exemple principal
+    registry.push_back({"Alignments/Alignment/Points/TAE_Centre_01_01", 1, [](std::size_t& itemsPerIteration) {
+        auto alignments = std::make_shared<std::vector<Alignment>>(
+            LandXML::LandXMLAlignmentLoader::ReadFile(std::string(LINEACORE_EXAMPLES_DIR) + "/TAE_Centre_01_01.xml", 1));
+        itemsPerIteration = alignments->front().PointCount(MaxThrow);
+        auto points = std::make_shared<std::vector<Point2D>>(itemsPerIteration);
+        return BenchmarkBody([alignments, points] {
+            alignments->front().Points(MaxThrow, *points, 1);
+            return points->back().X;
+        });
+    }});
+}
+
+} // namespace LineaCore::Benchmarks
@@ -0,0 +1,56 @@
+// LandXMLBench.cpp
+
+#include "Benchmark.hpp"
+#include "LineaCore/LandXML/LandXMLAlignmentLoader.hpp"
+#include "LineaCore/LandXML/XMLUtils.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace LineaCore::Benchmarks {
+
+void RegisterLandXMLBenchmarks(BenchmarkRegistry& registry) {
+    registry.push_back({"LandXML/XMLUtils/ParseNumber", 1024, [](std::size_t&) {
+        std::vector<std::string> numbers;
+        for (int i = 0; i < 1024; ++i) {
+            char buffer[32];
+            std::snprintf(buffer, sizeof(buffer), "%.9f", 1319630.077 + i * 0.123456789);
+            numbers.push_back(buffer);
+        }
+        return BenchmarkBody([numbers] {
+            double sum = 0.0;
+            for (const std::string& number : numbers) {
+                double value;
+                LandXML::XMLUtils::ParseNumber(number.data(), number.data() + number.size(), value);
+                sum += value;
+            }
+            return sum;
+        });
+    }});
+
+    // Lecture complète de chaque fichier d'exemple ; les opérations comptées sont les octets lus
+    std::vector<std::filesystem::path> files;
+    for (const auto& entry : std::filesystem::directory_iterator(LINEACORE_EXAMPLES_DIR)) {
+        if (entry.is_regular_file() && entry.path().extension() == ".xml") {
+            files.push_back(entry.path());
+        }
+    }
+    std::sort(files.begin(), files.end());
+
+    for (const std::filesystem::path& file : files) {
+        const std::string stem = file.stem().string();
+        const std::size_t size = static_cast<std::size_t>(std::filesystem::file_size(file));
+        for (const unsigned threadCount : {1u, 0u}) {
+            const std::string name = threadCount == 1 ? "LandXML/ReadFile/" : "LandXML/ReadFileParallel/";
+            registry.push_back({name + stem, size, [file, threadCount](std::size_t&) {
+                return BenchmarkBody([fileName = file.string(), threadCount] {
+                    return static_cast<double>(LandXML::LandXMLAlignmentLoader::ReadFile(fileName, threadCount).size());
+                });
+            }});
+        }
+    }
+}
+
+} // namespace LineaCore::Benchmarks
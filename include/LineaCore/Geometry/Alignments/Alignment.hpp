@@ -0,0 +1,227 @@
+// Alignment.hpp
+#pragma once
+
+#include "Horizontal/HorizontalAlignment.hpp"
+#include "Horizontal/ClotoideApproximant.hpp"
+#include "Vertical/VerticalAlignment.hpp"
+#include "CantTable.hpp"
+#include "StationEquationTable.hpp"
+#include "LineaCore/LandXML/LandXMLSerializable.hpp"
+#include "LineaCore/Geometry/Point2D.hpp"
+#include "LineaCore/Geometry/Vector2D.hpp"
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace LineaCore::Geometry::Alignments {
+
+/**
+ * @class Alignment
+ * @brief Axe en plan complet : suite ordonnée d'éléments (<CoordGeom>) repérée par des stations.
+ *
+ * L'axe possède ses éléments. Les stations de début des éléments sont stockées dans un tableau
+ * contigu de sommes cumulées, et la recherche station → élément passe par une table de seaux
+ * de largeur constante (O(1) en moyenne), avec une recherche dichotomique dans le seau lorsque
+ * celui-ci couvre de nombreux éléments courts.
+ *
+ * Les profils en long (<ProfAlign>) et les tables de dévers (<Cant>) de l'axe sont conservés dans
+ * l'ordre du document.
+ *
+ * Les requêtes par station prennent des stations internes. Point, Normal et Curvature, ainsi
+ * qu'AlignmentSampler et OffsetCurves (SetInputStationType), acceptent aussi un chaînage externe,
+ * converti par les équations de station ; les profils et les dévers restent en stations internes.
+ */
+class Alignment : public LandXML::LandXMLSerializable {
+private:
+    std::string _name;
+    double _staStart;
+    std::vector<std::unique_ptr<Horizontal::HorizontalAlignment>> _elements;
+
+    std::vector<double> _stations;          // Station de début de chaque élément, suivie de la station de fin (taille n + 1)
+    std::vector<std::uint32_t> _buckets;    // Index de l'élément contenant le début de chaque seau (taille nb + 1)
+    double _bucketScale;                    // Nombre de seaux par unité de station
+    std::size_t _indexedCount;              // Nombre d'éléments lors de la dernière construction complète des seaux
+
+    // Approximations des clotoïdes, indexées comme les éléments (vide si l'évaluation est exacte)
+    std::vector<std::unique_ptr<Horizontal::ClotoideApproximant>> _approximants;
+
+    // Équations de station (<StaEquation>)
+    StationEquationTable _stationEquations;
+
+    // Profils en long (<Profile>/<ProfAlign>)
+    std::vector<Vertical::VerticalAlignment> _profiles;
+
+    // Tables de dévers (<Cant>)
+    std::vector<CantTable> _cants;
+
+    // Attributs length et staStart déclarés dans le document (NaN si absents), indexés comme les éléments
+    // (vides si l'axe n'a pas été lu depuis un document)
+    double _declaredLength;
+    std::vector<double> _declaredLengths;
+    std::vector<double> _declaredStations;
+
+    void BuildStationIndex();
+    bool AppendStationBuckets();
+
+public:
+    Alignment();
+    Alignment(std::string name, double staStart);
+
+    Alignment(Alignment&&) noexcept = default;
+    Alignment& operator=(Alignment&&) noexcept = default;
+    virtual ~Alignment() = default;
+
+    // Propriétés
+    const std::string& Name() const;
+    double StaStart() const;
+    double StaEnd() const;
+    double Length() const;
+
+    // Éléments
+    std::size_t ElementCount() const;
+    const Horizontal::HorizontalAlignment& Element(std::size_t index) const;
+    double ElementStation(std::size_t index) const;
+    std::span<const double> Stations() const;
+
+    /**
+     * @brief Ajoute un élément en fin d'axe ; sa station de début est la station de fin courante.
+     *
+     * Les seaux sont prolongés pour couvrir le nouvel élément ; l'index n'est reconstruit que lorsque le
+     * nombre d'éléments a doublé depuis sa dernière construction : n ajouts successifs coûtent O(n).
+     * @throws std::runtime_error Si l'élément est nul.
+     */
+    void AddElement(std::unique_ptr<Horizontal::HorizontalAlignment> element);
+
+    /**
+     * @brief Retourne l'index de l'élément contenant une station.
+     *
+     * Les stations hors de l'axe sont rattachées au premier ou au dernier élément. La recherche
+     * est en temps constant (table de seaux), y compris après des appels à AddElement.
+     * @throws std::runtime_error Si l'axe ne contient aucun élément.
+     */
+    std::size_t ElementIndex(double station) const;
+
+    /**
+     * @brief Découpe des stations en plages consécutives portées par un même élément.
+     *
+     * La fonction est appelée pour chaque plage avec l'index de l'élément, l'index de la première
+     * station de la plage et le nombre de stations ; les stations triées donnent les plages les plus
+     * longues. Les stations hors de l'axe sont rattachées au premier ou au dernier élément.
+     * @throws std::runtime_error Si l'axe ne contient aucun élément.
+     */
+    void ForEachElementRun(std::span<const double> stations,
+                           const std::function<void(std::size_t element, std::size_t first, std::size_t count)>& function) const;
+
+    /**
+     * @brief Active l'évaluation approchée des clotoïdes (Point et Normal) par ClotoideApproximant.
+     *
+     * Les éléments ajoutés ensuite, les clotoïdes de longueur nulle et les autres types d'éléments restent
+     * évalués exactement.
+     * @param tolerance Écart maximal admis sur les points (m) et sur les normales (rad).
+     * @return false si une clotoïde ne peut être approchée à cette tolérance ; l'état de l'axe n'est alors pas modifié.
+     */
+    bool TryEnableApproximants(double tolerance);
+    void DisableApproximants();
+    bool ApproximantsEnabled() const;
+
+    /**
+     * @brief Approximation utilisée pour un élément, nullptr s'il est évalué exactement.
+     */
+    const Horizontal::ClotoideApproximant* Approximant(std::size_t index) const;
+
+    /**
+     * @brief Points (et normales) d'un élément aux abscisses curvilignes s, par son approximation si elle
+     * est active, sinon par l'élément exact.
+     * @throws std::out_of_range Si l'index est hors bornes.
+     */
+    void ElementPoints(std::size_t index, std::span<const double> s, std::span<Point2D> points) const;
+    void ElementPoints(std::size_t index, std::span<const double> s, std::span<Point2D> points, std::span<Vector2D> normals) const;
+
+    /**
+     * @brief Longueurs et stations de début déclarées dans le document LandXML (attributs length et
+     * staStart de l'axe et des éléments), NaN si elles sont absentes.
+     *
+     * Les éléments étant reconstruits à partir de leur géométrie, ces valeurs ne servent qu'au contrôle
+     * de cohérence du document (voir ContinuityValidator).
+     */
+    double DeclaredLength() const;
+    double DeclaredElementLength(std::size_t index) const;
+    double DeclaredElementStation(std::size_t index) const;
+
+    // Équations de station
+    const StationEquationTable& StationEquations() const;
+    void SetStationEquations(StationEquationTable stationEquations);
+
+    /**
+     * @brief Conversions entre stations internes (utilisées par l'évaluation) et stations externes
+     * (chaînage), voir StationEquationTable ; les conversions par lots passent par StationEquations().
+     * @throws std::runtime_error Si la station externe n'existe pas.
+     */
+    double ExternalStation(double internalStation) const;
+    double InternalStation(double externalStation) const;
+
+    // Profils en long
+    std::size_t ProfileCount() const;
+    const Vertical::VerticalAlignment& Profile(std::size_t index) const;
+    void AddProfile(Vertical::VerticalAlignment profile);
+
+    // Dévers
+    std::size_t CantCount() const;
+    const CantTable& Cant(std::size_t index) const;
+    void AddCant(CantTable cant);
+
+    // Évaluation à une station (hors de l'axe, l'élément extrême est prolongé)
+    Point2D Point(double station) const;
+    Vector2D Normal(double station) const;
+    double Curvature(double station) const;
+
+    /**
+     * @brief Évaluation à une station interne ou externe ; une station externe est d'abord convertie par InternalStation.
+     * @throws std::runtime_error Si la station externe n'existe pas.
+     */
+    Point2D Point(double station, StationType type) const;
+    Vector2D Normal(double station, StationType type) const;
+    double Curvature(double station, StationType type) const;
+
+    /**
+     * @brief Stations de StaStart à StaEnd espacées de step, calculées sans cumul du pas ; la dernière
+     * est StaEnd, le dernier intervalle pouvant être plus court.
+     * @throws std::runtime_error Si step n'est pas strictement positif.
+     */
+    std::vector<double> FixedStepStations(double step) const;
+
+    /**
+     * @brief Nombre de sommets de la discrétisation de l'axe complet (jonctions comptées une seule fois).
+     * @throws std::runtime_error Si maxThrow n'est pas strictement positif et fini.
+     */
+    std::size_t PointCount(double maxThrow) const;
+
+    /**
+     * @brief Discrétise l'axe complet dans un tableau unique, les éléments étant répartis entre plusieurs threads.
+     *
+     * Chaque élément écrit ses sommets à sa position dans le tableau, obtenue par sommes cumulées des
+     * nombres de sommets des éléments ; le sommet de jonction entre deux éléments est celui du début
+     * de l'élément suivant. Le résultat ne dépend pas du nombre de threads.
+     * @param points Tableau de taille PointCount(maxThrow).
+     * @param threadCount Nombre de threads ; 0 pour utiliser tous les cœurs disponibles.
+     * @throws std::runtime_error Si maxThrow n'est pas strictement positif et fini, ou si la taille du
+     * tableau ne correspond pas.
+     */
+    void Points(double maxThrow, std::span<Point2D> points, unsigned threadCount = 0) const;
+    std::vector<Point2D> Points(double maxThrow, unsigned threadCount = 0) const;
+
+    // Sérialisation
+    void ReadLandXML(xmlTextReaderPtr reader) override;
+    void WriteLandXML(xmlTextWriterPtr writer) const override;
+
+    /**
+     * @brief Lit un élément de <CoordGeom> (<Line>, <Curve> ou <Spiral>) sur lequel le lecteur est positionné.
+     * @return L'élément lu, ou nullptr si le nœud n'est pas un élément géométrique supporté.
+     */
+    static std::unique_ptr<Horizontal::HorizontalAlignment> ReadElement(xmlTextReaderPtr reader);
+};
+
+} // namespace LineaCore::Geometry::Alignments
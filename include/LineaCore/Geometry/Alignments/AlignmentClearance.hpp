@@ -0,0 +1,84 @@
+// AlignmentClearance.hpp
+#pragma once
+
+#include "Alignment.hpp"
+#include "AlignmentProjector.hpp"
+#include "BoundsTree.hpp"
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace LineaCore::Geometry::Alignments {
+
+/**
+ * @brief Couple de points les plus proches entre deux axes.
+ */
+struct ClearancePoint {
+    double StationA;    ///< Station sur le premier axe
+    double StationB;    ///< Station sur le second axe
+    Point2D PointA;
+    Point2D PointB;
+    double Distance;
+};
+
+/**
+ * @brief Distance entre deux axes : minimum global et distance échantillonnée le long du premier axe.
+ */
+struct ClearanceProfile {
+    ClearancePoint Minimum;
+    std::vector<double> Stations;    ///< Stations du premier axe, à pas constant
+    std::vector<double> Distances;   ///< Distance de chaque station au second axe
+};
+
+/**
+ * @class AlignmentClearance
+ * @brief Distances minimales (entraxes, gabarits) entre un axe et d'autres axes.
+ *
+ * Chaque axe est indexé une fois par la hiérarchie des boîtes englobantes exactes de ses éléments
+ * (BoundsTree). Le minimum entre deux axes est obtenu par un parcours simultané des deux hiérarchies,
+ * les paires de nœuds dont les boîtes sont plus éloignées que la meilleure distance courante étant écartées.
+ * Chaque paire d'éléments restante est résolue exactement :
+ * - droites et arcs : projections des extrémités, points de normale commune et intersections, en
+ *   forme close ;
+ * - clotoïdes : minima locaux de la distance entre échantillons, affinés par la méthode de Newton
+ *   sur les deux abscisses.
+ *
+ * L'objet référence l'axe, qui doit lui survivre et ne pas être modifié.
+ */
+class AlignmentClearance {
+private:
+    const Alignment* _alignment;
+    BoundsTree _tree;
+    AlignmentProjector _projector;
+
+public:
+    /**
+     * @param maxThrow Flèche de la discrétisation servant à la projection sur l'axe (Profile).
+     * @throws std::runtime_error Si l'axe ne contient aucun élément ou si maxThrow n'est pas strictement positif et fini.
+     */
+    explicit AlignmentClearance(const Alignment& alignment, double maxThrow = 0.01);
+
+    const Alignment& GetAlignment() const;
+
+    /**
+     * @brief Points les plus proches entre cet axe et un autre.
+     */
+    ClearancePoint Minimum(const AlignmentClearance& other) const;
+
+    /**
+     * @brief Minimum global et distance à l'autre axe tous les step le long de cet axe, depuis StaStart,
+     * la station de fin étant toujours incluse.
+     * @throws std::runtime_error Si le pas n'est pas strictement positif.
+     */
+    ClearanceProfile Profile(const AlignmentClearance& other, double step) const;
+
+    /**
+     * @brief Calcule Profile pour une liste de couples d'axes, répartis entre plusieurs threads.
+     * @param threadCount Nombre de threads ; 0 pour utiliser tous les cœurs disponibles.
+     * @throws std::runtime_error Comme Profile.
+     */
+    static std::vector<ClearanceProfile> Profiles(std::span<const std::pair<const AlignmentClearance*, const AlignmentClearance*>> pairs,
+                                                  double step, unsigned threadCount = 0);
+};
+
+} // namespace LineaCore::Geometry::Alignments
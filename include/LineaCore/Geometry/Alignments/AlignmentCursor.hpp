@@ -0,0 +1,91 @@
+// AlignmentCursor.hpp
+#pragma once
+
+#include "Alignment.hpp"
+#include <cstddef>
+#include <span>
+
+namespace LineaCore::Geometry::Alignments {
+
+/**
+ * @class AlignmentCursor
+ * @brief Parcours d'un axe à pas constant, par récurrences, sans fonction trigonométrique par échantillon.
+ *
+ * Le curseur conserve l'élément courant et avance d'un pas à chaque appel de Next :
+ * - alignement droit et arc : la normale est tournée d'un angle constant (rotation précalculée) et le
+ *   point avance de la corde exacte de l'arc, exprimée dans le repère de la tangente ;
+ * - clotoïde : l'angle de rotation par pas varie linéairement, il est lui-même obtenu par une
+ *   rotation constante ; le point est intégré par la règle de Simpson avec la normale au milieu du pas.
+ *
+ * Pour borner la dérive des récurrences, le point et la normale sont recalculés exactement tous les
+ * ReanchorInterval pas, ainsi qu'à chaque changement d'élément. Les stations sont calculées à partir
+ * de la station d'origine (origine + i·pas), sans cumul du pas.
+ */
+class AlignmentCursor {
+private:
+    const Alignment& _alignment;
+    double _step;
+    double _origin;            // Station du premier échantillon
+    std::size_t _index;        // Nombre de pas depuis l'origine
+    double _station;
+
+    // Élément courant
+    std::size_t _element;
+    double _elementStart;
+    double _elementEnd;        // +inf pour le dernier élément
+    double _orientation;       // Tangente = orientation × normale tournée de 90° antihoraire
+    double _curvatureRate;     // Variation de courbure par unité de longueur (clotoïde)
+
+    // État courant et récurrences
+    std::size_t _stepsSinceAnchor;
+    Point2D _anchorPoint;
+    double _dx, _dy;           // Déplacement cumulé depuis le point d'ancrage (petit devant les coordonnées)
+    Point2D _point;
+    Vector2D _normal;
+    double _curvature;
+    Vector2D _rotation;        // Rotation de la normale sur le pas suivant (cos, sin)
+    Vector2D _halfRotation;    // Clotoïde : rotation jusqu'au milieu du pas suivant
+    Vector2D _rotationRate;    // Clotoïde : variation de _rotation d'un pas au suivant
+    Vector2D _halfRotationRate;
+    double _chordAlong;        // Arc : corde du pas, selon la tangente
+    double _chordAcross;       // Arc : corde du pas, selon la normale à gauche
+
+    void Anchor(double station, bool findElement);
+
+public:
+    /// Nombre de pas entre deux recalculs exacts
+    static constexpr std::size_t ReanchorInterval = 64;
+
+    /**
+     * @param station Station du premier échantillon.
+     * @param step Pas d'avancement, strictement positif.
+     * @throws std::runtime_error Si l'axe ne contient aucun élément ou si le pas n'est pas strictement positif.
+     */
+    AlignmentCursor(const Alignment& alignment, double station, double step);
+
+    double Station() const;
+    double Step() const;
+    std::size_t ElementIndex() const;
+    const Point2D& Point() const;
+    const Vector2D& Normal() const;
+    double Curvature() const;
+
+    /**
+     * @brief Avance d'un pas.
+     */
+    void Next();
+
+    /**
+     * @brief Repositionne le curseur à une station quelconque, qui devient la nouvelle origine.
+     */
+    void Seek(double station);
+
+    /**
+     * @brief Écrit les échantillons successifs à partir de la position courante, en avançant d'un pas
+     * après chacun : le curseur est ensuite positionné sur l'échantillon suivant le dernier écrit.
+     * @throws std::runtime_error Si les tailles des tableaux diffèrent.
+     */
+    void Points(std::span<Point2D> points, std::span<Vector2D> normals);
+};
+
+} // namespace LineaCore::Geometry::Alignments
@@ -0,0 +1,77 @@
+// AlignmentProjector.hpp
+#pragma once
+
+#include "Alignment.hpp"
+#include "UniformGrid.hpp"
+#include "LineaCore/Geometry/BoundingBox.hpp"
+#include "LineaCore/Geometry/Point2D.hpp"
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace LineaCore::Geometry::Alignments {
+
+/**
+ * @brief Résultat de la projection d'un point sur un axe.
+ */
+struct StationOffset {
+    double Station;             ///< Station du projeté orthogonal
+    double Offset;              ///< Déport signé, positif à droite de l'axe dans le sens de parcours
+    std::size_t ElementIndex;   ///< Index de l'élément portant le projeté
+};
+
+/**
+ * @class AlignmentProjector
+ * @brief Conversion de points XY en couples (station, déport) sur un axe.
+ *
+ * Les éléments sont discrétisés une fois pour toutes et indexés dans une grille régulière.
+ * Pour chaque point, la grille fournit les éléments candidats par anneaux successifs ; chaque
+ * candidat dont la boîte englobante est plus proche que la meilleure solution courante est
+ * résolu exactement par HorizontalAlignment::Projection (forme close pour les droites et les arcs,
+ * Newton amorcé par la discrétisation pour les clotoïdes).
+ *
+ * Le projecteur référence l'axe, qui doit lui survivre et ne pas être modifié.
+ */
+class AlignmentProjector {
+private:
+    const Alignment& _alignment;
+    std::vector<BoundingBox> _bounds;    // Boîtes englobantes élargies de la tolérance de discrétisation
+    std::vector<std::uint32_t> _firstVertices; // Premier sommet de la discrétisation de chaque élément, plus le nombre total
+    std::vector<Point2D> _vertices;      // Sommets de discrétisation de tous les éléments
+    std::vector<double> _vertexAbscissas;
+
+    // Grille régulière : pour chaque cellule, liste des éléments dont la boîte la recouvre
+    UniformGrid _grid;
+
+    void BuildTessellation(double maxThrow);
+
+    double SeedAbscissa(std::size_t element, const Point2D& point) const;
+    void SolveElement(std::size_t element, const Point2D& point, double& bestDistance, StationOffset& best) const;
+    StationOffset ProjectBruteForce(const Point2D& point) const;
+    StationOffset ProjectWithGrid(const Point2D& point) const;
+
+public:
+    /**
+     * @brief Prépare la discrétisation et l'index de l'axe.
+     * @param alignment Axe de référence (non vide).
+     * @param maxThrow Flèche maximale de la discrétisation servant à amorcer les clotoïdes.
+     * @throws std::runtime_error Si l'axe ne contient aucun élément ou si maxThrow n'est pas strictement positif et fini.
+     */
+    explicit AlignmentProjector(const Alignment& alignment, double maxThrow = 0.01);
+
+    /**
+     * @brief Projette un point sur l'axe (point le plus proche).
+     */
+    StationOffset Project(const Point2D& point) const;
+
+    /**
+     * @brief Projette un lot de points, en parallèle.
+     * @param points Points à projeter.
+     * @param results Résultats (même taille que points).
+     * @param threadCount Nombre de threads ; 0 pour utiliser tous les cœurs disponibles.
+     * @throws std::runtime_error Si les tailles des tableaux diffèrent.
+     */
+    void Project(std::span<const Point2D> points, std::span<StationOffset> results, unsigned threadCount = 0) const;
+};
+
+} // namespace LineaCore::Geometry::Alignments
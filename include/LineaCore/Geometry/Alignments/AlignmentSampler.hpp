@@ -0,0 +1,88 @@
+// AlignmentSampler.hpp
+#pragma once
+
+#include "Alignment.hpp"
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace LineaCore::Geometry::Alignments {
+
+/**
+ * @brief Échantillons 3D d'un axe, stockés par composante (un tableau par grandeur).
+ */
+struct AlignmentSamples {
+    std::vector<double> Station;
+    std::vector<double> X;
+    std::vector<double> Y;
+    std::vector<double> Z;           ///< Altitude du profil (0 sans profil)
+    std::vector<double> Heading;     ///< Angle de la tangente en plan avec l'axe X, dans [-π, π]
+    std::vector<double> Curvature;   ///< Courbure en plan
+    std::vector<double> Grade;       ///< Pente du profil (0 sans profil)
+    std::vector<double> Cant;        ///< Dévers appliqué (0 sans table de dévers)
+
+    std::size_t Size() const;
+    void Resize(std::size_t size);
+};
+
+/**
+ * @class AlignmentSampler
+ * @brief Échantillonnage 3D d'un axe (plan, profil en long et dévers) en un seul parcours des stations.
+ *
+ * Les stations sont traitées par blocs. Dans chaque bloc, les éléments en plan sont parcourus par
+ * plages de stations consécutives (une seule répartition virtuelle par plage, approximations des
+ * clotoïdes comprises), puis le profil et le dévers sont évalués avec leurs curseurs de tronçon.
+ * Les stations triées sont le cas rapide ; des stations quelconques restent correctes.
+ *
+ * L'échantillonnage est réparti entre plusieurs threads par découpage de la plage de stations ;
+ * le résultat ne dépend pas du nombre de threads. Les stations sont internes, ou externes
+ * (chaînage) après SetInputStationType(StationType::External) : elles sont alors converties bloc par
+ * bloc par les équations de station de l'axe, et Station contient les stations externes.
+ */
+class AlignmentSampler {
+private:
+    const Alignment& _alignment;
+    const Vertical::VerticalAlignment* _profile;
+    const CantTable* _cant;
+    StationType _inputStationType;
+
+    void SampleRange(std::span<const double> stations, StationType type, AlignmentSamples& samples, std::size_t first) const;
+    void SampleStations(std::span<const double> stations, StationType type, AlignmentSamples& samples, unsigned threadCount) const;
+
+public:
+    /**
+     * @brief Échantillonneur utilisant le premier profil et la première table de dévers de l'axe, s'ils existent.
+     */
+    explicit AlignmentSampler(const Alignment& alignment);
+
+    /**
+     * @param profile Profil en long, ou nullptr.
+     * @param cant Table de dévers, ou nullptr.
+     */
+    AlignmentSampler(const Alignment& alignment, const Vertical::VerticalAlignment* profile, const CantTable* cant);
+
+    /**
+     * @brief Nature des stations transmises à Sample (internes par défaut).
+     */
+    StationType InputStationType() const;
+    void SetInputStationType(StationType type);
+
+    /**
+     * @brief Échantillonne l'axe aux stations données.
+     * @param threadCount Nombre de threads ; 0 pour utiliser tous les cœurs disponibles.
+     * @throws std::runtime_error Si l'axe ne contient aucun élément, ou si une station externe n'existe pas.
+     */
+    void Sample(std::span<const double> stations, AlignmentSamples& samples, unsigned threadCount = 0) const;
+    AlignmentSamples Sample(std::span<const double> stations, unsigned threadCount = 0) const;
+
+    /**
+     * @brief Échantillonne l'axe à pas constant depuis StaStart, la station de fin étant toujours incluse.
+     *
+     * Le pas est compté en stations internes, le chaînage externe pouvant présenter des sauts ; en mode
+     * externe, Station contient la station externe de chaque échantillon.
+     * @throws std::runtime_error Si le pas n'est pas strictement positif, ou comme Sample.
+     */
+    AlignmentSamples Sample(double step, unsigned threadCount = 0) const;
+};
+
+} // namespace LineaCore::Geometry::Alignments
@@ -0,0 +1,37 @@
+// BatchUtils.hpp
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace LineaCore::Geometry::Alignments {
+
+/**
+ * @class BatchUtils
+ * @brief Utilitaires communs aux traitements par lots : contrôle des tailles et exécution parallèle.
+ */
+class BatchUtils {
+public:
+    /**
+     * @brief Vérifie qu'un tableau de sortie d'une évaluation par lots a la taille du tableau de stations.
+     * @throws std::runtime_error Si les tailles diffèrent.
+     */
+    static void CheckBatchSize(std::size_t stationCount, std::size_t outputCount);
+
+    /**
+     * @brief Nombre de threads à utiliser : threadCount, ou le nombre de cœurs disponibles s'il est nul.
+     */
+    static unsigned ThreadCount(unsigned threadCount);
+
+    /**
+     * @brief Exécute task(k) pour k de 0 à taskCount - 1 sur au plus threadCount threads, thread appelant compris.
+     *
+     * Les tâches sont distribuées au fil de l'eau, par index croissant. Après une exception, les tâches
+     * non commencées sont abandonnées ; l'exception de la tâche d'index le plus petit est relancée une
+     * fois tous les threads terminés, comme lors d'une exécution séquentielle.
+     * @param threadCount Nombre de threads ; 0 pour utiliser tous les cœurs disponibles.
+     */
+    static void ParallelFor(std::size_t taskCount, unsigned threadCount, const std::function<void(std::size_t task)>& task);
+};
+
+} // namespace LineaCore::Geometry::Alignments
@@ -0,0 +1,67 @@
+// BoundsTree.hpp
+#pragma once
+
+#include "Alignment.hpp"
+#include "LineaCore/Geometry/BoundingBox.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace LineaCore::Geometry::Alignments {
+
+/**
+ * @class BoundsTree
+ * @brief Hiérarchie de boîtes englobantes des éléments d'un axe, sans discrétisation.
+ *
+ * Les feuilles portent les boîtes exactes des éléments (HorizontalAlignment::Bounds). Les éléments
+ * se suivant le long de l'axe, chaque nœud couvre une plage contiguë d'éléments, coupée en son milieu
+ * pour former ses deux enfants. Les nœuds sont rangés en préordre, la racine en tête : les feuilles
+ * apparaissent dans l'ordre des éléments.
+ *
+ * L'arbre sert au tri préalable des requêtes spatiales (distances entre axes, fenêtres d'affichage,
+ * indexation) ; il ne référence pas l'axe après sa construction.
+ */
+class BoundsTree {
+public:
+    /**
+     * @brief Nœud de la hiérarchie : boîte de la plage d'éléments [First, First + Count).
+     */
+    struct Node {
+        BoundingBox Bounds;
+        std::uint32_t First, Count;      ///< Plage d'éléments couverte
+        std::uint32_t Left, Right;       ///< Enfants, sans objet pour une feuille (Count == 1)
+    };
+
+private:
+    std::vector<Node> _nodes;            // Préordre, racine en tête
+    std::vector<std::uint32_t> _leaves;  // Feuille de chaque élément
+
+    std::uint32_t BuildNode(const std::vector<BoundingBox>& elementBounds, std::uint32_t first, std::uint32_t count);
+
+public:
+    /**
+     * @brief Arbre des éléments d'un axe ; vide si l'axe ne contient aucun élément.
+     */
+    explicit BoundsTree(const Alignment& alignment);
+
+    std::size_t ElementCount() const;
+    std::size_t NodeCount() const;
+    const Node& GetNode(std::size_t index) const;
+
+    /**
+     * @brief Boîte de l'axe complet (vide si l'arbre est vide).
+     */
+    BoundingBox Bounds() const;
+
+    /**
+     * @brief Boîte exacte d'un élément.
+     */
+    const BoundingBox& ElementBounds(std::size_t element) const;
+
+    /**
+     * @brief Ajoute à elements, par ordre croissant, les index des éléments dont la boîte recouvre box.
+     */
+    void Query(const BoundingBox& box, std::vector<std::size_t>& elements) const;
+    std::vector<std::size_t> Query(const BoundingBox& box) const;
+};
+
+} // namespace LineaCore::Geometry::Alignments
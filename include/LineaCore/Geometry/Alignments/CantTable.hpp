@@ -0,0 +1,101 @@
+// CantTable.hpp
+#pragma once
+
+#include "LineaCore/LandXML/LandXMLSerializable.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace LineaCore::Geometry::Alignments {
+
+/**
+ * @brief Sens de la courbure en plan à une station de dévers.
+ */
+enum class CantCurvature : std::uint8_t {
+    Clockwise,          ///< "cw"
+    CounterClockwise    ///< "ccw"
+};
+
+/**
+ * @brief Station de dévers (<CantStation> de <Cant>).
+ */
+struct CantStation {
+    double Station;
+    double AppliedCant;
+    CantCurvature Curvature = CantCurvature::Clockwise;
+    bool Adverse = false;
+};
+
+/**
+ * @class CantTable
+ * @brief Table de dévers d'un axe (<Cant>) : dévers appliqué interpolé linéairement entre les stations.
+ *
+ * Les stations sont stockées en tableaux contigus (stations, dévers, variation de dévers par unité
+ * de station sur l'intervalle suivant). Avant la première station et après la dernière, le dévers
+ * est constant. L'évaluation par lots avance un curseur sur les intervalles pour des stations
+ * croissantes, sans recherche par échantillon.
+ */
+class CantTable : public LandXML::LandXMLSerializable {
+private:
+    std::string _name;
+    std::string _description;
+    double _gauge;
+    std::string _rotationPoint;
+
+    std::vector<double> _stations;
+    std::vector<double> _appliedCants;
+    std::vector<double> _gradients;    // Variation sur [station i, station i + 1] ; nulle après la dernière station
+    std::vector<CantCurvature> _curvatures;
+    std::vector<std::uint8_t> _adverse;
+
+    void BuildGradients();
+
+public:
+    CantTable();
+
+    /**
+     * @throws std::runtime_error Si la table est vide ou si les stations ne sont pas strictement croissantes.
+     */
+    CantTable(std::string name, double gauge, std::string rotationPoint, const std::vector<CantStation>& stations);
+
+    // Propriétés
+    const std::string& Name() const;
+    const std::string& Description() const;
+    double Gauge() const;
+    const std::string& RotationPoint() const;
+
+    // Stations
+    std::size_t StationCount() const;
+    CantStation Station(std::size_t index) const;
+    std::span<const double> Stations() const;
+    std::span<const double> AppliedCants() const;
+
+    /**
+     * @brief Index de la dernière station inférieure ou égale à une station (0 avant la première).
+     * @throws std::runtime_error Si la table est vide.
+     */
+    std::size_t IntervalIndex(double station) const;
+
+    // Évaluation à une station
+    double AppliedCant(double station) const;
+
+    /**
+     * @brief Variation du dévers par unité de station (nulle hors de la table).
+     */
+    double CantGradient(double station) const;
+
+    /**
+     * @brief Évaluation par lots ; les stations croissantes sont parcourues avec un curseur.
+     * @throws std::runtime_error Si les tailles des tableaux diffèrent.
+     */
+    void AppliedCant(std::span<const double> stations, std::span<double> appliedCants) const;
+    void CantGradient(std::span<const double> stations, std::span<double> gradients) const;
+
+    // Sérialisation
+    void ReadLandXML(xmlTextReaderPtr reader) override;
+    void WriteLandXML(xmlTextWriterPtr writer) const override;
+};
+
+} // namespace LineaCore::Geometry::Alignments
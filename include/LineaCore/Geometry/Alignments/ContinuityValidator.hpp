@@ -0,0 +1,120 @@
+// ContinuityValidator.hpp
+#pragma once
+
+#include "Alignment.hpp"
+#include <cstddef>
+#include <ostream>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace LineaCore::Geometry::Alignments {
+
+/**
+ * @brief Contrôles effectués par ContinuityValidator.
+ */
+enum class ContinuityCheck {
+    Position,          ///< G0 : écart entre la fin d'un élément et le début du suivant (m)
+    Tangent,           ///< G1 : angle entre les tangentes de part et d'autre de la jonction (rad)
+    Curvature,         ///< G2 : saut de courbure à la jonction (1/m)
+    ElementLength,     ///< Écart entre la longueur déclarée d'un élément et sa longueur calculée (m)
+    ElementStation,    ///< Écart entre la station de début déclarée d'un élément et sa station calculée (m)
+    StationEquation,   ///< Écart entre StaBack d'une équation de station et le chaînage atteint à sa station interne (m)
+    AlignmentLength    ///< Écart entre la longueur déclarée de l'axe et la somme des longueurs des éléments (m)
+};
+
+/**
+ * @brief Écarts admis par contrôle ; les écarts strictement supérieurs sont reportés.
+ */
+struct ContinuityTolerances {
+    double Position = 1e-3;     ///< m
+    double Angle = 1e-5;        ///< rad
+    double Curvature = 1e-5;    ///< 1/m
+    double Length = 1e-3;       ///< m, pour les longueurs et les stations déclarées
+};
+
+/**
+ * @brief Écart hors tolérance.
+ */
+struct ContinuityIssue {
+    ContinuityCheck Check;
+    std::size_t Element;    ///< Élément contrôlé ; pour une jonction, l'élément qui la suit ; pour une équation de
+                            ///< station, l'élément qui la porte ; ElementCount pour l'axe
+    double Station;         ///< Station interne de la jonction, du début de l'élément, de l'équation ou de la fin de l'axe
+    double Deviation;       ///< Écart mesuré, en valeur absolue
+};
+
+/**
+ * @brief Résultat du contrôle d'un axe.
+ */
+struct AlignmentContinuity {
+    std::string Name;
+    std::size_t ElementCount = 0;
+    double MaxPositionGap = 0.0;      ///< Plus grand écart de position aux jonctions
+    double MaxAngleGap = 0.0;         ///< Plus grand angle entre tangentes aux jonctions
+    double MaxCurvatureJump = 0.0;    ///< Plus grand saut de courbure aux jonctions
+    bool ExternalStations = false;    ///< Stations de début des éléments déclarées en stations externes
+    std::vector<ContinuityIssue> Issues;   ///< Par ordre de station
+};
+
+/**
+ * @brief Résultat du contrôle d'un fichier.
+ */
+struct FileContinuity {
+    std::string FileName;
+    std::string Error;      ///< Erreur de lecture, vide si le fichier a été lu
+    std::vector<AlignmentContinuity> Alignments;
+};
+
+/**
+ * @class ContinuityValidator
+ * @brief Contrôle de la continuité géométrique des axes en plan et de la cohérence des valeurs déclarées.
+ *
+ * À chaque jonction entre éléments consécutifs sont contrôlés la position (G0), la tangente (G1) et
+ * la courbure (G2). Les tangentes sont comparées par les normales de fin et de début des éléments
+ * ramenées à droite du sens de parcours (HorizontalAlignment::NormalSide), les normales des arcs
+ * parcourus dans le sens horaire étant à gauche. Les longueurs et stations de début déclarées dans
+ * le document (Alignment::DeclaredLength, DeclaredElementLength, DeclaredElementStation) sont
+ * comparées aux valeurs calculées. Selon les logiciels, les stations de début des éléments sont
+ * écrites en stations internes ou externes : les deux repères ne diffèrent qu'après une équation de
+ * station, et le repère de l'axe est celui auquel correspondent le plus d'éléments situés après une
+ * équation (les stations externes de LandXML à égalité). Chaque élément est comparé dans ce repère.
+ * L'attribut staBack de chaque équation de station est comparé au chaînage atteint à sa station
+ * interne (StationEquationTable::StaBackDeviation).
+ *
+ * Une jonction entre une droite et un arc sans raccordement progressif est continue en tangente
+ * mais pas en courbure : elle est reportée par le contrôle G2, dont les résultats s'interprètent
+ * selon les règles de conception du projet.
+ */
+class ContinuityValidator {
+public:
+    /**
+     * @brief Contrôle un axe.
+     */
+    static AlignmentContinuity Validate(const Alignment& alignment, const ContinuityTolerances& tolerances = {});
+
+    /**
+     * @brief Lit et contrôle des fichiers LandXML, répartis entre plusieurs threads.
+     *
+     * Chaque fichier est lu et contrôlé par un seul thread, les fichiers étant distribués au fil de
+     * l'eau : le débit est celui de la lecture des fichiers. Une erreur de lecture est reportée dans
+     * le résultat du fichier et n'interrompt pas le traitement des autres.
+     * @param threadCount Nombre de threads ; 0 pour utiliser tous les cœurs disponibles.
+     * @return Un résultat par fichier, dans l'ordre de fileNames.
+     */
+    static std::vector<FileContinuity> ValidateFiles(std::span<const std::string> fileNames, const ContinuityTolerances& tolerances = {},
+                                                     unsigned threadCount = 0);
+
+    /**
+     * @brief Écrit le rapport JSON d'un contrôle : tolérances, synthèse, puis résultats par fichier et par axe.
+     */
+    static void WriteJson(std::ostream& stream, std::span<const FileContinuity> files, const ContinuityTolerances& tolerances);
+
+    /**
+     * @brief Nom d'un contrôle dans le rapport JSON ("position", "tangent", "curvature", "element_length",
+     * "element_station", "station_equation", "alignment_length").
+     */
+    static const char* CheckName(ContinuityCheck check);
+};
+
+} // namespace LineaCore::Geometry::Alignments
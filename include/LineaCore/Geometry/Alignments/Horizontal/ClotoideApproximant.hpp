@@ -0,0 +1,78 @@
+// ClotoideApproximant.hpp
+#pragma once
+
+#include "ClotoideTransition.hpp"
+#include "LineaCore/Geometry/Point2D.hpp"
+#include "LineaCore/Geometry/Vector2D.hpp"
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace LineaCore::Geometry::Alignments::Horizontal {
+
+/**
+ * @class ClotoideApproximant
+ * @brief Représentation polynomiale par morceaux d'une clotoïde, pour une évaluation rapide.
+ *
+ * La clotoïde est découpée en segments de même longueur ; sur chaque segment, les coordonnées du
+ * point et de la normale sont interpolées aux nœuds de Tchebychev par des polynômes de degré
+ * Degree, stockés sous forme de Horner. L'évaluation se réduit au calcul de l'index du segment et
+ * à quelques multiplications-additions, sans trigonométrie ni branchement selon l'abscisse.
+ *
+ * Le nombre de segments est doublé jusqu'à ce que l'écart à l'évaluation exacte, vérifié sur un
+ * échantillonnage dense de chaque segment, respecte la tolérance. Hors de [0, Length()], les
+ * évaluations sont déléguées à la clotoïde exacte.
+ */
+class ClotoideApproximant {
+public:
+    static constexpr int Degree = 7;
+    static constexpr std::size_t MaxSegmentCount = 1 << 16;
+
+private:
+    static constexpr std::size_t CoefficientCount = Degree + 1;
+    static constexpr std::size_t SegmentStride = 4 * CoefficientCount;   // X, Y, normale X, normale Y
+
+    ClotoideTransition _clotoide;          // Évaluation exacte hors du domaine approché
+    double _length;
+    double _segmentScale;                  // Nombre de segments par unité d'abscisse
+    std::size_t _segmentCount;
+    double _tolerance;
+    double _maxError;
+    std::vector<double> _coefficients;     // SegmentStride coefficients par segment, de degré décroissant
+
+    void Fit(std::size_t segmentCount);
+    double MeasureError() const;
+    const double* Segment(double s, double& u) const;
+
+public:
+    ClotoideApproximant();
+
+    /**
+     * @brief Construit l'approximation d'une clotoïde à une tolérance donnée.
+     * @param tolerance Écart maximal admis sur les points (m) et sur les normales (rad).
+     * @return false si la tolérance n'est pas strictement positive ou ne peut être atteinte avec
+     * MaxSegmentCount segments ; l'approximation n'est alors pas modifiée.
+     */
+    static bool TryBuild(const ClotoideTransition& clotoide, double tolerance, ClotoideApproximant& approximant);
+
+    const ClotoideTransition& Clotoide() const;
+    double Length() const;
+    std::size_t SegmentCount() const;
+    double Tolerance() const;
+
+    /**
+     * @brief Écart maximal mesuré lors de la construction.
+     */
+    double MaxError() const;
+
+    Point2D Point(double s) const;
+    Vector2D Normal(double s) const;
+
+    /**
+     * @throws std::runtime_error Si les tailles des tableaux diffèrent.
+     */
+    void Point(std::span<const double> s, std::span<Point2D> points) const;
+    void Normal(std::span<const double> s, std::span<Vector2D> normals) const;
+};
+
+} // namespace LineaCore::Geometry::Alignments::Horizontal
@@ -6,9 +6,29 @@
 #include "LineaCore/Geometry/Vector2D.hpp"
 #include <vector>
 #include <cmath>
+#include <span>
 
 namespace LineaCore::Geometry::Alignments::Horizontal {
 
+/**
+ * @brief Données de définition d'une clotoïde par sa corde et ses courbures extrêmes.
+ */
+struct ClotoideFitInput {
+    Point2D StartingPoint;
+    Vector2D ChordVector;
+    double StartingCurvature;
+    double EndingCurvature;
+};
+
+/**
+ * @brief Diagnostic de la résolution d'une clotoïde (TryFromVectorAndCurvatures).
+ */
+struct ClotoideFitStatistics {
+    int Iterations = 0;              ///< Nombre d'évaluations de la longueur de corde
+    double RelativeResidual = 0.0;   ///< |corde calculée - corde attendue| / corde attendue
+    bool Converged = false;
+};
+
 class ClotoideTransition : public TransitionAlignment, public LandXML::LandXMLSerializable {
 private:
     double _A;                      // Paramètre de la cloto
@@ -19,29 +39,79 @@ private:
     Vector2D _translationVector;    // Vecteur translation pour le passage du repère local au repère global
 
 public:
+    ClotoideTransition(){};
     ClotoideTransition(double parameter, double startAbscissa, double length, const Vector2D& rotationVector, const Vector2D& translationVector);
     virtual ~ClotoideTransition() = default;
 
     double Length() const override;
 
+    // Paramètres de définition
+    double Parameter() const;
+    double StartAbscissa() const;
+    const Vector2D& RotationVector() const;
+    const Vector2D& TranslationVector() const;
+
     Point2D Point(double s) const override;
     Vector2D Normal(double s) const override;
     double Curvature(double s) const override;
 
-    std::vector<Point2D> Points(double maxThrow) const override;
+    void Point(std::span<const double> s, std::span<Point2D> points) const override;
+    void Normal(std::span<const double> s, std::span<Vector2D> normals) const override;
+    void Curvature(std::span<const double> s, std::span<double> curvatures) const override;
+
+    double Projection(const Point2D& point, double sSeed) const override;
+    BoundingBox Bounds() const override;
+
+    using HorizontalAlignment::Points;
+    std::size_t PointCount(double maxThrow) const override;
+    void Points(double maxThrow, std::span<Point2D> points) const override;
 
     void ReadLandXML(xmlTextReaderPtr reader) override;
     void WriteLandXML(xmlTextWriterPtr writer) const override;
 
     // Constructeurs statiques pour générer des transitions
-    static bool TryFromVectorAndCurvatures(const Point2D& startingPoint, const Vector2D& chordVector, double startingCurvature, double endingCurvature, ClotoideTransition& clotoideArc);
+
+    /**
+     * @brief Définit la clotoïde de corde et de courbures extrêmes données.
+     *
+     * La longueur de corde est une fonction du paramètre |A| dont la dérivée est analytique ; la
+     * racine est obtenue par la méthode de Newton, protégée par un encadrement (bissection si le
+     * pas sort de l'intervalle) et limitée en nombre d'itérations.
+     *
+     * @param statistics Optionnel : nombre d'itérations et résidu de la résolution.
+     * @return false si les données sont dégénérées (corde nulle, courbures égales) ou si la
+     * résolution n'a pas convergé.
+     */
+    static bool TryFromVectorAndCurvatures(const Point2D& startingPoint, const Vector2D& chordVector, double startingCurvature, double endingCurvature, ClotoideTransition& clotoideArc, ClotoideFitStatistics* statistics = nullptr);
+
+    /**
+     * @brief Résout un lot de clotoïdes ensemble.
+     *
+     * Les itérations de Newton sont menées en parallèle sur toutes les clotoïdes non encore
+     * résolues, ce qui permet d'évaluer les intégrales de Fresnel par lots avec le noyau vectoriel.
+     * Les résultats sont ceux de la résolution individuelle, aux arrondis du noyau vectoriel près.
+     *
+     * @param clotoideArcs Clotoïdes résolues (même taille que inputs).
+     * @param statistics Optionnel : vide, ou même taille que inputs.
+     * @return false si au moins une clotoïde n'a pu être définie (voir statistics pour le détail).
+     * @throws std::runtime_error Si les tailles des tableaux diffèrent.
+     */
+    static bool TryFromVectorAndCurvatures(std::span<const ClotoideFitInput> inputs, std::span<ClotoideTransition> clotoideArcs, std::span<ClotoideFitStatistics> statistics = {});
+
+    /**
+     * @brief Lit les données d'un élément <Spiral> sans résoudre la clotoïde.
+     * @throws std::runtime_error Si un attribut ou un point requis est absent ou invalide.
+     */
+    static ClotoideFitInput ReadFitInput(xmlTextReaderPtr reader);
     //static bool TryFromPointToAlign(const Point2D& point, const Point2D& alignmentOrigin, const Vector2D& alignmentVector, ClotoideTransition& clotoideArc);
     //static bool TryFromAlignToPoint(const Point2D& oAlign, const Vector2D& vAlign, const Point2D& Pt, ClotoideTransition& clotoide);
 
+    // Point d'abscisse curviligne s sur la clotoïde de paramètre A, dans son repère local
+    static Point2D PtLoc(double s, double A);
+
 private:
 
     Point2D PI() const;
-    static Point2D PtLoc(double s, double A);
     bool IsCounterClockWise() const;
     //static Vector2D PtUnit(double s);
     //static double YsurXclotoUnit(double x);
@@ -0,0 +1,63 @@
+// FresnelKernel.hpp
+#pragma once
+
+#include <span>
+
+namespace LineaCore::Geometry::Alignments::Horizontal {
+
+/**
+ * @class FresnelKernel
+ * @brief Évaluation des points de la clotoïde unitaire (A = 1) par les intégrales de Fresnel.
+ *
+ * Pour une abscisse t, le point de la clotoïde unitaire est x(t) = ∫cos(u²/2)du, y(t) = ∫sin(u²/2)du.
+ * Les séries sont évaluées sous forme de Horner en t⁴ (x = t·P(t⁴), y = t³·Q(t⁴)), et le
+ * développement asymptotique est utilisé au-delà de |t| = 2√π, comme dans ClotoideTransition.
+ *
+ * Les versions vectorielles (AVX2 : 4 abscisses, AVX-512 : 8 abscisses) calculent la série sur
+ * toutes les voies puis mélangent le résultat asymptotique par masque, sans branchement par voie.
+ * L'implémentation est choisie à l'exécution selon le processeur ; une version scalaire est
+ * toujours disponible.
+ */
+class FresnelKernel {
+public:
+    enum class Implementation {
+        Scalar,
+        AVX2,
+        AVX512
+    };
+
+    /**
+     * @brief Évalue un point de la clotoïde unitaire.
+     * @param t Abscisse curviligne sur la clotoïde unitaire.
+     * @param x Abscisse du point calculé.
+     * @param y Ordonnée du point calculé.
+     */
+    static void Evaluate(double t, double& x, double& y);
+
+    /**
+     * @brief Évalue un lot de points de la clotoïde unitaire avec l'implémentation active.
+     * @param t Abscisses curvilignes sur la clotoïde unitaire.
+     * @param x Abscisses calculées (même taille que t).
+     * @param y Ordonnées calculées (même taille que t).
+     * @throws std::runtime_error Si les tailles des tableaux diffèrent.
+     */
+    static void Evaluate(std::span<const double> t, std::span<double> x, std::span<double> y);
+
+    /**
+     * @brief Évalue un lot de points avec une implémentation imposée.
+     * @throws std::runtime_error Si l'implémentation n'est pas supportée par le processeur.
+     */
+    static void Evaluate(Implementation implementation, std::span<const double> t, std::span<double> x, std::span<double> y);
+
+    /**
+     * @brief Indique si une implémentation est supportée par le processeur et le compilateur.
+     */
+    static bool IsSupported(Implementation implementation);
+
+    /**
+     * @brief Retourne l'implémentation sélectionnée à l'exécution (la plus large supportée).
+     */
+    static Implementation ActiveImplementation();
+};
+
+} // namespace LineaCore::Geometry::Alignments::Horizontal
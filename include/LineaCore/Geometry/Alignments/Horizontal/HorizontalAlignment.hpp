@@ -1,10 +1,12 @@
 // HorizontalAlignment.hpp
 #pragma once
 
+#include "LineaCore/Geometry/BoundingBox.hpp"
 #include "LineaCore/Geometry/Point2D.hpp"
 #include "LineaCore/Geometry/Vector2D.hpp"
 #include <vector>
 #include <string>
+#include <span>
 
 namespace LineaCore::Geometry::Alignments::Horizontal {
 
@@ -25,7 +27,22 @@ protected:
 
     void SetExtremities();
 
+    // Vérifie que le tableau fourni à Points(maxThrow, points) a la taille retournée par PointCount
+    static void CheckPointCount(std::size_t pointCount, std::size_t outputCount);
+
 public:
+    // Vérifie qu'une flèche de discrétisation est strictement positive et finie
+    static void CheckMaxThrow(double maxThrow);
+
+    // Nombre de segments de même longueur dont la flèche ne dépasse pas maxThrow, pour une courbe de
+    // longueur length et de courbure au plus curvature en valeur absolue : la flèche d'un arc de courbe
+    // de longueur ℓ est au plus c·ℓ²/8. Au moins un segment.
+    static std::size_t ChordSegmentCount(double length, double curvature, double maxThrow);
+    // Même borne pour l'élément, dont la courbure, constante ou linéaire en s, est maximale à une extrémité
+    std::size_t ChordSegmentCount(double maxThrow) const;
+    // Abscisses des sommets d'une grille de même pas sur [0, length], la dernière valant exactement length
+    static void UniformAbscissas(double length, std::span<double> abscissas);
+
     virtual ~HorizontalAlignment() = default;
 
     virtual H_Type Type() const = 0;
@@ -34,7 +51,28 @@ public:
     virtual Point2D Point(double s) const = 0;
     virtual Vector2D Normal(double s) const = 0;
     virtual double Curvature(double s) const = 0;
-    virtual std::vector<Point2D> Points(double maxThrow) const = 0;
+
+    // Discrétisation en polyligne dont la flèche ne dépasse pas maxThrow
+    virtual std::vector<Point2D> Points(double maxThrow) const;
+
+    // Discrétisation en deux passes, sans allocation : nombre de sommets, puis remplissage d'un tableau
+    // de cette taille. Les sommets suivent le sens de l'élément, de son début à sa fin.
+    // PointCount lève std::runtime_error si maxThrow n'est pas strictement positif et fini.
+    virtual std::size_t PointCount(double maxThrow) const = 0;
+    virtual void Points(double maxThrow, std::span<Point2D> points) const = 0;
+
+    // Évaluation par lots : une seule répartition virtuelle pour tout le tableau d'abscisses.
+    // Les résultats sont écrits dans les tableaux fournis, qui doivent avoir la taille de s.
+    virtual void Point(std::span<const double> s, std::span<Point2D> points) const;
+    virtual void Normal(std::span<const double> s, std::span<Vector2D> normals) const;
+    virtual void Curvature(std::span<const double> s, std::span<double> curvatures) const;
+
+    // Abscisse du point de l'élément le plus proche d'un point donné, bornée à [0, Length()].
+    // sSeed est une estimation initiale, utilisée par les éléments sans solution analytique.
+    virtual double Projection(const Point2D& point, double sSeed) const = 0;
+
+    // Boîte englobante exacte de l'élément, calculée sans discrétisation
+    virtual BoundingBox Bounds() const = 0;
 
     // Accesseurs pour les points et vecteurs calculés
     const Point2D& getStartingPoint() const { return startingPoint; }
@@ -45,6 +83,10 @@ public:
     // Getter pour la tangente de départ et de fin
     Vector2D StartingTangent() const;
     Vector2D EndingTangent() const;
+
+    // Côté de la normale par rapport au sens de parcours : +1 à droite, -1 à gauche. Les normales des
+    // arcs sont radiales vers l'extérieur : elles sont à gauche pour un arc parcouru dans le sens horaire.
+    double NormalSide() const;
     
 };
 
@@ -21,12 +21,22 @@ public:
 
     H_Type Type() const override;
     double Length() const override;
+    const Vector2D& Direction() const;
     
     Point2D Point(double s) const override;
     Vector2D Normal(double s) const override;
     double Curvature(double s) const override;
 
-    std::vector<Point2D> Points(double maxThrow) const override;
+    void Point(std::span<const double> s, std::span<Point2D> points) const override;
+    void Normal(std::span<const double> s, std::span<Vector2D> normals) const override;
+    void Curvature(std::span<const double> s, std::span<double> curvatures) const override;
+
+    double Projection(const Point2D& point, double sSeed) const override;
+    BoundingBox Bounds() const override;
+
+    using HorizontalAlignment::Points;
+    std::size_t PointCount(double maxThrow) const override;
+    void Points(double maxThrow, std::span<Point2D> points) const override;
 
         // Implémentation de LandXMLSerializable
     void ReadLandXML(xmlTextReaderPtr reader) override;
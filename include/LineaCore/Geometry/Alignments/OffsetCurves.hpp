@@ -0,0 +1,71 @@
+// OffsetCurves.hpp
+#pragma once
+
+#include "Alignment.hpp"
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace LineaCore::Geometry::Alignments {
+
+/**
+ * @class OffsetCurves
+ * @brief Courbes parallèles à un axe en plan (files de rails, bords de quai, gabarits), évaluées ensemble.
+ *
+ * Les décalages sont signés : positifs à droite et négatifs à gauche du sens de parcours, quel que
+ * soit le sens de la normale de l'élément (voir HorizontalAlignment::NormalSide). Le point et la
+ * normale de l'axe sont évalués une seule fois par station, puis chaque décalage est écrit dans son
+ * propre tableau contigu.
+ */
+class OffsetCurves {
+private:
+    const Alignment& _alignment;
+    std::vector<double> _offsets;
+    StationType _inputStationType;
+
+public:
+    /**
+     * @param offsets Décalages signés, positifs à droite.
+     * @throws std::runtime_error Si un décalage n'est pas fini.
+     */
+    OffsetCurves(const Alignment& alignment, std::vector<double> offsets);
+
+    std::size_t OffsetCount() const;
+    std::span<const double> Offsets() const;
+
+    /**
+     * @brief Nature des stations transmises à Points (internes par défaut) ; les stations externes sont
+     * converties bloc par bloc par les équations de station de l'axe.
+     */
+    StationType InputStationType() const;
+    void SetInputStationType(StationType type);
+
+    /**
+     * @brief Points des courbes décalées aux stations données, internes ou externes selon InputStationType.
+     *
+     * outputs contient un tableau par décalage, chacun de la taille de stations. Les stations triées
+     * sont le cas rapide ; des stations quelconques restent correctes.
+     * @throws std::runtime_error Si l'axe ne contient aucun élément, si les tailles des tableaux diffèrent
+     * ou si une station externe n'existe pas.
+     */
+    void Points(std::span<const double> stations, std::span<const std::span<Point2D>> outputs) const;
+    std::vector<std::vector<Point2D>> Points(std::span<const double> stations) const;
+
+    /**
+     * @brief Discrétisation de chaque courbe décalée avec sa propre flèche maximale.
+     *
+     * Sur un élément de courbure κ, la courbe décalée de d a pour rayon |1 + κd|/|κ| : le pas en
+     * station est choisi par élément et par décalage à partir de la courbure et de l'allongement de la
+     * courbe décalée, bornés à leurs valeurs extrêmes sur l'élément. Les décalages ayant le même nombre
+     * de segments sur un élément partagent l'évaluation de l'axe. Les sommets aux jonctions d'éléments
+     * ne sont pas dupliqués.
+     * @param maxThrows Flèche maximale de chaque décalage, dans l'ordre des décalages.
+     * @throws std::runtime_error Si l'axe ne contient aucun élément, si le nombre de flèches diffère du nombre
+     * de décalages, si une flèche n'est pas positive et finie, ou si un décalage atteint le centre de
+     * courbure d'un élément (courbe décalée avec point de rebroussement).
+     */
+    std::vector<std::vector<Point2D>> Tessellate(std::span<const double> maxThrows) const;
+    std::vector<std::vector<Point2D>> Tessellate(double maxThrow) const;
+};
+
+} // namespace LineaCore::Geometry::Alignments
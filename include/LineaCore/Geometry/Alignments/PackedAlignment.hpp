@@ -0,0 +1,216 @@
+// PackedAlignment.hpp
+#pragma once
+
+#include "Alignment.hpp"
+#include "LineaCore/Geometry/Point2D.hpp"
+#include "LineaCore/Geometry/Vector2D.hpp"
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace LineaCore::Geometry::Alignments {
+
+/**
+ * @brief Droite compactée : origine, vecteur directeur unitaire et longueur.
+ */
+struct PackedLine {
+    double StartX, StartY;
+    double DirectionX, DirectionY;
+    double Length;
+
+    Point2D Point(double s) const;
+    Vector2D Normal(double s) const;
+    double Curvature(double s) const;
+};
+
+/**
+ * @brief Arc de cercle compacté : centre, rayon absolu, sens (+1 anti-horaire, -1 horaire), angle de début et longueur.
+ */
+struct PackedArc {
+    double CenterX, CenterY;
+    double AbsRadius;
+    double Sens;
+    double StartAngle;
+    double Length;
+
+    Point2D Point(double s) const;
+    Vector2D Normal(double s) const;
+    double Curvature(double s) const;
+};
+
+/**
+ * @brief Clotoïde compactée : paramètre, abscisse de début, passage du repère local au repère global et longueur.
+ *
+ * L'angle du vecteur rotation est conservé pour éviter un atan2 à chaque évaluation de la normale
+ * (la structure occupe ainsi exactement 64 octets).
+ */
+struct PackedClothoid {
+    double A;
+    double StartAbscissa;
+    double RotationX, RotationY;
+    double RotationAngle;
+    double TranslationX, TranslationY;
+    double Length;
+
+    Point2D Point(double s) const;
+    Vector2D Normal(double s) const;
+    double Curvature(double s) const;
+};
+
+/**
+ * @brief Référence d'un élément de l'axe dans le tableau de son type.
+ */
+struct PackedElementRef {
+    enum class Kind : std::uint32_t {
+        Line,
+        Arc,
+        Clothoid
+    };
+
+    Kind ElementKind;
+    std::uint32_t Index;
+};
+
+/**
+ * @class PackedAlignmentView
+ * @brief Évaluation d'un axe compacté, sans fonction virtuelle, sur des tableaux qu'elle ne possède pas.
+ *
+ * Les éléments sont rangés par type dans des tableaux contigus de structures simples (PackedLine,
+ * PackedArc, PackedClothoid). Le tableau des références donne l'ordre des éléments le long de l'axe,
+ * le tableau des stations leurs stations de début suivies de la station de fin (taille n + 1).
+ * Les tableaux doivent survivre à la vue.
+ */
+class PackedAlignmentView {
+private:
+    std::span<const double> _stations;
+    std::span<const PackedElementRef> _elements;
+    std::span<const PackedLine> _lines;
+    std::span<const PackedArc> _arcs;
+    std::span<const PackedClothoid> _clothoids;
+
+    // Vue sur des tableaux cohérents par construction (PackedAlignment::View), sans contrôle
+    struct Unchecked {};
+    PackedAlignmentView(Unchecked, std::span<const double> stations, std::span<const PackedElementRef> elements,
+                        std::span<const PackedLine> lines, std::span<const PackedArc> arcs,
+                        std::span<const PackedClothoid> clothoids);
+
+    friend class PackedAlignment;
+
+public:
+    PackedAlignmentView() = default;
+
+    /**
+     * @throws std::runtime_error Si les tailles des tableaux sont incohérentes ou si une référence est hors limites.
+     */
+    PackedAlignmentView(std::span<const double> stations, std::span<const PackedElementRef> elements,
+                        std::span<const PackedLine> lines, std::span<const PackedArc> arcs,
+                        std::span<const PackedClothoid> clothoids);
+
+    // Propriétés
+    double StaStart() const;
+    double StaEnd() const;
+    double Length() const;
+
+    // Éléments
+    std::size_t ElementCount() const;
+    std::span<const double> Stations() const;
+    std::span<const PackedElementRef> Elements() const;
+    std::span<const PackedLine> Lines() const;
+    std::span<const PackedArc> Arcs() const;
+    std::span<const PackedClothoid> Clothoids() const;
+
+    /**
+     * @brief Retourne l'index de l'élément contenant une station (recherche dichotomique).
+     *
+     * Les stations hors de l'axe sont rattachées au premier ou au dernier élément.
+     * @throws std::runtime_error Si l'axe ne contient aucun élément.
+     */
+    std::size_t ElementIndex(double station) const;
+
+    /**
+     * @brief Applique un visiteur à l'élément d'index donné, avec sa structure typée.
+     *
+     * Le visiteur doit accepter const PackedLine&, const PackedArc& et const PackedClothoid&.
+     */
+    template <typename Visitor>
+    decltype(auto) Visit(std::size_t index, Visitor&& visitor) const {
+        const PackedElementRef& ref = _elements[index];
+        switch (ref.ElementKind) {
+        case PackedElementRef::Kind::Line:
+            return visitor(_lines[ref.Index]);
+        case PackedElementRef::Kind::Arc:
+            return visitor(_arcs[ref.Index]);
+        default:
+            return visitor(_clothoids[ref.Index]);
+        }
+    }
+
+    // Évaluation à une station (hors de l'axe, l'élément extrême est prolongé)
+    Point2D Point(double station) const;
+    Vector2D Normal(double station) const;
+    double Curvature(double station) const;
+
+    // Évaluation par lots. Les stations croissantes sont traitées par plages d'un même élément,
+    // sans recherche ; un ordre quelconque reste accepté.
+    void Point(std::span<const double> stations, std::span<Point2D> points) const;
+    void Normal(std::span<const double> stations, std::span<Vector2D> normals) const;
+    void Curvature(std::span<const double> stations, std::span<double> curvatures) const;
+};
+
+/**
+ * @class PackedAlignment
+ * @brief Axe en plan compacté : propriétaire des tableaux par type d'élément évalués par PackedAlignmentView.
+ *
+ * Représentation alternative à Alignment, qui alloue chaque élément séparément et passe par des
+ * appels virtuels. La conversion dans les deux sens est assurée par FromAlignment et ToAlignment.
+ */
+class PackedAlignment {
+private:
+    std::string _name;
+    std::vector<double> _stations;
+    std::vector<PackedElementRef> _elements;
+    std::vector<PackedLine> _lines;
+    std::vector<PackedArc> _arcs;
+    std::vector<PackedClothoid> _clothoids;
+
+public:
+    PackedAlignment();
+    PackedAlignment(std::string name, double staStart);
+
+    /**
+     * @brief Compacte un axe.
+     * @throws std::runtime_error Si un élément n'est ni une droite, ni un arc, ni une clotoïde.
+     */
+    static PackedAlignment FromAlignment(const Alignment& alignment);
+
+    /**
+     * @brief Reconstruit un axe composé d'éléments HorizontalAlignment.
+     */
+    Alignment ToAlignment() const;
+
+    // Ajout d'éléments en fin d'axe
+
+    /**
+     * @brief Compacte et ajoute un élément HorizontalAlignment.
+     * @throws std::runtime_error Si l'élément n'est ni une droite, ni un arc, ni une clotoïde.
+     */
+    void AddElement(const Horizontal::HorizontalAlignment& element);
+    void AddLine(const PackedLine& line);
+    void AddArc(const PackedArc& arc);
+    void AddClothoid(const PackedClothoid& clothoid);
+
+    const std::string& Name() const;
+
+    /**
+     * @brief Vue d'évaluation sur les tableaux de l'axe, en O(1) : les ajouts maintiennent leur cohérence.
+     */
+    PackedAlignmentView View() const;
+
+    /**
+     * @brief Mémoire occupée par les tableaux de l'axe, en octets.
+     */
+    std::size_t MemoryUsage() const;
+};
+
+} // namespace LineaCore::Geometry::Alignments
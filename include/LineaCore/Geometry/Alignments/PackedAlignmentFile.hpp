@@ -0,0 +1,84 @@
+// PackedAlignmentFile.hpp
+#pragma once
+
+#include "PackedAlignment.hpp"
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace LineaCore::Geometry::Alignments {
+
+/**
+ * @class PackedAlignmentFile
+ * @brief Cache binaire d'axes compactés, projeté en mémoire (mmap) et utilisé sans désérialisation.
+ *
+ * Le fichier contient, après un en-tête versionné (signature, version, marqueur d'ordre des octets,
+ * empreinte FNV-1a du fichier LandXML source), un répertoire des axes puis, pour chaque axe, son nom
+ * et les tableaux de PackedAlignment (stations, références, droites, arcs, clotoïdes) alignés sur
+ * 8 octets. Les vues retournées pointent directement dans la projection du fichier : les paramètres
+ * résolus des éléments (clotoïdes notamment) ne sont pas recalculés.
+ *
+ * Le format suppose des doubles IEEE 754 ; un fichier écrit sur une machine d'ordre d'octets
+ * différent est refusé.
+ */
+class PackedAlignmentFile {
+private:
+    struct Mapping;
+
+    std::unique_ptr<Mapping> _mapping;
+    std::uint64_t _sourceHash;
+    std::vector<std::string_view> _names;
+    std::vector<PackedAlignmentView> _views;
+
+public:
+    static constexpr std::uint32_t FormatVersion = 1;
+
+    /**
+     * @brief Projette un fichier cache en mémoire et vérifie sa structure.
+     * @throws std::runtime_error Si le fichier ne peut être ouvert, n'est pas un cache d'axes, est d'une
+     * autre version ou d'un autre ordre d'octets, ou est tronqué.
+     */
+    explicit PackedAlignmentFile(const std::string& fileName);
+
+    PackedAlignmentFile(PackedAlignmentFile&&) noexcept;
+    PackedAlignmentFile& operator=(PackedAlignmentFile&&) noexcept;
+    ~PackedAlignmentFile();
+
+    /**
+     * @brief Ouvre un fichier cache s'il existe, est valide et correspond à la source attendue.
+     * @return false si le cache est absent, invalide ou périmé.
+     */
+    static bool TryOpen(const std::string& fileName, std::uint64_t expectedSourceHash, std::unique_ptr<PackedAlignmentFile>& file);
+
+    /**
+     * @brief Écrit un fichier cache.
+     *
+     * Le contenu est écrit dans un fichier temporaire de nom unique, renommé en fileName une fois complet ;
+     * le fichier temporaire est supprimé en cas d'échec.
+     * @throws std::runtime_error Si le fichier ne peut être écrit.
+     */
+    static void Write(const std::string& fileName, std::span<const PackedAlignment> alignments, std::uint64_t sourceHash);
+
+    /**
+     * @brief Empreinte FNV-1a 64 bits du contenu d'un fichier.
+     * @throws std::runtime_error Si le fichier ne peut être lu.
+     */
+    static std::uint64_t HashFile(const std::string& fileName);
+
+    /**
+     * @brief Ouvre le cache d'un fichier LandXML, en le reconstruisant s'il est absent ou périmé.
+     * @param rebuilt Optionnel : indique si le cache a été reconstruit.
+     * @throws std::runtime_error En cas d'erreur de lecture du LandXML ou d'écriture du cache.
+     */
+    static PackedAlignmentFile LoadOrBuild(const std::string& landXmlFileName, const std::string& cacheFileName, bool* rebuilt = nullptr);
+
+    std::uint64_t SourceHash() const;
+    std::size_t AlignmentCount() const;
+    std::string_view Name(std::size_t index) const;
+    const PackedAlignmentView& View(std::size_t index) const;
+};
+
+} // namespace LineaCore::Geometry::Alignments
@@ -0,0 +1,80 @@
+// SegmentIntersector.hpp
+#pragma once
+
+#include "Alignment.hpp"
+#include "UniformGrid.hpp"
+#include "LineaCore/Geometry/BoundingBox.hpp"
+#include "LineaCore/Geometry/Point2D.hpp"
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace LineaCore::Geometry::Alignments {
+
+/**
+ * @brief Croisement d'un axe avec un segment externe.
+ */
+struct SegmentCrossing {
+    double Station;          ///< Station du croisement sur l'axe
+    Point2D Point;
+    std::size_t Polyline;    ///< Index de la polyligne (ou du segment isolé)
+    std::size_t Segment;     ///< Index du segment dans sa polyligne
+    double Parameter;        ///< Position sur le segment, de 0 (début) à 1 (fin)
+    double Angle;            ///< Angle orienté de la tangente de l'axe vers la direction du segment, dans [-π, π]
+};
+
+/**
+ * @class SegmentIntersector
+ * @brief Croisements d'axes avec de grands ensembles de segments (réseaux, limites, voiries existantes).
+ *
+ * Les segments sont indexés une fois dans une grille régulière. Pour chaque élément de l'axe, la boîte
+ * englobante exacte de l'élément (HorizontalAlignment::Bounds) sélectionne les segments candidats, qui
+ * sont intersectés exactement avec l'élément :
+ * - droite : GeometryUtils::IntersectionStraightStraight ;
+ * - arc : racines de l'équation du second degré droite–cercle, restreintes au secteur de l'arc ;
+ * - clotoïde : changements de signe de la distance signée à la droite du segment des sommets d'une
+ *   discrétisation de flèche maxThrow, affinés par la méthode de Newton protégée par dichotomie.
+ *
+ * Un croisement situé sur un sommet commun à deux segments d'une polyligne, ou à la jonction de
+ * deux éléments, n'est reporté qu'une fois. Les contacts tangents sans traversée ne sont pas reportés
+ * pour les clotoïdes.
+ */
+class SegmentIntersector {
+private:
+    std::vector<Point2D> _starts;
+    std::vector<Point2D> _ends;
+    std::vector<std::uint32_t> _polylines;       // Polyligne de chaque segment
+    std::vector<std::uint32_t> _firstSegments;   // Premier segment de chaque polyligne, plus le nombre total
+
+    // Grille régulière : pour chaque cellule, liste des segments dont la boîte la recouvre
+    std::vector<BoundingBox> _segmentBounds;
+    UniformGrid _grid;
+
+    void BuildGrid();
+    void IntersectElement(const Alignment& alignment, std::size_t element, double maxThrow, std::vector<SegmentCrossing>& crossings) const;
+
+public:
+    /**
+     * @brief Segments isolés : le segment i joint starts[i] à ends[i] et forme la polyligne i.
+     * @throws std::runtime_error Si les tableaux n'ont pas la même taille.
+     */
+    SegmentIntersector(std::span<const Point2D> starts, std::span<const Point2D> ends);
+
+    /**
+     * @brief Polylignes : segments entre sommets consécutifs.
+     */
+    explicit SegmentIntersector(std::span<const std::vector<Point2D>> polylines);
+
+    std::size_t SegmentCount() const;
+    std::size_t PolylineCount() const;
+
+    /**
+     * @brief Croisements d'un axe avec les segments, triés par station.
+     * @param maxThrow Flèche de la discrétisation des clotoïdes servant à isoler les croisements.
+     * @param threadCount Nombre de threads ; 0 pour utiliser tous les cœurs disponibles.
+     * @throws std::runtime_error Si maxThrow n'est pas strictement positif et fini.
+     */
+    std::vector<SegmentCrossing> Intersect(const Alignment& alignment, double maxThrow = 0.01, unsigned threadCount = 0) const;
+};
+
+} // namespace LineaCore::Geometry::Alignments
@@ -0,0 +1,111 @@
+// StationEquationTable.hpp
+#pragma once
+
+#include <libxml/xmlreader.h> // Pour xmlTextReaderPtr
+#include <libxml/xmlwriter.h> // Pour xmlTextWriterPtr
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace LineaCore::Geometry::Alignments {
+
+/**
+ * @brief Équation de station (<StaEquation>) : à la station interne StaInternal, la station externe
+ * passe de StaBack à StaAhead.
+ */
+struct StationEquation {
+    double StaInternal;
+    double StaBack;
+    double StaAhead;
+};
+
+/**
+ * @brief Nature des stations transmises aux requêtes par station : internes (longueur développée depuis
+ * staStart) ou externes (chaînage affiché, converti par InternalStations).
+ */
+enum class StationType { Internal, External };
+
+/**
+ * @class StationEquationTable
+ * @brief Conversion entre stations internes (longueur développée depuis staStart) et stations
+ * externes (chaînage affiché), définie par les équations de station d'un axe.
+ *
+ * Les équations découpent l'axe en zones ; dans la zone k (après la k-ième équation), la station
+ * externe vaut la station interne plus un décalage constant. Avant la première équation, les deux
+ * stations sont égales. À la station interne d'une équation, la station externe est StaAhead.
+ *
+ * Une station externe située dans un saut vers l'avant (entre la fin d'une zone et StaAhead) n'existe
+ * pas. Lorsqu'une équation fait reculer le chaînage, une station externe peut exister dans plusieurs
+ * zones : la première zone dans l'ordre de l'axe est retenue.
+ *
+ * Les conversions unitaires sont en O(log n). Les conversions par lots conservent la zone de la
+ * station précédente et ne la recherchent qu'à son changement : O(1) par station pour des stations triées.
+ *
+ * Alignment::Point, Normal et Curvature, AlignmentSampler et OffsetCurves::Points acceptent des
+ * stations externes (StationType::External), converties par cette table avant l'évaluation ; les lots
+ * passent par le curseur de zone d'InternalStations. Les profils en long et les tables de dévers ne
+ * prennent que des stations internes.
+ */
+class StationEquationTable {
+private:
+    std::vector<StationEquation> _equations;
+    std::vector<double> _internalStations;   // Station interne de chaque équation (triées)
+    std::vector<double> _offsets;            // Décalage externe - interne de chaque zone (taille n + 1)
+    std::vector<double> _zoneStarts;         // Station externe de début de chaque zone (taille n + 1, -inf pour la première)
+    std::vector<double> _zoneEnds;           // Station externe de fin de chaque zone (taille n + 1, +inf pour la dernière)
+    bool _increasing;                        // Aucune zone ne chevauche la suivante en stations externes
+
+    std::size_t ExternalZone(double externalStation) const;
+
+public:
+    StationEquationTable();
+
+    /**
+     * @brief Construit la table à partir d'équations dans un ordre quelconque, triées par station interne.
+     * @throws std::runtime_error Si deux équations ont la même station interne, ou si une station interne
+     * n'est pas finie.
+     */
+    explicit StationEquationTable(std::vector<StationEquation> equations);
+
+    std::size_t EquationCount() const;
+    std::span<const StationEquation> Equations() const;   // Par station interne croissante
+
+    /**
+     * @brief Écart entre StaBack d'une équation et la station externe atteinte à sa station interne par
+     * la zone précédente. Les conversions utilisent la station interne et StaAhead : StaBack n'est
+     * qu'un contrôle de cohérence du document (voir ContinuityValidator).
+     */
+    double StaBackDeviation(std::size_t index) const;
+
+    /**
+     * @brief Indique si le chaînage externe est croissant le long de l'axe (aucune équation ne le fait reculer).
+     */
+    bool IsIncreasing() const;
+
+    /**
+     * @brief Index de la zone contenant une station interne (0 avant la première équation).
+     */
+    std::size_t Zone(double internalStation) const;
+
+    double ExternalStation(double internalStation) const;
+
+    /**
+     * @throws std::runtime_error Si la station externe n'existe pas (saut d'une équation).
+     */
+    double InternalStation(double externalStation) const;
+
+    /**
+     * @brief Conversions par lots.
+     * @throws std::runtime_error Si les tailles des tableaux diffèrent, ou comme InternalStation.
+     */
+    void ExternalStations(std::span<const double> internalStations, std::span<double> externalStations) const;
+    void InternalStations(std::span<const double> externalStations, std::span<double> internalStations) const;
+
+    /**
+     * @brief Lit une équation (<StaEquation>) sur laquelle le lecteur est positionné.
+     */
+    static StationEquation ReadEquation(xmlTextReaderPtr reader);
+    static void WriteEquation(xmlTextWriterPtr writer, const StationEquation& equation);
+};
+
+} // namespace LineaCore::Geometry::Alignments
@@ -0,0 +1,126 @@
+// TessellationCache.hpp
+#pragma once
+
+#include "Alignment.hpp"
+#include "Horizontal/HorizontalAlignment.hpp"
+#include "LineaCore/Geometry/Point2D.hpp"
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace LineaCore::Geometry::Alignments {
+
+/**
+ * @class TessellationCache
+ * @brief Cache partagé entre threads des discrétisations d'éléments.
+ *
+ * Les flèches demandées sont ramenées à des niveaux de détail en progression géométrique :
+ * le niveau k correspond à la flèche baseThrow·2^k, et une demande de flèche f est servie par
+ * le plus grand niveau dont la flèche ne dépasse pas f. Les éléments sont discrétisés par
+ * HorizontalAlignment::Points. Les entrées sont indexées par (élément, niveau) et évincées dans
+ * l'ordre de dernière utilisation lorsque la mémoire occupée dépasse le budget.
+ *
+ * Les éléments sont identifiés par leur adresse : un élément modifié ou détruit doit être retiré
+ * par Invalidate avant qu'une autre instance ne puisse réutiliser son adresse.
+ */
+class TessellationCache {
+public:
+    using Polyline = std::shared_ptr<const std::vector<Point2D>>;
+
+    struct Statistics {
+        std::uint64_t Hits;
+        std::uint64_t Misses;
+        std::uint64_t Evictions;
+        std::size_t Entries;
+        std::size_t Bytes;
+    };
+
+private:
+    struct Key {
+        const Horizontal::HorizontalAlignment* Element;
+        int Level;
+
+        bool operator==(const Key& other) const = default;
+    };
+
+    struct KeyHash {
+        std::size_t operator()(const Key& key) const;
+    };
+
+    struct Entry {
+        Key EntryKey;
+        Polyline Points;
+        std::size_t Bytes;
+    };
+
+    const std::size_t _byteBudget;
+    const double _baseThrow;
+
+    mutable std::mutex _mutex;
+    std::list<Entry> _entries;   // Du plus récemment utilisé au plus ancien
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> _index;
+    std::size_t _bytes;
+
+    std::atomic<std::uint64_t> _hits;
+    std::atomic<std::uint64_t> _misses;
+    std::atomic<std::uint64_t> _evictions;
+
+    Polyline Find(const Key& key);
+    Polyline Insert(const Key& key, Polyline points);
+    void EvictOverBudget();
+
+public:
+    static constexpr std::size_t DefaultByteBudget = 64u << 20;
+    static constexpr double DefaultBaseThrow = 1E-3;
+
+    /**
+     * @param byteBudget Mémoire maximale occupée par les discrétisations conservées, en octets.
+     * @param baseThrow Flèche du niveau de détail 0.
+     * @throws std::runtime_error Si baseThrow n'est pas positif.
+     */
+    explicit TessellationCache(std::size_t byteBudget = DefaultByteBudget, double baseThrow = DefaultBaseThrow);
+
+    TessellationCache(const TessellationCache&) = delete;
+    TessellationCache& operator=(const TessellationCache&) = delete;
+
+    /**
+     * @brief Niveau de détail servant une flèche maximale donnée.
+     * @throws std::runtime_error Si maxThrow n'est pas positif.
+     */
+    int Level(double maxThrow) const;
+
+    /**
+     * @brief Flèche effective d'un niveau de détail.
+     */
+    double LevelThrow(int level) const;
+
+    /**
+     * @brief Discrétisation d'un élément avec une flèche au plus égale à maxThrow.
+     *
+     * Le tableau retourné est partagé et immuable ; il reste valide après son éviction du cache.
+     * @throws std::runtime_error Si maxThrow n'est pas positif.
+     */
+    Polyline Points(const Horizontal::HorizontalAlignment& element, double maxThrow);
+
+    /**
+     * @brief Calcule à l'avance les niveaux de détail couvrant les flèches de minThrow à maxThrow.
+     * @throws std::runtime_error Si les flèches ne sont pas positives.
+     */
+    void Warm(const Horizontal::HorizontalAlignment& element, double minThrow, double maxThrow);
+    void Warm(const Alignment& alignment, double minThrow, double maxThrow);
+
+    /**
+     * @brief Retire toutes les discrétisations d'un élément.
+     */
+    void Invalidate(const Horizontal::HorizontalAlignment& element);
+
+    void Clear();
+
+    Statistics GetStatistics() const;
+};
+
+} // namespace LineaCore::Geometry::Alignments
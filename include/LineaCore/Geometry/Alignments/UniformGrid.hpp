@@ -0,0 +1,103 @@
+// UniformGrid.hpp
+#pragma once
+
+#include "LineaCore/Geometry/BoundingBox.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace LineaCore::Geometry::Alignments {
+
+/**
+ * @class VisitStamps
+ * @brief Marquage des objets déjà examinés au cours d'une requête spatiale.
+ *
+ * Un compteur de requête remplace la remise à zéro des marques entre deux requêtes ; les marques ne
+ * sont effacées que lorsque le compteur revient à zéro. Une instance par thread (thread_local) suffit
+ * pour toutes les grilles du thread, le compteur étant commun.
+ */
+class VisitStamps {
+private:
+    std::vector<std::uint32_t> _stamps;
+    std::uint32_t _stamp = 0;
+
+public:
+    /**
+     * @brief Commence une requête portant sur des objets d'index inférieur à itemCount.
+     */
+    void NextQuery(std::size_t itemCount);
+
+    /**
+     * @brief Marque un objet ; retourne false s'il l'était déjà pour la requête courante.
+     */
+    bool Visit(std::uint32_t item);
+};
+
+/**
+ * @class UniformGrid
+ * @brief Grille régulière indexant des boîtes englobantes : chaque cellule liste les boîtes qui la recouvrent.
+ *
+ * Les listes sont rangées en stockage compressé par ligne. La taille des cellules est choisie pour
+ * obtenir en moyenne cellsPerBox cellules par boîte sur l'étendue des boîtes, dans la limite d'un
+ * nombre total de cellules borné.
+ */
+class UniformGrid {
+public:
+    /**
+     * @brief Plage de cellules [FirstColumn, LastColumn] × [FirstRow, LastRow], bornes comprises.
+     */
+    struct CellRange {
+        std::size_t FirstColumn, LastColumn;
+        std::size_t FirstRow, LastRow;
+    };
+
+private:
+    std::size_t _itemCount;
+    double _minX, _minY, _cellSize;
+    std::size_t _columns, _rows;
+    std::vector<std::uint32_t> _cellStarts;
+    std::vector<std::uint32_t> _cellItems;
+
+public:
+    /**
+     * @brief Grille vide (une cellule, aucune boîte).
+     */
+    UniformGrid();
+
+    /**
+     * @brief Indexe les boîtes ; l'index d'une boîte dans boxes est son identifiant.
+     */
+    UniformGrid(std::span<const BoundingBox> boxes, std::size_t cellsPerBox);
+
+    std::size_t ItemCount() const;
+    double MinX() const;
+    double MinY() const;
+    double CellSize() const;
+    std::size_t Columns() const;
+    std::size_t Rows() const;
+
+    /**
+     * @brief Étendue couverte par les cellules.
+     */
+    BoundingBox Bounds() const;
+
+    /**
+     * @brief Cellules recouvertes par une boîte, ramenées dans la grille.
+     */
+    CellRange Range(const BoundingBox& box) const;
+
+    /**
+     * @brief Identifiants des boîtes recouvrant une cellule.
+     */
+    std::span<const std::uint32_t> CellItems(std::size_t column, std::size_t row) const;
+
+    /**
+     * @brief Remplace items par les identifiants, sans doublon, des boîtes rangées dans les cellules
+     * recouvertes par box (candidats : leurs boîtes ne recoupent pas nécessairement box).
+     * @param visited Marquage utilisé pour écarter les doublons ; une nouvelle requête y est commencée.
+     */
+    void Candidates(const BoundingBox& box, VisitStamps& visited, std::vector<std::uint32_t>& items) const;
+};
+
+} // namespace LineaCore::Geometry::Alignments
@@ -0,0 +1,114 @@
+// VerticalAlignment.hpp
+#pragma once
+
+#include "LineaCore/LandXML/LandXMLSerializable.hpp"
+#include <cstddef>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace LineaCore::Geometry::Alignments::Vertical {
+
+/**
+ * @brief Point d'intersection des pentes (<PVI>, <ParaCurve> ou <CircCurve> de <ProfAlign>).
+ */
+struct VerticalPVI {
+    enum class CurveType {
+        None,       ///< <PVI> : changement de pente sans raccordement
+        Parabola,   ///< <ParaCurve> : raccordement parabolique symétrique
+        Circle      ///< <CircCurve> : raccordement circulaire
+    };
+
+    double Station;
+    double Elevation;
+    CurveType Curve = CurveType::None;
+    double Length = 0.0;   ///< Longueur horizontale du raccordement (recalculée pour un cercle à partir du rayon et des pentes)
+    double Radius = 0.0;   ///< Rayon du raccordement circulaire (valeur absolue)
+};
+
+/**
+ * @class VerticalAlignment
+ * @brief Profil en long (<ProfAlign>) : altitude, pente et courbure verticale à une station.
+ *
+ * Les PVI sont convertis à la construction en une suite de tronçons contigus : alignements droits
+ * et paraboles, évalués sous forme polynomiale z = A + B·t + C·t² (t mesuré depuis le début du
+ * tronçon), et arcs de cercle tangents aux deux pentes. Les bornes des tronçons sont stockées dans
+ * un tableau trié parcouru par dichotomie (O(log n)) ; l'évaluation par lots réutilise le tronçon
+ * précédent lorsque les stations sont croissantes.
+ *
+ * Hors du profil, les pentes extrêmes sont prolongées.
+ */
+class VerticalAlignment : public LandXML::LandXMLSerializable {
+private:
+    struct Segment {
+        bool IsCircle;
+        double A, B, C;   // Polynôme : z = A + B·t + C·t² ; cercle : station et altitude du centre, rayon signé (> 0 en point bas)
+
+        double Elevation(double start, double station) const;
+        double Grade(double start, double station) const;
+        double Curvature(double start, double station) const;
+    };
+
+    std::string _name;
+    std::vector<VerticalPVI> _pvis;
+    std::vector<double> _stations;     // Station de début de chaque tronçon, suivie de la station de fin (taille n + 1)
+    std::vector<Segment> _segments;
+
+    void BuildSegments();
+
+    template <typename SegmentFunction>
+    void EvaluateBatch(std::span<const double> stations, std::span<double> values, SegmentFunction evaluate) const;
+
+public:
+    VerticalAlignment();
+
+    /**
+     * @throws std::runtime_error Si le profil a moins de deux PVI, si les stations ne sont pas
+     * croissantes, si un raccordement est placé sur un PVI extrême ou si deux raccordements se chevauchent.
+     */
+    VerticalAlignment(std::string name, std::vector<VerticalPVI> pvis);
+
+    // Propriétés
+    const std::string& Name() const;
+    double StaStart() const;
+    double StaEnd() const;
+    std::span<const VerticalPVI> PVIs() const;
+
+    // Tronçons (alignements droits et raccordements)
+    std::size_t SegmentCount() const;
+    std::span<const double> SegmentStations() const;
+
+    /**
+     * @brief Retourne l'index du tronçon contenant une station (le premier ou le dernier hors du profil).
+     */
+    std::size_t SegmentIndex(double station) const;
+
+    // Évaluation à une station
+    double Elevation(double station) const;
+    double Grade(double station) const;
+
+    /**
+     * @brief Courbure du profil dans le plan vertical, positive en point bas (concavité vers le haut).
+     */
+    double VerticalCurvature(double station) const;
+
+    /**
+     * @brief Évaluation par lots ; les stations croissantes sont les plus rapides.
+     * @throws std::runtime_error Si les tailles des tableaux diffèrent.
+     */
+    void Elevation(std::span<const double> stations, std::span<double> elevations) const;
+    void Grade(std::span<const double> stations, std::span<double> grades) const;
+    void VerticalCurvature(std::span<const double> stations, std::span<double> curvatures) const;
+
+    /**
+     * @brief Altitudes et pentes par lots, en un seul parcours des tronçons.
+     * @throws std::runtime_error Si les tailles des tableaux diffèrent.
+     */
+    void Evaluate(std::span<const double> stations, std::span<double> elevations, std::span<double> grades) const;
+
+    // Sérialisation
+    void ReadLandXML(xmlTextReaderPtr reader) override;
+    void WriteLandXML(xmlTextWriterPtr writer) const override;
+};
+
+} // namespace LineaCore::Geometry::Alignments::Vertical
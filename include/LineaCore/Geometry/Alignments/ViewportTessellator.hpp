@@ -0,0 +1,49 @@
+// ViewportTessellator.hpp
+#pragma once
+
+#include "Alignment.hpp"
+#include "BoundsTree.hpp"
+#include "LineaCore/Geometry/BoundingBox.hpp"
+#include <vector>
+
+namespace LineaCore::Geometry::Alignments {
+
+/**
+ * @class ViewportTessellator
+ * @brief Discrétisation d'un axe limitée à une fenêtre d'affichage, à la précision du pixel.
+ *
+ * La flèche maximale est déduite de la taille du pixel. Les éléments recouvrant la fenêtre sont
+ * sélectionnés par la hiérarchie des boîtes exactes (BoundsTree). Chaque élément est découpé en
+ * segments de même longueur en station, le pas étant tiré de sa courbure maximale ; les plages de
+ * segments hors de la fenêtre sont écartées par subdivision, un tronçon de longueur ℓ étant contenu
+ * dans le disque de rayon ℓ/2 centré en son milieu. Seuls les sommets des tronçons visibles sont
+ * évalués : le coût dépend de la partie visible de l'axe, et non de sa longueur.
+ *
+ * Les sommets sont pris sur une grille fixe de chaque élément : un déplacement de la fenêtre à
+ * échelle constante ne modifie pas les sommets déjà visibles. Les polylignes sont découpées
+ * exactement au bord de la fenêtre.
+ *
+ * L'objet référence l'axe, qui doit lui survivre et ne pas être modifié.
+ */
+class ViewportTessellator {
+private:
+    const Alignment* _alignment;
+    BoundsTree _tree;
+
+public:
+    explicit ViewportTessellator(const Alignment& alignment);
+
+    const Alignment& GetAlignment() const;
+
+    /**
+     * @brief Polylignes de l'axe visibles dans une fenêtre, dans le sens de l'axe.
+     * @param window Fenêtre en coordonnées du plan.
+     * @param pixelSize Taille d'un pixel en unités du plan.
+     * @param pixelTolerance Flèche maximale en pixels.
+     * @throws std::runtime_error Si la fenêtre est vide ou si pixelSize ou pixelTolerance n'est pas
+     * strictement positif et fini.
+     */
+    std::vector<std::vector<Point2D>> Tessellate(const BoundingBox& window, double pixelSize, double pixelTolerance = 0.5) const;
+};
+
+} // namespace LineaCore::Geometry::Alignments
@@ -0,0 +1,76 @@
+// BoundingBox.hpp
+#pragma once
+
+#include "Point2D.hpp"
+
+namespace LineaCore::Geometry {
+
+/**
+ * @class BoundingBox
+ * @brief Boîte englobante alignée sur les axes.
+ *
+ * Une boîte construite par défaut est vide (bornes inversées infinies) : l'étendre par un point ou
+ * une autre boîte donne exactement la boîte de ce point ou de cette boîte.
+ */
+class BoundingBox {
+public:
+    double MinX; ///< Abscisse minimale
+    double MinY; ///< Ordonnée minimale
+    double MaxX; ///< Abscisse maximale
+    double MaxY; ///< Ordonnée maximale
+
+    /**
+     * @brief Constructeur par défaut : boîte vide.
+     */
+    BoundingBox();
+
+    /**
+     * @brief Constructeur à partir des bornes.
+     */
+    BoundingBox(double minX, double minY, double maxX, double maxY);
+
+    /**
+     * @brief Vérifie si la boîte est vide (ne contient aucun point).
+     */
+    bool IsEmpty() const;
+
+    double Width() const;
+    double Height() const;
+
+    /**
+     * @brief Étend la boîte pour qu'elle contienne un point.
+     */
+    void Extend(const Point2D& p);
+
+    /**
+     * @brief Étend la boîte pour qu'elle contienne une autre boîte.
+     */
+    void Extend(const BoundingBox& box);
+
+    /**
+     * @brief Retourne la boîte élargie d'une marge dans toutes les directions.
+     */
+    BoundingBox Inflated(double margin) const;
+
+    /**
+     * @brief Vérifie si deux boîtes ont au moins un point commun (bords compris).
+     */
+    bool Intersects(const BoundingBox& box) const;
+
+    /**
+     * @brief Vérifie si un point est dans la boîte (bords compris).
+     */
+    bool Contains(const Point2D& p) const;
+
+    /**
+     * @brief Distance d'un point à la boîte (nulle à l'intérieur).
+     */
+    double Distance(const Point2D& p) const;
+
+    /**
+     * @brief Distance entre deux boîtes (nulle si elles se recouvrent).
+     */
+    double Distance(const BoundingBox& box) const;
+};
+
+} // namespace LineaCore::Geometry
@@ -0,0 +1,64 @@
+// LandXMLAlignmentLoader.hpp
+#pragma once
+
+#include "LineaCore/Geometry/Alignments/Alignment.hpp"
+#include <libxml/xmlreader.h> // Pour xmlTextReaderPtr
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace LineaCore::LandXML {
+
+/**
+ * @brief Plage d'octets [Begin, End) d'un élément <Alignment> dans un document, et sa ligne de début.
+ */
+struct AlignmentRange {
+    std::size_t Begin;
+    std::size_t End;
+    int Line;
+};
+
+/**
+ * @class LandXMLAlignmentLoader
+ * @brief Chargement de tous les axes (<Alignment>) d'un document LandXML, éventuellement en parallèle.
+ *
+ * Le chargement parallèle repère d'abord les plages d'octets des éléments <Alignment> par un
+ * balayage rapide du document (commentaires, CDATA et instructions de traitement sont ignorés),
+ * puis lit chaque plage avec son propre lecteur libxml2 sur le tampon partagé. Les axes sont
+ * retournés dans l'ordre du document et sont identiques à ceux d'une lecture séquentielle.
+ *
+ * Seuls les éléments <Alignment> sont analysés en mode parallèle : une erreur de syntaxe en dehors
+ * des axes n'est pas détectée. Les documents que le balayage ne sait pas découper (DOCTYPE, UTF-16,
+ * axes préfixés par un espace de noms, balises non équilibrées) sont lus séquentiellement.
+ */
+class LandXMLAlignmentLoader {
+public:
+    /**
+     * @brief Lecture séquentielle de tous les axes à partir d'un lecteur.
+     * @throws std::runtime_error En cas d'erreur de syntaxe XML ou d'élément invalide.
+     */
+    static std::vector<Geometry::Alignments::Alignment> Read(xmlTextReaderPtr reader);
+
+    /**
+     * @brief Lit tous les axes d'un document en mémoire.
+     * @param threadCount Nombre de threads (0 : nombre de cœurs, 1 : lecture séquentielle).
+     * @throws std::runtime_error Comme Read, ou si le texte transmis au lecteur XML dépasse INT_MAX octets ;
+     * en cas d'erreurs dans plusieurs axes, celle du premier axe est levée.
+     */
+    static std::vector<Geometry::Alignments::Alignment> ReadMemory(std::string_view document, unsigned threadCount = 0);
+
+    /**
+     * @brief Lit tous les axes d'un fichier LandXML.
+     * @throws std::runtime_error Si le fichier ne peut être lu, ou comme ReadMemory.
+     */
+    static std::vector<Geometry::Alignments::Alignment> ReadFile(const std::string& fileName, unsigned threadCount = 0);
+
+    /**
+     * @brief Repère les plages des éléments <Alignment> d'un document et son encodage déclaré.
+     * @return false si le document ne peut être découpé de façon sûre.
+     */
+    static bool TryFindAlignmentRanges(std::string_view document, std::vector<AlignmentRange>& ranges, std::string& encoding);
+};
+
+} // namespace LineaCore::LandXML
@@ -0,0 +1,123 @@
+// LandXMLStreamReader.hpp
+#pragma once
+
+#include "LineaCore/Geometry/Alignments/Horizontal/HorizontalAlignment.hpp"
+#include <libxml/xmlreader.h> // Pour xmlTextReaderPtr
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace LineaCore::LandXML {
+
+/**
+ * @brief Attributs d'un <Alignment> en cours de lecture.
+ */
+struct StreamedAlignment {
+    std::string Name;
+    double StaStart;
+    double DeclaredLength;   ///< Attribut 'length' du fichier, NaN s'il est absent
+    std::size_t Index;       ///< Rang de l'axe dans le document
+};
+
+/**
+ * @brief Élément de <CoordGeom> lu par le lecteur en flux.
+ */
+struct StreamedElement {
+    std::shared_ptr<const StreamedAlignment> Alignment;
+    std::size_t ElementIndex;   ///< Rang de l'élément dans son axe
+    double Station;             ///< Station de début de l'élément (staStart + longueurs cumulées)
+    std::unique_ptr<Geometry::Alignments::Horizontal::HorizontalAlignment> Element;
+};
+
+/**
+ * @class StreamedElementQueue
+ * @brief File bornée entre un thread de lecture et un consommateur.
+ *
+ * Le producteur est bloqué tant que la file est pleine, ce qui borne la mémoire utilisée quelle
+ * que soit la taille du document. Une erreur du producteur est transmise au consommateur par Pop.
+ */
+class StreamedElementQueue {
+private:
+    const std::size_t _capacity;
+    std::mutex _mutex;
+    std::condition_variable _notFull;
+    std::condition_variable _notEmpty;
+    std::deque<StreamedElement> _elements;
+    bool _closed;
+    bool _cancelled;
+    std::exception_ptr _error;
+
+public:
+    /**
+     * @throws std::runtime_error Si la capacité est nulle.
+     */
+    explicit StreamedElementQueue(std::size_t capacity);
+
+    /**
+     * @brief Ajoute un élément, en attendant une place libre.
+     * @return false si le consommateur a abandonné la lecture (Cancel) ; l'élément est alors ignoré.
+     */
+    bool Push(StreamedElement&& element);
+
+    /**
+     * @brief Retire le prochain élément, en attendant qu'il soit disponible.
+     * @return false lorsque la file est fermée et vide.
+     * @throws L'exception levée par le producteur, une fois les éléments précédents consommés.
+     */
+    bool Pop(StreamedElement& element);
+
+    /**
+     * @brief Signale la fin de la production, éventuellement en erreur.
+     */
+    void Close(std::exception_ptr error = nullptr);
+
+    /**
+     * @brief Abandon par le consommateur : vide la file et débloque le producteur.
+     */
+    void Cancel();
+};
+
+/**
+ * @class LandXMLStreamReader
+ * @brief Lecture en flux des axes d'un document LandXML.
+ *
+ * Le document est parcouru nœud par nœud ; chaque élément de <Alignments>/<Alignment>/<CoordGeom>
+ * est transmis dès la lecture de sa balise fermante, sans conserver le modèle complet en mémoire.
+ * Les éléments non géométriques (profils, dévers, etc.) sont ignorés.
+ */
+class LandXMLStreamReader {
+public:
+    struct Callbacks {
+        std::function<void(const StreamedAlignment&)> AlignmentBegin;   ///< Optionnel
+        std::function<void(StreamedElement&&)> Element;
+        std::function<void(const StreamedAlignment&)> AlignmentEnd;     ///< Optionnel
+    };
+
+    /**
+     * @brief Parcourt un document à partir d'un lecteur positionné avant sa racine ou sur un nœud quelconque.
+     * @throws std::runtime_error En cas d'erreur de syntaxe XML ou d'élément invalide.
+     */
+    static void Read(xmlTextReaderPtr reader, const Callbacks& callbacks);
+
+    /**
+     * @brief Parcourt un fichier LandXML.
+     * @throws std::runtime_error Si le fichier ne peut être ouvert, ou comme Read.
+     */
+    static void ReadFile(const std::string& fileName, const Callbacks& callbacks);
+
+    /**
+     * @brief Lit un fichier dans un thread dédié qui alimente une file bornée.
+     *
+     * La file est fermée en fin de lecture, avec l'erreur éventuelle. Le thread retourné doit être
+     * joint par l'appelant.
+     */
+    static std::thread ReadFileAsync(const std::string& fileName, StreamedElementQueue& queue);
+};
+
+} // namespace LineaCore::LandXML
@@ -2,7 +2,9 @@
 #pragma once
 
 #include <libxml/xmlreader.h> // Pour xmlTextReaderPtr
+#include <span>
 #include <string>
+#include <string_view>
 #include "LineaCore/Geometry/Point2D.hpp"
 
 namespace LineaCore::LandXML {
@@ -15,15 +17,30 @@ public:
     // Read an attribute as a double, allowing NaN if absent
     // static double ReadAttributeAsNaNableDouble(const std::string& attributeValue);
 
+    // Read an optional attribute as a double, returning NaN if absent or empty
+    static double ReadOptionalAttributeAsDouble(xmlTextReaderPtr reader, const char* attributeName);
+
     // Read an attribute as a string
     static std::string ReadAttributeAsString(xmlTextReaderPtr reader, const char* attributeName);
 
-    // Read the content of an element as a Point2D
+    // Read an optional attribute as a string, returning defaultValue if absent
+    static std::string ReadOptionalAttributeAsString(xmlTextReaderPtr reader, const char* attributeName, const std::string& defaultValue = std::string());
+
+    // Read the content of an element as a Point2D ("Northing Easting [...]").
+    // The reader is moved to the text node holding the content (or to the end tag if there is none).
     static Geometry::Point2D ReadContentAsPoint2D(xmlTextReaderPtr reader, const std::string& elementName);
 
+    // Read the content of an element as exactly values.size() numbers, in document order.
+    // The reader is moved as by ReadContentAsPoint2D.
+    static void ReadContentAsNumbers(xmlTextReaderPtr reader, const std::string& elementName, std::span<double> values);
+
+    // Parse a number starting at first (leading whitespace allowed), without allocation and
+    // independently of the locale. Returns the end of the number, or nullptr if none was found.
+    static const char* ParseNumber(const char* first, const char* last, double& value);
+
 private:
-    // Parse a string as a double with error checking
-    static double ParseAsDouble(const std::string& value, const std::string& elementName, const std::string& attributeName);
+    // Parse a whole string as a double with error checking
+    static double ParseAsDouble(std::string_view value, std::string_view elementName, std::string_view attributeName);
 };
 
 } // namespace LineaCore::LandXML
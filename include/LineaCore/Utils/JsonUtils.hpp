@@ -0,0 +1,18 @@
+// JsonUtils.hpp
+#pragma once
+
+#include <string>
+
+namespace LineaCore::Utils {
+
+// Écriture de valeurs JSON pour les rapports (LineaCoreValidate, LineaCoreBench)
+class JsonUtils {
+public:
+    // Chaîne entre guillemets ; les guillemets, barres obliques inverses et caractères de contrôle sont échappés
+    static std::string String(const std::string& text);
+
+    // Nombre au format %.<precision>g, indépendant de la locale ; null pour une valeur non finie
+    static std::string Number(double value, int precision = 12);
+};
+
+} // namespace LineaCore::Utils
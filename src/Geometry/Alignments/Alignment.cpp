@@ -0,0 +1,565 @@
+// Alignment.cpp
+
+#include "LineaCore/Geometry/Alignments/Alignment.hpp"
+#include "LineaCore/Geometry/Alignments/BatchUtils.hpp"
+#include "LineaCore/Geometry/Alignments/Horizontal/StraightAlignment.hpp"
+#include "LineaCore/Geometry/Alignments/Horizontal/CurvedAlignment.hpp"
+#include "LineaCore/Geometry/Alignments/Horizontal/ClotoideTransition.hpp"
+#include "LineaCore/LandXML/XMLUtils.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace LineaCore::Geometry::Alignments {
+
+using namespace Horizontal;
+
+namespace {
+
+constexpr std::size_t BucketsPerElement = 2;   // Nombre de seaux par élément de l'axe
+constexpr std::uint32_t LinearScanLimit = 8;   // Au-delà, recherche dichotomique dans le seau
+constexpr std::size_t MinPointsPerThread = 4096; // Discrétisation : nombre minimal de sommets par thread
+
+} // namespace
+
+Alignment::Alignment()
+    : Alignment(std::string(), 0.0) {}
+
+Alignment::Alignment(std::string name, double staStart)
+    : _name(std::move(name)), _staStart(staStart), _stations(1, staStart), _bucketScale(0.0), _indexedCount(0),
+      _declaredLength(std::numeric_limits<double>::quiet_NaN()) {
+    BuildStationIndex();
+}
+
+const std::string& Alignment::Name() const {
+    return _name;
+}
+
+double Alignment::StaStart() const {
+    return _staStart;
+}
+
+double Alignment::StaEnd() const {
+    return _stations.back();
+}
+
+double Alignment::Length() const {
+    return _stations.back() - _staStart;
+}
+
+std::size_t Alignment::ElementCount() const {
+    return _elements.size();
+}
+
+const HorizontalAlignment& Alignment::Element(std::size_t index) const {
+    return *_elements.at(index);
+}
+
+double Alignment::ElementStation(std::size_t index) const {
+    return _stations.at(index);
+}
+
+std::span<const double> Alignment::Stations() const {
+    return _stations;
+}
+
+void Alignment::AddElement(std::unique_ptr<HorizontalAlignment> element) {
+    if (!element) {
+        throw std::runtime_error("Cannot add a null element to Alignment '" + _name + "'");
+    }
+    _stations.push_back(_stations.back() + element->Length());
+    _elements.push_back(std::move(element));
+    if (!_approximants.empty()) {
+        _approximants.emplace_back();
+    }
+    if (!_declaredLengths.empty()) {
+        _declaredLengths.push_back(std::numeric_limits<double>::quiet_NaN());
+        _declaredStations.push_back(std::numeric_limits<double>::quiet_NaN());
+    }
+    // Seaux prolongés à la même échelle pour couvrir le nouvel élément ; reconstruction complète,
+    // qui rétablit la densité des seaux, lorsque le nombre d'éléments a doublé
+    if (_elements.size() >= 2 * _indexedCount || !AppendStationBuckets()) {
+        BuildStationIndex();
+    }
+}
+
+double Alignment::DeclaredLength() const {
+    return _declaredLength;
+}
+
+double Alignment::DeclaredElementLength(std::size_t index) const {
+    return index < _declaredLengths.size() ? _declaredLengths[index] : std::numeric_limits<double>::quiet_NaN();
+}
+
+double Alignment::DeclaredElementStation(std::size_t index) const {
+    return index < _declaredStations.size() ? _declaredStations[index] : std::numeric_limits<double>::quiet_NaN();
+}
+
+void Alignment::BuildStationIndex() {
+    const std::size_t n = _elements.size();
+    const double length = Length();
+    const std::size_t bucketCount = std::max<std::size_t>(1, n * BucketsPerElement);
+    _indexedCount = n;
+
+    _bucketScale = length > 0.0 ? bucketCount / length : 0.0;
+    _buckets.assign(bucketCount + 1, 0);
+    if (n == 0) {
+        return;
+    }
+
+    // Balayage unique : pour chaque début de seau, dernier élément dont la station de début le précède
+    std::uint32_t index = 0;
+    for (std::size_t b = 0; b < bucketCount; ++b) {
+        const double bucketStation = _staStart + (_bucketScale > 0.0 ? b / _bucketScale : 0.0);
+        while (index + 1 < n && _stations[index + 1] <= bucketStation) {
+            ++index;
+        }
+        _buckets[b] = index;
+    }
+    _buckets[bucketCount] = static_cast<std::uint32_t>(n - 1);
+}
+
+bool Alignment::AppendStationBuckets() {
+    const std::size_t n = _elements.size();
+    const double needed = std::ceil((_stations.back() - _staStart) * _bucketScale);
+    // Échelle nulle ou élément bien plus long que les précédents : reconstruction
+    if (!(_bucketScale > 0.0) || !(needed <= static_cast<double>(2 * BucketsPerElement * n))) {
+        return false;
+    }
+
+    // Le dernier seau, sentinelle, est remplacé par les seaux couvrant le nouvel élément
+    _buckets.pop_back();
+    std::uint32_t index = _buckets.empty() ? 0 : _buckets.back();
+    for (std::size_t b = _buckets.size(); b < static_cast<std::size_t>(needed); ++b) {
+        const double bucketStation = _staStart + b / _bucketScale;
+        while (index + 1 < n && _stations[index + 1] <= bucketStation) {
+            ++index;
+        }
+        _buckets.push_back(index);
+    }
+    _buckets.push_back(static_cast<std::uint32_t>(n - 1));
+    return true;
+}
+
+std::size_t Alignment::ElementIndex(double station) const {
+    const std::size_t n = _elements.size();
+    if (n == 0) {
+        throw std::runtime_error("Alignment '" + _name + "' has no element");
+    }
+    const double position = (station - _staStart) * _bucketScale;
+    if (!(position >= 0.0)) {
+        return 0;
+    }
+    const std::size_t bucketCount = _buckets.size() - 1;
+    if (position >= static_cast<double>(bucketCount)) {
+        return n - 1;
+    }
+
+    const std::size_t bucket = static_cast<std::size_t>(position);
+    std::size_t first = _buckets[bucket];
+    std::size_t last = _buckets[bucket + 1];
+    std::size_t index = first;
+
+    if (last - first <= LinearScanLimit) {
+        while (index < last && _stations[index + 1] <= station) {
+            ++index;
+        }
+    } else {
+        auto it = std::upper_bound(_stations.begin() + first + 1, _stations.begin() + last + 1, station);
+        index = static_cast<std::size_t>(it - _stations.begin()) - 1;
+    }
+
+    // Correction des cas limites dus à l'arrondi de la position dans le seau
+    while (index > 0 && _stations[index] > station) {
+        --index;
+    }
+    while (index + 1 < n && _stations[index + 1] <= station) {
+        ++index;
+    }
+    return index;
+}
+
+void Alignment::ForEachElementRun(std::span<const double> stations,
+                                  const std::function<void(std::size_t element, std::size_t first, std::size_t count)>& function) const {
+    if (stations.empty()) {
+        return;
+    }
+    const std::size_t last = _elements.size() - 1;
+    auto inElement = [&](std::size_t index, double station) {
+        return (index == 0 || station >= _stations[index]) && (index == last || station < _stations[index + 1]);
+    };
+    std::size_t i = ElementIndex(stations[0]);
+    for (std::size_t first = 0; first < stations.size();) {
+        if (!inElement(i, stations[first])) {
+            i = ElementIndex(stations[first]);
+        }
+        std::size_t end = first + 1;
+        while (end < stations.size() && inElement(i, stations[end])) {
+            ++end;
+        }
+        function(i, first, end - first);
+        first = end;
+    }
+}
+
+bool Alignment::TryEnableApproximants(double tolerance) {
+    std::vector<std::unique_ptr<ClotoideApproximant>> approximants(_elements.size());
+    for (std::size_t i = 0; i < _elements.size(); ++i) {
+        // Les clotoïdes de longueur nulle, présentes dans certains exports, restent évaluées exactement
+        const auto* clotoide = dynamic_cast<const ClotoideTransition*>(_elements[i].get());
+        if (clotoide == nullptr || !(clotoide->Length() > 0.0)) {
+            continue;
+        }
+        approximants[i] = std::make_unique<ClotoideApproximant>();
+        if (!ClotoideApproximant::TryBuild(*clotoide, tolerance, *approximants[i])) {
+            return false;
+        }
+    }
+    _approximants = std::move(approximants);
+    return true;
+}
+
+void Alignment::DisableApproximants() {
+    _approximants.clear();
+}
+
+bool Alignment::ApproximantsEnabled() const {
+    return !_approximants.empty();
+}
+
+const StationEquationTable& Alignment::StationEquations() const {
+    return _stationEquations;
+}
+
+void Alignment::SetStationEquations(StationEquationTable stationEquations) {
+    _stationEquations = std::move(stationEquations);
+}
+
+double Alignment::ExternalStation(double internalStation) const {
+    return _stationEquations.ExternalStation(internalStation);
+}
+
+double Alignment::InternalStation(double externalStation) const {
+    return _stationEquations.InternalStation(externalStation);
+}
+
+const ClotoideApproximant* Alignment::Approximant(std::size_t index) const {
+    if (index >= _elements.size()) {
+        throw std::out_of_range("Element index out of range");
+    }
+    return _approximants.empty() ? nullptr : _approximants[index].get();
+}
+
+void Alignment::ElementPoints(std::size_t index, std::span<const double> s, std::span<Point2D> points) const {
+    if (const ClotoideApproximant* approximant = Approximant(index)) {
+        approximant->Point(s, points);
+    } else {
+        _elements[index]->Point(s, points);
+    }
+}
+
+void Alignment::ElementPoints(std::size_t index, std::span<const double> s, std::span<Point2D> points, std::span<Vector2D> normals) const {
+    if (const ClotoideApproximant* approximant = Approximant(index)) {
+        approximant->Point(s, points);
+        approximant->Normal(s, normals);
+    } else {
+        _elements[index]->Point(s, points);
+        _elements[index]->Normal(s, normals);
+    }
+}
+
+std::size_t Alignment::ProfileCount() const {
+    return _profiles.size();
+}
+
+const Vertical::VerticalAlignment& Alignment::Profile(std::size_t index) const {
+    return _profiles.at(index);
+}
+
+void Alignment::AddProfile(Vertical::VerticalAlignment profile) {
+    _profiles.push_back(std::move(profile));
+}
+
+std::size_t Alignment::CantCount() const {
+    return _cants.size();
+}
+
+const CantTable& Alignment::Cant(std::size_t index) const {
+    return _cants.at(index);
+}
+
+void Alignment::AddCant(CantTable cant) {
+    _cants.push_back(std::move(cant));
+}
+
+Point2D Alignment::Point(double station) const {
+    const std::size_t i = ElementIndex(station);
+    if (!_approximants.empty() && _approximants[i]) {
+        return _approximants[i]->Point(station - _stations[i]);
+    }
+    return _elements[i]->Point(station - _stations[i]);
+}
+
+Vector2D Alignment::Normal(double station) const {
+    const std::size_t i = ElementIndex(station);
+    if (!_approximants.empty() && _approximants[i]) {
+        return _approximants[i]->Normal(station - _stations[i]);
+    }
+    return _elements[i]->Normal(station - _stations[i]);
+}
+
+double Alignment::Curvature(double station) const {
+    const std::size_t i = ElementIndex(station);
+    return _elements[i]->Curvature(station - _stations[i]);
+}
+
+Point2D Alignment::Point(double station, StationType type) const {
+    return Point(type == StationType::External ? _stationEquations.InternalStation(station) : station);
+}
+
+Vector2D Alignment::Normal(double station, StationType type) const {
+    return Normal(type == StationType::External ? _stationEquations.InternalStation(station) : station);
+}
+
+double Alignment::Curvature(double station, StationType type) const {
+    return Curvature(type == StationType::External ? _stationEquations.InternalStation(station) : station);
+}
+
+std::vector<double> Alignment::FixedStepStations(double step) const {
+    if (!(step > 0.0)) {
+        throw std::runtime_error("Sampling step must be strictly positive");
+    }
+    const double staEnd = StaEnd();
+    // Stations calculées sans cumul du pas ; la dernière est StaEnd
+    const std::size_t intervalCount = static_cast<std::size_t>(std::ceil((staEnd - _staStart) / step - 1e-9));
+    std::vector<double> stations(intervalCount + 1);
+    for (std::size_t k = 0; k < intervalCount; ++k) {
+        stations[k] = _staStart + step * static_cast<double>(k);
+    }
+    stations[intervalCount] = staEnd;
+    return stations;
+}
+
+std::size_t Alignment::PointCount(double maxThrow) const {
+    HorizontalAlignment::CheckMaxThrow(maxThrow);
+    if (_elements.empty()) {
+        return 0;
+    }
+    std::size_t count = 1;
+    for (const auto& element : _elements) {
+        count += element->PointCount(maxThrow) - 1;
+    }
+    return count;
+}
+
+void Alignment::Points(double maxThrow, std::span<Point2D> points, unsigned threadCount) const {
+    HorizontalAlignment::CheckMaxThrow(maxThrow);
+    // Première passe : position du premier sommet de chaque élément
+    const std::size_t n = _elements.size();
+    std::vector<std::size_t> offsets(n + 1, 0);
+    for (std::size_t i = 0; i < n; ++i) {
+        offsets[i + 1] = offsets[i] + _elements[i]->PointCount(maxThrow) - 1;
+    }
+    const std::size_t total = n == 0 ? 0 : offsets[n] + 1;
+    if (points.size() != total) {
+        throw std::runtime_error("Tessellation output size (" + std::to_string(points.size()) +
+                                 ") does not match the point count (" + std::to_string(total) + ") of Alignment '" + _name + "'");
+    }
+    if (n == 0) {
+        return;
+    }
+
+    auto writeElement = [&](std::size_t i) {
+        _elements[i]->Points(maxThrow, points.subspan(offsets[i], offsets[i + 1] - offsets[i] + 1));
+    };
+
+    threadCount = static_cast<unsigned>(std::min<std::size_t>({BatchUtils::ThreadCount(threadCount), n, std::max<std::size_t>(1, total / MinPointsPerThread)}));
+    if (threadCount <= 1) {
+        for (std::size_t i = 0; i < n; ++i) {
+            writeElement(i);
+        }
+        return;
+    }
+
+    // Découpage en plages d'éléments de nombres de sommets équilibrés
+    std::vector<std::size_t> firsts;
+    for (unsigned t = 0; t < threadCount; ++t) {
+        const std::size_t target = total * t / threadCount;
+        const std::size_t first = static_cast<std::size_t>(std::upper_bound(offsets.begin(), offsets.begin() + n, target) - offsets.begin()) - 1;
+        if (firsts.empty() || first > firsts.back()) {
+            firsts.push_back(first);
+        }
+    }
+    firsts.push_back(n);
+    const std::size_t chunkCount = firsts.size() - 1;
+
+    // Seconde passe en parallèle. Le dernier élément de chaque plage (sauf la dernière) partage son
+    // sommet final avec le premier élément de la plage suivante : il est écrit ensuite, séquentiellement.
+    BatchUtils::ParallelFor(chunkCount, static_cast<unsigned>(chunkCount), [&](std::size_t t) {
+        const std::size_t last = t + 1 == chunkCount ? firsts[t + 1] : firsts[t + 1] - 1;
+        for (std::size_t i = firsts[t]; i < last; ++i) {
+            writeElement(i);
+        }
+    });
+
+    for (std::size_t t = 0; t + 1 < chunkCount; ++t) {
+        const std::size_t i = firsts[t + 1] - 1;
+        const Point2D junction = points[offsets[i + 1]];   // Début de l'élément suivant, déjà écrit
+        writeElement(i);
+        points[offsets[i + 1]] = junction;
+    }
+}
+
+std::vector<Point2D> Alignment::Points(double maxThrow, unsigned threadCount) const {
+    std::vector<Point2D> points(PointCount(maxThrow));
+    Points(maxThrow, points, threadCount);
+    return points;
+}
+
+std::unique_ptr<HorizontalAlignment> Alignment::ReadElement(xmlTextReaderPtr reader) {
+    const char* nodeName = reinterpret_cast<const char*>(xmlTextReaderConstLocalName(reader));
+    if (nodeName == nullptr) {
+        return nullptr;
+    }
+
+    if (std::strcmp(nodeName, "Line") == 0) {
+        auto line = std::make_unique<StraightAlignment>();
+        line->ReadLandXML(reader);
+        return line;
+    }
+    if (std::strcmp(nodeName, "Curve") == 0) {
+        auto curve = std::make_unique<CurvedAlignment>();
+        curve->ReadLandXML(reader);
+        return curve;
+    }
+    if (std::strcmp(nodeName, "Spiral") == 0) {
+        auto spiral = std::make_unique<ClotoideTransition>();
+        spiral->ReadLandXML(reader);
+        return spiral;
+    }
+    return nullptr;
+}
+
+void Alignment::ReadLandXML(xmlTextReaderPtr reader) {
+    _name = LandXML::XMLUtils::ReadAttributeAsString(reader, "name");
+    _staStart = LandXML::XMLUtils::ReadAttributeAsDouble(reader, "staStart");
+    _declaredLength = LandXML::XMLUtils::ReadOptionalAttributeAsDouble(reader, "length");
+    _declaredLengths.clear();
+    _declaredStations.clear();
+    _elements.clear();
+    _approximants.clear();
+    _profiles.clear();
+    _cants.clear();
+    _stationEquations = StationEquationTable();
+    _stations.assign(1, _staStart);
+
+    if (xmlTextReaderIsEmptyElement(reader)) {
+        BuildStationIndex();
+        return;
+    }
+
+    // Les clotoïdes sont résolues ensemble en fin de lecture (résolution par lots)
+    std::vector<std::size_t> spiralIndices;
+    std::vector<ClotoideFitInput> spiralInputs;
+    std::vector<StationEquation> stationEquations;
+
+    int coordGeomDepth = -1;
+    while (xmlTextReaderRead(reader) == 1) {
+        const int nodeType = xmlTextReaderNodeType(reader);
+        if (nodeType == XML_READER_TYPE_ELEMENT) {
+            const char* nodeName = reinterpret_cast<const char*>(xmlTextReaderConstLocalName(reader));
+            const int depth = xmlTextReaderDepth(reader);
+            if (std::strcmp(nodeName, "ProfAlign") == 0) {
+                Vertical::VerticalAlignment profile;
+                profile.ReadLandXML(reader);
+                _profiles.push_back(std::move(profile));
+            } else if (std::strcmp(nodeName, "StaEquation") == 0) {
+                stationEquations.push_back(StationEquationTable::ReadEquation(reader));
+            } else if (std::strcmp(nodeName, "Cant") == 0) {
+                CantTable cant;
+                cant.ReadLandXML(reader);
+                _cants.push_back(std::move(cant));
+            } else if (std::strcmp(nodeName, "CoordGeom") == 0) {
+                coordGeomDepth = xmlTextReaderIsEmptyElement(reader) ? -1 : depth;
+            } else if (coordGeomDepth >= 0 && depth == coordGeomDepth + 1 && std::strcmp(nodeName, "Spiral") == 0) {
+                _declaredLengths.push_back(LandXML::XMLUtils::ReadOptionalAttributeAsDouble(reader, "length"));
+                _declaredStations.push_back(LandXML::XMLUtils::ReadOptionalAttributeAsDouble(reader, "staStart"));
+                spiralInputs.push_back(ClotoideTransition::ReadFitInput(reader));
+                spiralIndices.push_back(_elements.size());
+                _elements.push_back(std::make_unique<ClotoideTransition>());
+            } else if (coordGeomDepth >= 0 && depth == coordGeomDepth + 1) {
+                // Attributs lus avant l'élément, dont la lecture déplace le lecteur sur ses enfants
+                const double declaredLength = LandXML::XMLUtils::ReadOptionalAttributeAsDouble(reader, "length");
+                const double declaredStation = LandXML::XMLUtils::ReadOptionalAttributeAsDouble(reader, "staStart");
+                auto element = ReadElement(reader);
+                if (element) {
+                    _declaredLengths.push_back(declaredLength);
+                    _declaredStations.push_back(declaredStation);
+                    _elements.push_back(std::move(element));
+                } else if (std::strcmp(nodeName, "IrregularLine") == 0 || std::strcmp(nodeName, "Chain") == 0) {
+                    throw std::runtime_error("Unsupported element <" + std::string(nodeName) + "> in <CoordGeom> of Alignment '" + _name + "'");
+                }
+            }
+        } else if (nodeType == XML_READER_TYPE_END_ELEMENT) {
+            const char* nodeName = reinterpret_cast<const char*>(xmlTextReaderConstLocalName(reader));
+            if (std::strcmp(nodeName, "CoordGeom") == 0) {
+                coordGeomDepth = -1;
+            } else if (std::strcmp(nodeName, "Alignment") == 0) {
+                break;
+            }
+        }
+    }
+
+    _stationEquations = StationEquationTable(std::move(stationEquations));
+
+    std::vector<ClotoideTransition> spirals(spiralInputs.size());
+    if (!ClotoideTransition::TryFromVectorAndCurvatures(spiralInputs, spirals)) {
+        throw std::runtime_error("Clothoid Spiral could not be defined from the given values in Element <Spiral>");
+    }
+    for (std::size_t i = 0; i < spirals.size(); ++i) {
+        *static_cast<ClotoideTransition*>(_elements[spiralIndices[i]].get()) = std::move(spirals[i]);
+    }
+    for (const auto& element : _elements) {
+        _stations.push_back(_stations.back() + element->Length());
+    }
+
+    BuildStationIndex();
+}
+
+void Alignment::WriteLandXML(xmlTextWriterPtr writer) const {
+    xmlTextWriterStartElement(writer, BAD_CAST "Alignment");
+    xmlTextWriterWriteAttribute(writer, BAD_CAST "name", BAD_CAST _name.c_str());
+    xmlTextWriterWriteFormatAttribute(writer, BAD_CAST "length", "%.15g", Length());
+    xmlTextWriterWriteFormatAttribute(writer, BAD_CAST "staStart", "%.15g", _staStart);
+
+    xmlTextWriterStartElement(writer, BAD_CAST "CoordGeom");
+    for (const auto& element : _elements) {
+        auto serializable = dynamic_cast<const LandXML::LandXMLSerializable*>(element.get());
+        if (serializable == nullptr) {
+            throw std::runtime_error("Element of Alignment '" + _name + "' cannot be written to LandXML");
+        }
+        serializable->WriteLandXML(writer);
+    }
+    xmlTextWriterEndElement(writer);
+
+    for (const StationEquation& equation : _stationEquations.Equations()) {
+        StationEquationTable::WriteEquation(writer, equation);
+    }
+    if (!_profiles.empty()) {
+        xmlTextWriterStartElement(writer, BAD_CAST "Profile");
+        for (const Vertical::VerticalAlignment& profile : _profiles) {
+            profile.WriteLandXML(writer);
+        }
+        xmlTextWriterEndElement(writer);
+    }
+    for (const CantTable& cant : _cants) {
+        cant.WriteLandXML(writer);
+    }
+
+    xmlTextWriterEndElement(writer);
+}
+
+} // namespace LineaCore::Geometry::Alignments
@@ -0,0 +1,367 @@
+// AlignmentClearance.cpp
+
+#include "LineaCore/Geometry/Alignments/AlignmentClearance.hpp"
+#include "LineaCore/Geometry/Alignments/BatchUtils.hpp"
+#include "LineaCore/Geometry/Alignments/Horizontal/CurvedAlignment.hpp"
+#include "LineaCore/Geometry/Alignments/Horizontal/StraightAlignment.hpp"
+#include "LineaCore/Geometry/GeometryUtils.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace LineaCore::Geometry::Alignments {
+
+using namespace Horizontal;
+
+namespace {
+
+constexpr double Infinity = std::numeric_limits<double>::infinity();
+constexpr double SeedThrow = 0.05;                 // Flèche de l'échantillonnage d'amorce des clotoïdes
+constexpr std::size_t MinSeedSamples = 8;
+constexpr std::size_t MaxSeedSamples = 256;
+constexpr std::size_t MaxSeeds = 8;                // Minima locaux affinés par paire d'éléments
+constexpr std::size_t MaxNewtonIterations = 50;
+
+// Échantillons d'un élément, servant à amorcer les projections sur les clotoïdes
+struct Samples {
+    std::vector<double> Abscissas;
+    std::vector<Point2D> Points;
+
+    explicit Samples(const HorizontalAlignment& element) {
+        if (element.Type() != HorizontalAlignment::H_Type::Transition) {
+            return; // Projection exacte sans amorce
+        }
+        const std::size_t count = std::clamp(element.ChordSegmentCount(SeedThrow), MinSeedSamples, MaxSeedSamples);
+        Abscissas.resize(count + 1);
+        Points.resize(count + 1);
+        HorizontalAlignment::UniformAbscissas(element.Length(), Abscissas);
+        element.Point(Abscissas, Points);
+    }
+
+    // Projection sur l'élément, amorcée par l'échantillon le plus proche
+    double Project(const HorizontalAlignment& element, const Point2D& point) const {
+        double seed = 0.0;
+        double nearest = Infinity;
+        for (std::size_t k = 0; k < Points.size(); ++k) {
+            const Vector2D d = Points[k] - point;
+            if (d * d < nearest) {
+                nearest = d * d;
+                seed = Abscissas[k];
+            }
+        }
+        return element.Projection(point, seed);
+    }
+};
+
+// Point, tangente et dérivée de la tangente d'un élément
+void Frame(const HorizontalAlignment& element, double s, Point2D& point, Vector2D& tangent, Vector2D& tangentDerivative) {
+    point = element.Point(s);
+    tangent = element.Normal(s).Rotated90CounterClockWise() * element.NormalSide();
+    tangentDerivative = tangent.Rotated90CounterClockWise() * element.Curvature(s);
+}
+
+// Résolution exacte de la distance minimale entre deux éléments
+class PairSolver {
+private:
+    const HorizontalAlignment& _a;
+    const HorizontalAlignment& _b;
+    const Samples _samplesA;
+    const Samples _samplesB;
+
+    void Evaluate(double sA, double sB) {
+        const double distance = (_a.Point(sA) - _b.Point(sB)).Length();
+        if (distance < Distance) {
+            Distance = distance;
+            AbscissaA = sA;
+            AbscissaB = sB;
+        }
+    }
+
+    // Point proche du premier élément : projeté sur celui-ci, puis sur le second
+    void FromA(const Point2D& point) {
+        const double sA = _samplesA.Project(_a, point);
+        Evaluate(sA, _samplesB.Project(_b, _a.Point(sA)));
+    }
+
+    void FromB(const Point2D& point) {
+        const double sB = _samplesB.Project(_b, point);
+        Evaluate(_samplesA.Project(_a, _b.Point(sB)), sB);
+    }
+
+    // Droite et cercle : points de normale commune (à ±R du centre, perpendiculairement à la droite) et intersections
+    void LineCircle(const StraightAlignment& line, const CurvedAlignment& arc, bool lineIsA) {
+        const Point2D& origin = line.getStartingPoint();
+        const Vector2D& u = line.Direction();
+        const Point2D& centre = arc.CenterPoint();
+        const double radius = std::fabs(arc.SignedRadius());
+        auto onLine = [&](const Point2D& p) { lineIsA ? FromA(p) : FromB(p); };
+        auto onArc = [&](const Point2D& p) { lineIsA ? FromB(p) : FromA(p); };
+
+        const Vector2D n = u.Rotated90CounterClockWise();
+        onArc(centre + n * radius);
+        onArc(centre + n * -radius);
+
+        const Vector2D w = origin - centre;
+        const double b = w * u;
+        const double discriminant = b * b - (w * w - radius * radius);
+        if (discriminant >= 0.0) {
+            const double root = std::sqrt(discriminant);
+            onLine(origin + u * (-b - root));
+            onLine(origin + u * (-b + root));
+        }
+    }
+
+    // Deux cercles : points de la ligne des centres et intersections
+    void CircleCircle(const CurvedAlignment& arcA, const CurvedAlignment& arcB) {
+        const Point2D& centreA = arcA.CenterPoint();
+        const double radiusA = std::fabs(arcA.SignedRadius());
+        const double radiusB = std::fabs(arcB.SignedRadius());
+        const Vector2D between = arcB.CenterPoint() - centreA;
+        const double d = between.Length();
+        if (d == 0.0) {
+            return; // Arcs concentriques : distance constante, atteinte aux extrémités
+        }
+        const Vector2D u = between / d;
+        FromA(centreA + u * radiusA);
+        FromA(centreA + u * -radiusA);
+
+        const double along = (d * d + radiusA * radiusA - radiusB * radiusB) / (2.0 * d);
+        const double across2 = radiusA * radiusA - along * along;
+        if (across2 >= 0.0) {
+            const Vector2D v = u.Rotated90CounterClockWise() * std::sqrt(across2);
+            FromA(centreA + u * along + v);
+            FromA(centreA + u * along - v);
+        }
+    }
+
+    // Méthode de Newton sur (sA, sB) pour le demi-carré de la distance, avec recherche linéaire et abscisses bornées
+    void Refine(double sA, double sB) {
+        const double lengthA = _a.Length();
+        const double lengthB = _b.Length();
+        auto squared = [&](double u, double v) {
+            const Vector2D d = _a.Point(u) - _b.Point(v);
+            return d * d;
+        };
+        double h = squared(sA, sB);
+        for (std::size_t iteration = 0; iteration < MaxNewtonIterations; ++iteration) {
+            Point2D pa, pb;
+            Vector2D ta, tb, ka, kb;
+            Frame(_a, sA, pa, ta, ka);
+            Frame(_b, sB, pb, tb, kb);
+            const Vector2D d = pa - pb;
+            const double ga = d * ta;
+            const double gb = -(d * tb);
+            const double haa = 1.0 + d * ka;
+            const double hbb = 1.0 - d * kb;
+            const double hab = -(ta * tb);
+            const double det = haa * hbb - hab * hab;
+            double da = -ga;
+            double db = -gb;
+            if (haa > 0.0 && det > 0.0) {
+                da = -(hbb * ga - hab * gb) / det;
+                db = -(haa * gb - hab * ga) / det;
+            }
+
+            bool improved = false;
+            double u = sA, v = sB, hNext = h;
+            for (double factor = 1.0; factor > 1e-12; factor /= 2.0) {
+                u = std::clamp(sA + factor * da, 0.0, lengthA);
+                v = std::clamp(sB + factor * db, 0.0, lengthB);
+                hNext = squared(u, v);
+                if (hNext < h) {
+                    improved = true;
+                    break;
+                }
+            }
+            if (!improved) {
+                break;
+            }
+            const double step = std::fabs(u - sA) + std::fabs(v - sB);
+            sA = u;
+            sB = v;
+            h = hNext;
+            if (step <= 1e-12 * (1.0 + lengthA + lengthB)) {
+                break;
+            }
+        }
+        Evaluate(sA, sB);
+    }
+
+    // Clotoïdes : minima locaux de la distance des échantillons du premier élément au second, puis affinage
+    void RefineFromSamples() {
+        std::vector<double> abscissas = _samplesA.Abscissas;
+        if (abscissas.empty()) {
+            // Premier élément droit ou circulaire : autant d'échantillons que la clotoïde
+            const std::size_t count = std::max(MinSeedSamples, _samplesB.Abscissas.size());
+            abscissas.resize(count + 1);
+            for (std::size_t k = 0; k <= count; ++k) {
+                abscissas[k] = _a.Length() * static_cast<double>(k) / static_cast<double>(count);
+            }
+        }
+        const std::size_t n = abscissas.size();
+        std::vector<double> projections(n);
+        std::vector<double> distances(n);
+        for (std::size_t k = 0; k < n; ++k) {
+            const Point2D p = _a.Point(abscissas[k]);
+            projections[k] = _samplesB.Project(_b, p);
+            distances[k] = (p - _b.Point(projections[k])).Length();
+        }
+        std::vector<std::pair<double, std::size_t>> seeds;
+        for (std::size_t k = 0; k < n; ++k) {
+            if ((k == 0 || distances[k] <= distances[k - 1]) && (k + 1 == n || distances[k] < distances[k + 1])) {
+                seeds.emplace_back(distances[k], k);
+            }
+        }
+        std::sort(seeds.begin(), seeds.end());
+        seeds.resize(std::min(seeds.size(), MaxSeeds));
+        for (const auto& [distance, k] : seeds) {
+            Refine(abscissas[k], projections[k]);
+        }
+    }
+
+public:
+    double Distance = Infinity;
+    double AbscissaA = 0.0;
+    double AbscissaB = 0.0;
+
+    PairSolver(const HorizontalAlignment& a, const HorizontalAlignment& b) : _a(a), _b(b), _samplesA(a), _samplesB(b) {}
+
+    void Solve() {
+        // Minima aux extrémités
+        FromA(_a.getStartingPoint());
+        FromA(_a.getEndingPoint());
+        FromB(_b.getStartingPoint());
+        FromB(_b.getEndingPoint());
+
+        // Minima intérieurs aux deux éléments
+        const auto* lineA = dynamic_cast<const StraightAlignment*>(&_a);
+        const auto* lineB = dynamic_cast<const StraightAlignment*>(&_b);
+        const auto* arcA = dynamic_cast<const CurvedAlignment*>(&_a);
+        const auto* arcB = dynamic_cast<const CurvedAlignment*>(&_b);
+        if (lineA != nullptr && lineB != nullptr) {
+            // Deux segments : seule une intersection peut donner un minimum intérieur
+            const Point2D crossing = GeometryUtils::IntersectionStraightStraight(lineA->getStartingPoint(), lineA->Direction(),
+                                                                                 lineB->getStartingPoint(), lineB->Direction());
+            if (!std::isnan(crossing.X)) {
+                FromA(crossing);
+            }
+        } else if (lineA != nullptr && arcB != nullptr) {
+            LineCircle(*lineA, *arcB, true);
+        } else if (arcA != nullptr && lineB != nullptr) {
+            LineCircle(*lineB, *arcA, false);
+        } else if (arcA != nullptr && arcB != nullptr) {
+            CircleCircle(*arcA, *arcB);
+        } else {
+            RefineFromSamples();
+        }
+    }
+};
+
+} // namespace
+
+AlignmentClearance::AlignmentClearance(const Alignment& alignment, double maxThrow)
+    : _alignment(&alignment), _tree(alignment), _projector(alignment, maxThrow) {}
+
+const Alignment& AlignmentClearance::GetAlignment() const {
+    return *_alignment;
+}
+
+ClearancePoint AlignmentClearance::Minimum(const AlignmentClearance& other) const {
+    ClearancePoint best{0.0, 0.0, Point2D(), Point2D(), Infinity};
+    std::size_t bestA = 0, bestB = 0;
+    double abscissaA = 0.0, abscissaB = 0.0;
+
+    // Parcours en profondeur des couples de nœuds, le plus proche d'abord
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> stack{{0, 0}};
+    while (!stack.empty()) {
+        const auto [i, j] = stack.back();
+        stack.pop_back();
+        const BoundsTree::Node& a = _tree.GetNode(i);
+        const BoundsTree::Node& b = other._tree.GetNode(j);
+        if (a.Bounds.Distance(b.Bounds) >= best.Distance) {
+            continue;
+        }
+        if (a.Count == 1 && b.Count == 1) {
+            PairSolver solver(_alignment->Element(a.First), other._alignment->Element(b.First));
+            solver.Solve();
+            if (solver.Distance < best.Distance) {
+                best.Distance = solver.Distance;
+                bestA = a.First;
+                bestB = b.First;
+                abscissaA = solver.AbscissaA;
+                abscissaB = solver.AbscissaB;
+            }
+            continue;
+        }
+
+        // Subdivision du nœud le plus étendu
+        auto extent = [](const BoundingBox& box) { return std::max(box.Width(), box.Height()); };
+        const bool splitA = b.Count == 1 || (a.Count > 1 && extent(a.Bounds) >= extent(b.Bounds));
+        std::pair<std::uint32_t, std::uint32_t> first, second;
+        double firstDistance, secondDistance;
+        if (splitA) {
+            first = {a.Left, j};
+            second = {a.Right, j};
+            firstDistance = _tree.GetNode(a.Left).Bounds.Distance(b.Bounds);
+            secondDistance = _tree.GetNode(a.Right).Bounds.Distance(b.Bounds);
+        } else {
+            first = {i, b.Left};
+            second = {i, b.Right};
+            firstDistance = a.Bounds.Distance(other._tree.GetNode(b.Left).Bounds);
+            secondDistance = a.Bounds.Distance(other._tree.GetNode(b.Right).Bounds);
+        }
+        if (firstDistance < secondDistance) {
+            std::swap(first, second);
+        }
+        stack.push_back(first);
+        stack.push_back(second);
+    }
+
+    best.StationA = _alignment->ElementStation(bestA) + abscissaA;
+    best.StationB = other._alignment->ElementStation(bestB) + abscissaB;
+    best.PointA = _alignment->Element(bestA).Point(abscissaA);
+    best.PointB = other._alignment->Element(bestB).Point(abscissaB);
+    return best;
+}
+
+ClearanceProfile AlignmentClearance::Profile(const AlignmentClearance& other, double step) const {
+    ClearanceProfile profile;
+    profile.Stations = _alignment->FixedStepStations(step);
+    profile.Minimum = Minimum(other);
+
+    const std::size_t count = profile.Stations.size();
+    std::vector<Point2D> points(count);
+    std::vector<double> abscissas(count);
+    const std::span<const double> elementStations = _alignment->Stations();
+    _alignment->ForEachElementRun(profile.Stations, [&](std::size_t i, std::size_t first, std::size_t runCount) {
+        for (std::size_t k = first; k < first + runCount; ++k) {
+            abscissas[k] = profile.Stations[k] - elementStations[i];
+        }
+        _alignment->Element(i).Point(std::span<const double>(abscissas.data() + first, runCount),
+                                     std::span<Point2D>(points.data() + first, runCount));
+    });
+
+    // Distance au point le plus proche de l'autre axe (une extrémité lorsque la projection sort de l'axe)
+    std::vector<StationOffset> projections(count);
+    other._projector.Project(points, projections, 1);
+    profile.Distances.resize(count);
+    for (std::size_t k = 0; k < count; ++k) {
+        const StationOffset& projection = projections[k];
+        const double s = projection.Station - other._alignment->ElementStation(projection.ElementIndex);
+        profile.Distances[k] = (points[k] - other._alignment->Element(projection.ElementIndex).Point(s)).Length();
+    }
+    return profile;
+}
+
+std::vector<ClearanceProfile> AlignmentClearance::Profiles(std::span<const std::pair<const AlignmentClearance*, const AlignmentClearance*>> pairs,
+                                                           double step, unsigned threadCount) {
+    std::vector<ClearanceProfile> profiles(pairs.size());
+    // Couples de tailles très variables : chaque thread prend le couple suivant non traité
+    BatchUtils::ParallelFor(pairs.size(), threadCount, [&](std::size_t k) {
+        profiles[k] = pairs[k].first->Profile(*pairs[k].second, step);
+    });
+    return profiles;
+}
+
+} // namespace LineaCore::Geometry::Alignments
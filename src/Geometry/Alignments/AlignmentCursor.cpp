@@ -0,0 +1,153 @@
+// AlignmentCursor.cpp
+
+#include "LineaCore/Geometry/Alignments/AlignmentCursor.hpp"
+#include "LineaCore/Geometry/Alignments/BatchUtils.hpp"
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace LineaCore::Geometry::Alignments {
+
+using namespace Horizontal;
+
+namespace {
+
+// Rotation d'un vecteur par une rotation (cos, sin)
+Vector2D Rotate(const Vector2D& v, const Vector2D& rotation) {
+    return Vector2D(v.X * rotation.X - v.Y * rotation.Y, v.X * rotation.Y + v.Y * rotation.X);
+}
+
+} // namespace
+
+AlignmentCursor::AlignmentCursor(const Alignment& alignment, double station, double step)
+    : _alignment(alignment), _step(step), _origin(station), _index(0), _station(station),
+      _element(0), _elementStart(0.0), _elementEnd(0.0), _orientation(1.0), _curvatureRate(0.0),
+      _stepsSinceAnchor(0), _dx(0.0), _dy(0.0), _curvature(0.0), _chordAlong(0.0), _chordAcross(0.0) {
+    if (!(step > 0.0)) {
+        throw std::runtime_error("Cursor step must be strictly positive");
+    }
+    if (alignment.ElementCount() == 0) {
+        throw std::runtime_error("Alignment '" + alignment.Name() + "' has no element");
+    }
+    Anchor(station, true);
+}
+
+void AlignmentCursor::Anchor(double station, bool findElement) {
+    const HorizontalAlignment* element;
+    if (findElement) {
+        _element = _alignment.ElementIndex(station);
+        element = &_alignment.Element(_element);
+        _elementStart = _alignment.ElementStation(_element);
+        _elementEnd = _element + 1 < _alignment.ElementCount() ? _alignment.ElementStation(_element + 1) : std::numeric_limits<double>::infinity();
+        _orientation = element->NormalSide();
+        _curvatureRate = element->Type() == HorizontalAlignment::H_Type::Transition && element->Length() > 0.0
+                             ? (element->Curvature(element->Length()) - element->Curvature(0.0)) / element->Length()
+                             : 0.0;
+    } else {
+        element = &_alignment.Element(_element);
+    }
+
+    const double s = station - _elementStart;
+    _point = element->Point(s);
+    _anchorPoint = _point;
+    _dx = 0.0;
+    _dy = 0.0;
+    _normal = element->Normal(s);
+    _curvature = element->Curvature(s);
+    _stepsSinceAnchor = 0;
+
+    const double h = _step;
+    if (_curvatureRate == 0.0) {
+        // Rotation constante ; corde exacte de l'arc de longueur h
+        const double angle = _curvature * h;
+        _rotation = Vector2D(std::cos(angle), std::sin(angle));
+        _chordAlong = _curvature == 0.0 ? h : std::sin(angle) / _curvature;
+        _chordAcross = _curvature == 0.0 ? 0.0 : 2.0 * std::sin(angle / 2.0) * std::sin(angle / 2.0) / _curvature;
+    } else {
+        // Angles de rotation sur le pas et jusqu'au milieu du pas, croissant de σh² et σh²/2 à chaque pas
+        const double angle = _curvature * h + _curvatureRate * h * h / 2.0;
+        const double halfAngle = _curvature * h / 2.0 + _curvatureRate * h * h / 8.0;
+        _rotation = Vector2D(std::cos(angle), std::sin(angle));
+        _halfRotation = Vector2D(std::cos(halfAngle), std::sin(halfAngle));
+        _rotationRate = Vector2D(std::cos(_curvatureRate * h * h), std::sin(_curvatureRate * h * h));
+        _halfRotationRate = Vector2D(std::cos(_curvatureRate * h * h / 2.0), std::sin(_curvatureRate * h * h / 2.0));
+    }
+}
+
+double AlignmentCursor::Station() const {
+    return _station;
+}
+
+double AlignmentCursor::Step() const {
+    return _step;
+}
+
+std::size_t AlignmentCursor::ElementIndex() const {
+    return _element;
+}
+
+const Point2D& AlignmentCursor::Point() const {
+    return _point;
+}
+
+const Vector2D& AlignmentCursor::Normal() const {
+    return _normal;
+}
+
+double AlignmentCursor::Curvature() const {
+    return _curvature;
+}
+
+void AlignmentCursor::Next() {
+    ++_index;
+    _station = _origin + _step * static_cast<double>(_index);
+    if (_station >= _elementEnd) {
+        Anchor(_station, true);
+        return;
+    }
+    if (++_stepsSinceAnchor >= ReanchorInterval) {
+        Anchor(_station, false);
+        return;
+    }
+
+    const Vector2D normal = _normal;
+    if (_curvatureRate == 0.0) {
+        // Tangente T = ε(-Ny, Nx), normale à gauche de la tangente : -εN
+        _dx += _orientation * (-_chordAlong * normal.Y - _chordAcross * normal.X);
+        _dy += _orientation * (_chordAlong * normal.X - _chordAcross * normal.Y);
+        _normal = Rotate(normal, _rotation);
+    } else {
+        const Vector2D middle = Rotate(normal, _halfRotation);
+        const Vector2D next = Rotate(normal, _rotation);
+        // Simpson : intégrale de la tangente sur le pas, tournée de 90° antihoraire à partir des normales
+        const double sx = _step / 6.0 * (normal.X + 4.0 * middle.X + next.X);
+        const double sy = _step / 6.0 * (normal.Y + 4.0 * middle.Y + next.Y);
+        _dx -= _orientation * sy;
+        _dy += _orientation * sx;
+        _normal = next;
+        _rotation = Rotate(_rotation, _rotationRate);
+        _halfRotation = Rotate(_halfRotation, _halfRotationRate);
+        _curvature += _curvatureRate * _step;
+    }
+    _point.X = _anchorPoint.X + _dx;
+    _point.Y = _anchorPoint.Y + _dy;
+}
+
+void AlignmentCursor::Seek(double station) {
+    _origin = station;
+    _index = 0;
+    _station = station;
+    Anchor(station, true);
+}
+
+void AlignmentCursor::Points(std::span<Point2D> points, std::span<Vector2D> normals) {
+    BatchUtils::CheckBatchSize(points.size(), normals.size());
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        points[i] = _point;
+        normals[i] = _normal;
+        Next();
+    }
+}
+
+} // namespace LineaCore::Geometry::Alignments
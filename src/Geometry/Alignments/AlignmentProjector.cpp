@@ -0,0 +1,216 @@
+// AlignmentProjector.cpp
+
+#include "LineaCore/Geometry/Alignments/AlignmentProjector.hpp"
+#include "LineaCore/Geometry/Alignments/BatchUtils.hpp"
+#include "LineaCore/Geometry/Vector2D.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace LineaCore::Geometry::Alignments {
+
+using namespace Horizontal;
+
+namespace {
+
+constexpr std::size_t CellsPerElement = 4;          // Nombre moyen de cellules de grille par élément
+
+// Marquage des éléments déjà examinés pour la requête courante, propre à chaque thread.
+// Le compteur est commun à tous les projecteurs du thread, ce qui évite toute confusion entre eux.
+struct VisitScratch {
+    VisitStamps visited;
+    std::vector<std::pair<double, std::uint32_t>> candidates;
+};
+
+thread_local VisitScratch visitScratch;
+
+} // namespace
+
+AlignmentProjector::AlignmentProjector(const Alignment& alignment, double maxThrow)
+    : _alignment(alignment) {
+    if (alignment.ElementCount() == 0) {
+        throw std::runtime_error("Cannot project onto Alignment '" + alignment.Name() + "' which has no element");
+    }
+    HorizontalAlignment::CheckMaxThrow(maxThrow);
+    BuildTessellation(maxThrow);
+    _grid = UniformGrid(_bounds, CellsPerElement);
+}
+
+void AlignmentProjector::BuildTessellation(double maxThrow) {
+    const std::size_t n = _alignment.ElementCount();
+    _bounds.resize(n);
+    _firstVertices.resize(n + 1);
+
+    std::vector<double> abscissas;
+    std::vector<Point2D> points;
+    for (std::size_t i = 0; i < n; ++i) {
+        const HorizontalAlignment& element = _alignment.Element(i);
+        // Cordes de même longueur dont la flèche reste sous maxThrow
+        const std::size_t segmentCount = element.ChordSegmentCount(maxThrow);
+        abscissas.resize(segmentCount + 1);
+        points.resize(segmentCount + 1);
+        HorizontalAlignment::UniformAbscissas(element.Length(), abscissas);
+        element.Point(abscissas, points);
+
+        _firstVertices[i] = static_cast<std::uint32_t>(_vertices.size());
+        BoundingBox bounds;
+        for (const Point2D& p : points) {
+            bounds.Extend(p);
+        }
+        // La courbe s'écarte de ses cordes d'au plus maxThrow : marge de sécurité double
+        _bounds[i] = bounds.Inflated(2.0 * maxThrow);
+
+        _vertices.insert(_vertices.end(), points.begin(), points.end());
+        _vertexAbscissas.insert(_vertexAbscissas.end(), abscissas.begin(), abscissas.end());
+    }
+    _firstVertices[n] = static_cast<std::uint32_t>(_vertices.size());
+}
+
+double AlignmentProjector::SeedAbscissa(std::size_t element, const Point2D& point) const {
+    // Projection sur la polyligne de discrétisation de l'élément
+    double bestAbscissa = _vertexAbscissas[_firstVertices[element]];
+    double bestDistance = std::numeric_limits<double>::infinity();
+    for (std::uint32_t k = _firstVertices[element]; k + 1 < _firstVertices[element + 1]; ++k) {
+        const Vector2D chord = _vertices[k + 1] - _vertices[k];
+        const double chordLength2 = chord * chord;
+        double t = chordLength2 > 0.0 ? std::clamp(((point - _vertices[k]) * chord) / chordLength2, 0.0, 1.0) : 0.0;
+        const Vector2D d = (_vertices[k] + chord * t) - point;
+        const double distance = d * d;
+        if (distance < bestDistance) {
+            bestDistance = distance;
+            bestAbscissa = _vertexAbscissas[k] + t * (_vertexAbscissas[k + 1] - _vertexAbscissas[k]);
+        }
+    }
+    return bestAbscissa;
+}
+
+void AlignmentProjector::SolveElement(std::size_t element, const Point2D& point, double& bestDistance, StationOffset& best) const {
+    const HorizontalAlignment& e = _alignment.Element(element);
+    const double seed = e.Type() == HorizontalAlignment::H_Type::Transition ? SeedAbscissa(element, point) : 0.0;
+    const double s = e.Projection(point, seed);
+    const Point2D foot = e.Point(s);
+    const double distance = (point - foot).Length();
+    if (distance < bestDistance) {
+        bestDistance = distance;
+        best.Station = _alignment.ElementStation(element) + s;
+        best.Offset = (point - foot) * e.Normal(s) * e.NormalSide();
+        best.ElementIndex = element;
+    }
+}
+
+StationOffset AlignmentProjector::ProjectBruteForce(const Point2D& point) const {
+    // Éléments examinés par distance croissante à leur boîte, jusqu'à ce qu'aucun ne puisse améliorer la solution
+    std::vector<std::pair<double, std::uint32_t>> candidates(_bounds.size());
+    for (std::size_t i = 0; i < _bounds.size(); ++i) {
+        candidates[i] = {_bounds[i].Distance(point), static_cast<std::uint32_t>(i)};
+    }
+    std::sort(candidates.begin(), candidates.end());
+
+    StationOffset best{std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::quiet_NaN(), 0};
+    double bestDistance = std::numeric_limits<double>::infinity();
+    for (const auto& [lowerBound, element] : candidates) {
+        if (lowerBound >= bestDistance) {
+            break;
+        }
+        SolveElement(element, point, bestDistance, best);
+    }
+    return best;
+}
+
+StationOffset AlignmentProjector::ProjectWithGrid(const Point2D& point) const {
+    const double gridMinX = _grid.MinX();
+    const double gridMinY = _grid.MinY();
+    const double cellSize = _grid.CellSize();
+    const double gx = (point.X - gridMinX) / cellSize;
+    const double gy = (point.Y - gridMinY) / cellSize;
+    if (!(gx >= 0.0 && gy >= 0.0 && gx < static_cast<double>(_grid.Columns()) && gy < static_cast<double>(_grid.Rows()))) {
+        return ProjectBruteForce(point); // Hors de la grille (ou coordonnées NaN)
+    }
+
+    VisitStamps& visited = visitScratch.visited;
+    visited.NextQuery(_bounds.size());
+
+    const std::ptrdiff_t cx = static_cast<std::ptrdiff_t>(gx);
+    const std::ptrdiff_t cy = static_cast<std::ptrdiff_t>(gy);
+    const std::ptrdiff_t columns = static_cast<std::ptrdiff_t>(_grid.Columns());
+    const std::ptrdiff_t rows = static_cast<std::ptrdiff_t>(_grid.Rows());
+
+    StationOffset best{std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::quiet_NaN(), 0};
+    double bestDistance = std::numeric_limits<double>::infinity();
+
+    // Candidats d'un anneau, résolus par distance croissante à leur boîte
+    std::vector<std::pair<double, std::uint32_t>>& candidates = visitScratch.candidates;
+    auto visitCell = [&](std::ptrdiff_t c, std::ptrdiff_t r) {
+        if (c < 0 || r < 0 || c >= columns || r >= rows) {
+            return;
+        }
+        for (std::uint32_t element : _grid.CellItems(static_cast<std::size_t>(c), static_cast<std::size_t>(r))) {
+            if (!visited.Visit(element)) {
+                continue;
+            }
+            const double lowerBound = _bounds[element].Distance(point);
+            if (lowerBound < bestDistance) {
+                candidates.emplace_back(lowerBound, element);
+            }
+        }
+    };
+
+    for (std::ptrdiff_t ring = 0;; ++ring) {
+        candidates.clear();
+        if (ring == 0) {
+            visitCell(cx, cy);
+        } else {
+            for (std::ptrdiff_t c = cx - ring; c <= cx + ring; ++c) {
+                visitCell(c, cy - ring);
+                visitCell(c, cy + ring);
+            }
+            for (std::ptrdiff_t r = cy - ring + 1; r <= cy + ring - 1; ++r) {
+                visitCell(cx - ring, r);
+                visitCell(cx + ring, r);
+            }
+        }
+        std::sort(candidates.begin(), candidates.end());
+        for (const auto& [lowerBound, element] : candidates) {
+            if (lowerBound >= bestDistance) {
+                break;
+            }
+            SolveElement(element, point, bestDistance, best);
+        }
+
+        // Distance minimale aux cellules non encore visitées (les côtés déjà au bord de la grille sont exclus)
+        constexpr double Infinity = std::numeric_limits<double>::infinity();
+        const double left = cx - ring > 0 ? point.X - (gridMinX + (cx - ring) * cellSize) : Infinity;
+        const double right = cx + ring < columns - 1 ? (gridMinX + (cx + ring + 1) * cellSize) - point.X : Infinity;
+        const double bottom = cy - ring > 0 ? point.Y - (gridMinY + (cy - ring) * cellSize) : Infinity;
+        const double top = cy + ring < rows - 1 ? (gridMinY + (cy + ring + 1) * cellSize) - point.Y : Infinity;
+        const double unvisited = std::min({left, right, bottom, top});
+        if (unvisited == Infinity || unvisited >= bestDistance) {
+            break;
+        }
+    }
+    return best;
+}
+
+StationOffset AlignmentProjector::Project(const Point2D& point) const {
+    return ProjectWithGrid(point);
+}
+
+void AlignmentProjector::Project(std::span<const Point2D> points, std::span<StationOffset> results, unsigned threadCount) const {
+    BatchUtils::CheckBatchSize(points.size(), results.size());
+    // Au moins quelques milliers de points par thread pour amortir leur création
+    constexpr std::size_t MinPointsPerThread = 4096;
+    const std::size_t chunkCount = std::min<std::size_t>(BatchUtils::ThreadCount(threadCount), std::max<std::size_t>(1, points.size() / MinPointsPerThread));
+
+    // Plages contiguës de points, une par thread
+    BatchUtils::ParallelFor(chunkCount, static_cast<unsigned>(chunkCount), [&](std::size_t t) {
+        const std::size_t last = points.size() * (t + 1) / chunkCount;
+        for (std::size_t i = points.size() * t / chunkCount; i < last; ++i) {
+            results[i] = ProjectWithGrid(points[i]);
+        }
+    });
+}
+
+} // namespace LineaCore::Geometry::Alignments
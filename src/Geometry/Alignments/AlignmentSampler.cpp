@@ -0,0 +1,144 @@
+// AlignmentSampler.cpp
+
+#include "LineaCore/Geometry/Alignments/AlignmentSampler.hpp"
+#include "LineaCore/Geometry/Alignments/BatchUtils.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace LineaCore::Geometry::Alignments {
+
+using namespace Horizontal;
+
+namespace {
+
+constexpr std::size_t BlockSize = 256;               // Stations traitées ensemble (tampons en cache L1)
+constexpr std::size_t MinSamplesPerThread = 4096;    // Nombre minimal d'échantillons par thread
+
+} // namespace
+
+// AlignmentSamples
+
+std::size_t AlignmentSamples::Size() const {
+    return Station.size();
+}
+
+void AlignmentSamples::Resize(std::size_t size) {
+    for (std::vector<double>* component : {&Station, &X, &Y, &Z, &Heading, &Curvature, &Grade, &Cant}) {
+        component->resize(size);
+    }
+}
+
+// AlignmentSampler
+
+AlignmentSampler::AlignmentSampler(const Alignment& alignment)
+    : AlignmentSampler(alignment, alignment.ProfileCount() > 0 ? &alignment.Profile(0) : nullptr,
+                       alignment.CantCount() > 0 ? &alignment.Cant(0) : nullptr) {}
+
+AlignmentSampler::AlignmentSampler(const Alignment& alignment, const Vertical::VerticalAlignment* profile, const CantTable* cant)
+    : _alignment(alignment), _profile(profile), _cant(cant), _inputStationType(StationType::Internal) {}
+
+StationType AlignmentSampler::InputStationType() const {
+    return _inputStationType;
+}
+
+void AlignmentSampler::SetInputStationType(StationType type) {
+    _inputStationType = type;
+}
+
+void AlignmentSampler::SampleRange(std::span<const double> stations, StationType type, AlignmentSamples& samples, std::size_t first) const {
+    const std::span<const double> elementStations = _alignment.Stations();
+    double internalStations[BlockSize];
+    double abscissas[BlockSize];
+    Point2D points[BlockSize];
+    Vector2D normals[BlockSize];
+
+    for (std::size_t blockStart = 0; blockStart < stations.size(); blockStart += BlockSize) {
+        const std::size_t count = std::min(BlockSize, stations.size() - blockStart);
+        const std::span<const double> input = stations.subspan(blockStart, count);
+        const std::size_t offset = first + blockStart;
+        std::copy(input.begin(), input.end(), samples.Station.begin() + offset);
+
+        // Stations externes converties par le curseur de zone des équations de station
+        std::span<const double> block = input;
+        if (type == StationType::External) {
+            _alignment.StationEquations().InternalStations(input, std::span<double>(internalStations, count));
+            block = std::span<const double>(internalStations, count);
+        }
+
+        // Plan : plages de stations consécutives dans un même élément
+        _alignment.ForEachElementRun(block, [&](std::size_t i, std::size_t j, std::size_t runCount) {
+            for (std::size_t k = j; k < j + runCount; ++k) {
+                abscissas[k] = block[k] - elementStations[i];
+            }
+            const std::span<const double> s(abscissas + j, runCount);
+            const HorizontalAlignment& element = _alignment.Element(i);
+            _alignment.ElementPoints(i, s, std::span<Point2D>(points + j, runCount), std::span<Vector2D>(normals + j, runCount));
+            // Normales ramenées à droite du sens de parcours (celles des arcs horaires sont à gauche)
+            const double side = element.NormalSide();
+            for (std::size_t k = j; k < j + runCount; ++k) {
+                normals[k] = normals[k] * side;
+            }
+            element.Curvature(s, std::span<double>(samples.Curvature.data() + offset + j, runCount));
+        });
+        for (std::size_t j = 0; j < count; ++j) {
+            samples.X[offset + j] = points[j].X;
+            samples.Y[offset + j] = points[j].Y;
+            // Tangente : normale à droite tournée de 90° dans le sens antihoraire, (-Ny, Nx)
+            samples.Heading[offset + j] = std::atan2(normals[j].X, -normals[j].Y);
+        }
+
+        // Profil en long et dévers, avec leurs propres curseurs de tronçon
+        const std::span<double> z(samples.Z.data() + offset, count);
+        const std::span<double> grade(samples.Grade.data() + offset, count);
+        const std::span<double> cant(samples.Cant.data() + offset, count);
+        if (_profile != nullptr) {
+            _profile->Evaluate(block, z, grade);
+        } else {
+            std::fill(z.begin(), z.end(), 0.0);
+            std::fill(grade.begin(), grade.end(), 0.0);
+        }
+        if (_cant != nullptr) {
+            _cant->AppliedCant(block, cant);
+        } else {
+            std::fill(cant.begin(), cant.end(), 0.0);
+        }
+    }
+}
+
+void AlignmentSampler::SampleStations(std::span<const double> stations, StationType type, AlignmentSamples& samples, unsigned threadCount) const {
+    if (_alignment.ElementCount() == 0) {
+        throw std::runtime_error("Alignment '" + _alignment.Name() + "' has no element");
+    }
+    samples.Resize(stations.size());
+    const std::size_t chunkCount = std::max<std::size_t>(1, std::min<std::size_t>(BatchUtils::ThreadCount(threadCount), stations.size() / MinSamplesPerThread));
+
+    // Découpage de la plage de stations en plages contiguës, une par thread
+    BatchUtils::ParallelFor(chunkCount, static_cast<unsigned>(chunkCount), [&](std::size_t t) {
+        const std::size_t first = stations.size() * t / chunkCount;
+        const std::size_t end = stations.size() * (t + 1) / chunkCount;
+        SampleRange(stations.subspan(first, end - first), type, samples, first);
+    });
+}
+
+void AlignmentSampler::Sample(std::span<const double> stations, AlignmentSamples& samples, unsigned threadCount) const {
+    SampleStations(stations, _inputStationType, samples, threadCount);
+}
+
+AlignmentSamples AlignmentSampler::Sample(std::span<const double> stations, unsigned threadCount) const {
+    AlignmentSamples samples;
+    Sample(stations, samples, threadCount);
+    return samples;
+}
+
+AlignmentSamples AlignmentSampler::Sample(double step, unsigned threadCount) const {
+    const std::vector<double> stations = _alignment.FixedStepStations(step);
+    AlignmentSamples samples;
+    SampleStations(stations, StationType::Internal, samples, threadCount);
+    if (_inputStationType == StationType::External) {
+        _alignment.StationEquations().ExternalStations(samples.Station, samples.Station);
+    }
+    return samples;
+}
+
+} // namespace LineaCore::Geometry::Alignments
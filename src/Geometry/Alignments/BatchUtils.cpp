@@ -0,0 +1,75 @@
+// BatchUtils.cpp
+
+#include "LineaCore/Geometry/Alignments/BatchUtils.hpp"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace LineaCore::Geometry::Alignments {
+
+void BatchUtils::CheckBatchSize(std::size_t stationCount, std::size_t outputCount) {
+    if (stationCount != outputCount) {
+        throw std::runtime_error("Batch evaluation output size (" + std::to_string(outputCount) +
+                                 ") does not match the number of stations (" + std::to_string(stationCount) + ")");
+    }
+}
+
+unsigned BatchUtils::ThreadCount(unsigned threadCount) {
+    return threadCount != 0 ? threadCount : std::max(1u, std::thread::hardware_concurrency());
+}
+
+void BatchUtils::ParallelFor(std::size_t taskCount, unsigned threadCount, const std::function<void(std::size_t task)>& task) {
+    threadCount = static_cast<unsigned>(std::min<std::size_t>(ThreadCount(threadCount), taskCount));
+    if (threadCount <= 1) {
+        for (std::size_t k = 0; k < taskCount; ++k) {
+            task(k);
+        }
+        return;
+    }
+
+    // L'échec est testé avant de prendre un index : les index étant distribués dans l'ordre croissant,
+    // toute tâche d'index inférieur à celle qui a échoué est exécutée, et son exception éventuelle retenue.
+    std::atomic<std::size_t> next{0};
+    std::atomic<bool> failed{false};
+    std::mutex errorMutex;
+    std::exception_ptr error;
+    std::size_t errorTask = taskCount;
+    auto work = [&] {
+        while (!failed.load(std::memory_order_relaxed)) {
+            const std::size_t k = next++;
+            if (k >= taskCount) {
+                break;
+            }
+            try {
+                task(k);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (k < errorTask) {
+                    errorTask = k;
+                    error = std::current_exception();
+                }
+                failed.store(true, std::memory_order_relaxed);
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount - 1);
+    for (unsigned t = 1; t < threadCount; ++t) {
+        threads.emplace_back(work);
+    }
+    work();
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+} // namespace LineaCore::Geometry::Alignments
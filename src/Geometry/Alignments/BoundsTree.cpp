@@ -0,0 +1,88 @@
+// BoundsTree.cpp
+
+#include "LineaCore/Geometry/Alignments/BoundsTree.hpp"
+
+namespace LineaCore::Geometry::Alignments {
+
+BoundsTree::BoundsTree(const Alignment& alignment) {
+    const std::size_t n = alignment.ElementCount();
+    if (n == 0) {
+        return;
+    }
+    std::vector<BoundingBox> bounds(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        bounds[i] = alignment.Element(i).Bounds();
+    }
+    _nodes.reserve(2 * n - 1);
+    _leaves.resize(n);
+    BuildNode(bounds, 0, static_cast<std::uint32_t>(n));
+}
+
+std::uint32_t BoundsTree::BuildNode(const std::vector<BoundingBox>& elementBounds, std::uint32_t first, std::uint32_t count) {
+    const std::uint32_t index = static_cast<std::uint32_t>(_nodes.size());
+    _nodes.push_back(Node{elementBounds[first], first, count, 0, 0});
+    if (count == 1) {
+        _leaves[first] = index;
+        return index;
+    }
+    const std::uint32_t half = count / 2;
+    const std::uint32_t left = BuildNode(elementBounds, first, half);
+    const std::uint32_t right = BuildNode(elementBounds, first + half, count - half);
+    Node& node = _nodes[index];
+    node.Bounds = _nodes[left].Bounds;
+    node.Bounds.Extend(_nodes[right].Bounds);
+    node.Left = left;
+    node.Right = right;
+    return index;
+}
+
+std::size_t BoundsTree::ElementCount() const {
+    return _leaves.size();
+}
+
+std::size_t BoundsTree::NodeCount() const {
+    return _nodes.size();
+}
+
+const BoundsTree::Node& BoundsTree::GetNode(std::size_t index) const {
+    return _nodes.at(index);
+}
+
+BoundingBox BoundsTree::Bounds() const {
+    return _nodes.empty() ? BoundingBox() : _nodes.front().Bounds;
+}
+
+const BoundingBox& BoundsTree::ElementBounds(std::size_t element) const {
+    return _nodes[_leaves.at(element)].Bounds;
+}
+
+void BoundsTree::Query(const BoundingBox& box, std::vector<std::size_t>& elements) const {
+    if (_nodes.empty()) {
+        return;
+    }
+    // La coupure au milieu limite la profondeur à 33 niveaux : pile de taille fixe. L'enfant gauche
+    // est traité en premier pour rendre les éléments dans l'ordre.
+    std::uint32_t stack[64];
+    std::size_t size = 0;
+    stack[size++] = 0;
+    while (size > 0) {
+        const Node& node = _nodes[stack[--size]];
+        if (!node.Bounds.Intersects(box)) {
+            continue;
+        }
+        if (node.Count == 1) {
+            elements.push_back(node.First);
+            continue;
+        }
+        stack[size++] = node.Right;
+        stack[size++] = node.Left;
+    }
+}
+
+std::vector<std::size_t> BoundsTree::Query(const BoundingBox& box) const {
+    std::vector<std::size_t> elements;
+    Query(box, elements);
+    return elements;
+}
+
+} // namespace LineaCore::Geometry::Alignments
@@ -0,0 +1,188 @@
+// CantTable.cpp
+
+#include "LineaCore/Geometry/Alignments/CantTable.hpp"
+#include "LineaCore/Geometry/Alignments/BatchUtils.hpp"
+#include "LineaCore/LandXML/XMLUtils.hpp"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace LineaCore::Geometry::Alignments {
+
+namespace {
+
+// Parcours des stations avec un curseur d'intervalle : avance tant que les stations croissent,
+// nouvelle recherche dichotomique sinon
+template <typename Search, typename Evaluate>
+void ForEachInterval(std::span<const double> tableStations, std::span<const double> stations, std::span<double> values,
+                     Search search, Evaluate evaluate) {
+    BatchUtils::CheckBatchSize(stations.size(), values.size());
+    if (stations.empty()) {
+        return;
+    }
+    const std::size_t last = tableStations.size() - 1;
+    std::size_t i = search(stations[0]);
+    for (std::size_t k = 0; k < stations.size(); ++k) {
+        const double station = stations[k];
+        if (station < tableStations[i] && i > 0) {
+            i = search(station);
+        }
+        while (i < last && station >= tableStations[i + 1]) {
+            ++i;
+        }
+        values[k] = evaluate(i, station);
+    }
+}
+
+} // namespace
+
+CantTable::CantTable()
+    : _gauge(0.0) {}
+
+CantTable::CantTable(std::string name, double gauge, std::string rotationPoint, const std::vector<CantStation>& stations)
+    : _name(std::move(name)), _gauge(gauge), _rotationPoint(std::move(rotationPoint)) {
+    _stations.reserve(stations.size());
+    _appliedCants.reserve(stations.size());
+    for (const CantStation& station : stations) {
+        _stations.push_back(station.Station);
+        _appliedCants.push_back(station.AppliedCant);
+        _curvatures.push_back(station.Curvature);
+        _adverse.push_back(station.Adverse ? 1 : 0);
+    }
+    BuildGradients();
+}
+
+void CantTable::BuildGradients() {
+    const std::size_t n = _stations.size();
+    if (n == 0) {
+        throw std::runtime_error("Cant '" + _name + "' has no station");
+    }
+    _gradients.assign(n, 0.0);
+    for (std::size_t i = 0; i + 1 < n; ++i) {
+        const double length = _stations[i + 1] - _stations[i];
+        if (!(length > 0.0)) {
+            throw std::runtime_error("Stations of Cant '" + _name + "' are not strictly increasing at station " + std::to_string(_stations[i + 1]));
+        }
+        _gradients[i] = (_appliedCants[i + 1] - _appliedCants[i]) / length;
+    }
+}
+
+const std::string& CantTable::Name() const {
+    return _name;
+}
+
+const std::string& CantTable::Description() const {
+    return _description;
+}
+
+double CantTable::Gauge() const {
+    return _gauge;
+}
+
+const std::string& CantTable::RotationPoint() const {
+    return _rotationPoint;
+}
+
+std::size_t CantTable::StationCount() const {
+    return _stations.size();
+}
+
+CantStation CantTable::Station(std::size_t index) const {
+    return CantStation{_stations.at(index), _appliedCants[index], _curvatures[index], _adverse[index] != 0};
+}
+
+std::span<const double> CantTable::Stations() const {
+    return _stations;
+}
+
+std::span<const double> CantTable::AppliedCants() const {
+    return _appliedCants;
+}
+
+std::size_t CantTable::IntervalIndex(double station) const {
+    if (_stations.empty()) {
+        throw std::runtime_error("Cant '" + _name + "' has no station");
+    }
+    const auto it = std::upper_bound(_stations.begin() + 1, _stations.end(), station);
+    return static_cast<std::size_t>(it - _stations.begin()) - 1;
+}
+
+double CantTable::AppliedCant(double station) const {
+    const std::size_t i = IntervalIndex(station);
+    return _appliedCants[i] + _gradients[i] * (std::max(station, _stations[i]) - _stations[i]);
+}
+
+double CantTable::CantGradient(double station) const {
+    const std::size_t i = IntervalIndex(station);
+    return station < _stations[i] ? 0.0 : _gradients[i];
+}
+
+void CantTable::AppliedCant(std::span<const double> stations, std::span<double> appliedCants) const {
+    ForEachInterval(_stations, stations, appliedCants, [this](double station) { return IntervalIndex(station); },
+                    [this](std::size_t i, double station) {
+                        return _appliedCants[i] + _gradients[i] * (std::max(station, _stations[i]) - _stations[i]);
+                    });
+}
+
+void CantTable::CantGradient(std::span<const double> stations, std::span<double> gradients) const {
+    ForEachInterval(_stations, stations, gradients, [this](double station) { return IntervalIndex(station); },
+                    [this](std::size_t i, double station) { return station < _stations[i] ? 0.0 : _gradients[i]; });
+}
+
+void CantTable::ReadLandXML(xmlTextReaderPtr reader) {
+    _name = LandXML::XMLUtils::ReadAttributeAsString(reader, "name");
+    _description = LandXML::XMLUtils::ReadOptionalAttributeAsString(reader, "desc");
+    _gauge = LandXML::XMLUtils::ReadAttributeAsDouble(reader, "gauge");
+    _rotationPoint = LandXML::XMLUtils::ReadOptionalAttributeAsString(reader, "rotationPoint");
+    _stations.clear();
+    _appliedCants.clear();
+    _curvatures.clear();
+    _adverse.clear();
+
+    if (!xmlTextReaderIsEmptyElement(reader)) {
+        while (xmlTextReaderRead(reader) == 1) {
+            const int nodeType = xmlTextReaderNodeType(reader);
+            const char* nodeName = reinterpret_cast<const char*>(xmlTextReaderConstLocalName(reader));
+            if (nodeType == XML_READER_TYPE_ELEMENT && std::strcmp(nodeName, "CantStation") == 0) {
+                _stations.push_back(LandXML::XMLUtils::ReadAttributeAsDouble(reader, "station"));
+                _appliedCants.push_back(LandXML::XMLUtils::ReadAttributeAsDouble(reader, "appliedCant"));
+
+                const std::string curvature = LandXML::XMLUtils::ReadOptionalAttributeAsString(reader, "curvature", "cw");
+                if (curvature != "cw" && curvature != "ccw") {
+                    throw std::runtime_error("Invalid attribute 'curvature=\"" + curvature + "\"' in Element <CantStation>");
+                }
+                _curvatures.push_back(curvature == "cw" ? CantCurvature::Clockwise : CantCurvature::CounterClockwise);
+                _adverse.push_back(LandXML::XMLUtils::ReadOptionalAttributeAsString(reader, "adverse") == "true" ? 1 : 0);
+            } else if (nodeType == XML_READER_TYPE_END_ELEMENT && std::strcmp(nodeName, "Cant") == 0) {
+                break;
+            }
+        }
+    }
+
+    BuildGradients();
+}
+
+void CantTable::WriteLandXML(xmlTextWriterPtr writer) const {
+    xmlTextWriterStartElement(writer, BAD_CAST "Cant");
+    xmlTextWriterWriteAttribute(writer, BAD_CAST "name", BAD_CAST _name.c_str());
+    if (!_description.empty()) {
+        xmlTextWriterWriteAttribute(writer, BAD_CAST "desc", BAD_CAST _description.c_str());
+    }
+    xmlTextWriterWriteFormatAttribute(writer, BAD_CAST "gauge", "%.15g", _gauge);
+    if (!_rotationPoint.empty()) {
+        xmlTextWriterWriteAttribute(writer, BAD_CAST "rotationPoint", BAD_CAST _rotationPoint.c_str());
+    }
+
+    for (std::size_t i = 0; i < _stations.size(); ++i) {
+        xmlTextWriterStartElement(writer, BAD_CAST "CantStation");
+        xmlTextWriterWriteFormatAttribute(writer, BAD_CAST "station", "%.15g", _stations[i]);
+        xmlTextWriterWriteFormatAttribute(writer, BAD_CAST "appliedCant", "%.15g", _appliedCants[i]);
+        xmlTextWriterWriteAttribute(writer, BAD_CAST "curvature", BAD_CAST(_curvatures[i] == CantCurvature::Clockwise ? "cw" : "ccw"));
+        xmlTextWriterWriteAttribute(writer, BAD_CAST "adverse", BAD_CAST(_adverse[i] != 0 ? "true" : "false"));
+        xmlTextWriterEndElement(writer);
+    }
+
+    xmlTextWriterEndElement(writer);
+}
+
+} // namespace LineaCore::Geometry::Alignments
@@ -0,0 +1,196 @@
+// ContinuityValidator.cpp
+
+#include "LineaCore/Geometry/Alignments/ContinuityValidator.hpp"
+#include "LineaCore/Geometry/Alignments/BatchUtils.hpp"
+#include "LineaCore/LandXML/LandXMLAlignmentLoader.hpp"
+#include "LineaCore/Utils/JsonUtils.hpp"
+#include <algorithm>
+#include <cmath>
+#include <exception>
+
+namespace LineaCore::Geometry::Alignments {
+
+using namespace Horizontal;
+using Utils::JsonUtils;
+
+namespace {
+
+void Report(AlignmentContinuity& result, ContinuityCheck check, std::size_t element, double station, double deviation, double tolerance) {
+    if (deviation > tolerance) {
+        result.Issues.push_back(ContinuityIssue{check, element, station, deviation});
+    }
+}
+
+} // namespace
+
+AlignmentContinuity ContinuityValidator::Validate(const Alignment& alignment, const ContinuityTolerances& tolerances) {
+    AlignmentContinuity result;
+    result.Name = alignment.Name();
+    result.ElementCount = alignment.ElementCount();
+
+    // Repère des stations de début déclarées, choisi une fois pour l'axe parmi les éléments où les repères diffèrent
+    std::size_t internalVotes = 0, externalVotes = 0;
+    for (std::size_t i = 0; i < alignment.ElementCount(); ++i) {
+        const double declaredStation = alignment.DeclaredElementStation(i);
+        const double station = alignment.ElementStation(i);
+        const double externalStation = alignment.ExternalStation(station);
+        if (std::isnan(declaredStation) || externalStation == station) {
+            continue;
+        }
+        if (std::fabs(declaredStation - station) < std::fabs(declaredStation - externalStation)) {
+            ++internalVotes;
+        } else {
+            ++externalVotes;
+        }
+    }
+    result.ExternalStations = externalVotes > 0 && externalVotes >= internalVotes;
+
+    for (std::size_t i = 0; i < alignment.ElementCount(); ++i) {
+        const HorizontalAlignment& element = alignment.Element(i);
+        const double station = alignment.ElementStation(i);
+
+        if (i > 0) {
+            const HorizontalAlignment& previous = alignment.Element(i - 1);
+            const double gap = (element.getStartingPoint() - previous.getEndingPoint()).Length();
+
+            // Normales ramenées à droite du sens de parcours ; angle orienté entre elles
+            const Vector2D before = previous.getEndingNormal() * previous.NormalSide();
+            const Vector2D after = element.getStartingNormal() * element.NormalSide();
+            const double angle = std::fabs(std::atan2(before / after, before * after));
+
+            const double jump = std::fabs(element.Curvature(0.0) - previous.Curvature(previous.Length()));
+
+            result.MaxPositionGap = std::max(result.MaxPositionGap, gap);
+            result.MaxAngleGap = std::max(result.MaxAngleGap, angle);
+            result.MaxCurvatureJump = std::max(result.MaxCurvatureJump, jump);
+            Report(result, ContinuityCheck::Position, i, station, gap, tolerances.Position);
+            Report(result, ContinuityCheck::Tangent, i, station, angle, tolerances.Angle);
+            Report(result, ContinuityCheck::Curvature, i, station, jump, tolerances.Curvature);
+        }
+
+        // Valeurs déclarées : un attribut absent (NaN) n'est jamais reporté
+        Report(result, ContinuityCheck::ElementLength, i, station,
+               std::fabs(alignment.DeclaredElementLength(i) - element.Length()), tolerances.Length);
+        const double declaredStation = alignment.DeclaredElementStation(i);
+        if (!std::isnan(declaredStation)) {
+            const double reference = result.ExternalStations ? alignment.ExternalStation(station) : station;
+            Report(result, ContinuityCheck::ElementStation, i, station, std::fabs(declaredStation - reference), tolerances.Length);
+        }
+    }
+
+    // Équations de station, rangées parmi les écarts des éléments par ordre de station
+    const StationEquationTable& equations = alignment.StationEquations();
+    for (std::size_t k = 0; k < equations.EquationCount(); ++k) {
+        const double station = equations.Equations()[k].StaInternal;
+        const std::size_t element = alignment.ElementCount() > 0 ? alignment.ElementIndex(station) : 0;
+        Report(result, ContinuityCheck::StationEquation, element, station, std::fabs(equations.StaBackDeviation(k)), tolerances.Length);
+    }
+    std::stable_sort(result.Issues.begin(), result.Issues.end(), [](const ContinuityIssue& a, const ContinuityIssue& b) {
+        return a.Station < b.Station;
+    });
+
+    Report(result, ContinuityCheck::AlignmentLength, alignment.ElementCount(), alignment.StaEnd(),
+           std::fabs(alignment.DeclaredLength() - alignment.Length()), tolerances.Length);
+    return result;
+}
+
+std::vector<FileContinuity> ContinuityValidator::ValidateFiles(std::span<const std::string> fileNames, const ContinuityTolerances& tolerances,
+                                                               unsigned threadCount) {
+    std::vector<FileContinuity> results(fileNames.size());
+    // Les fichiers ont des tailles très variables : distribution au fil de l'eau plutôt que par blocs.
+    // Chaque fichier est lu séquentiellement, le parallélisme portant sur les fichiers ; les erreurs de
+    // lecture sont rapportées par fichier.
+    BatchUtils::ParallelFor(fileNames.size(), threadCount, [&](std::size_t k) {
+        FileContinuity& result = results[k];
+        result.FileName = fileNames[k];
+        try {
+            const std::vector<Alignment> alignments = LandXML::LandXMLAlignmentLoader::ReadFile(fileNames[k], 1);
+            result.Alignments.reserve(alignments.size());
+            for (const Alignment& alignment : alignments) {
+                result.Alignments.push_back(Validate(alignment, tolerances));
+            }
+        } catch (const std::exception& ex) {
+            result.Error = ex.what();
+            result.Alignments.clear();
+        } catch (...) {
+            result.Error = "Unknown error";
+            result.Alignments.clear();
+        }
+    });
+    return results;
+}
+
+const char* ContinuityValidator::CheckName(ContinuityCheck check) {
+    switch (check) {
+    case ContinuityCheck::Position:
+        return "position";
+    case ContinuityCheck::Tangent:
+        return "tangent";
+    case ContinuityCheck::Curvature:
+        return "curvature";
+    case ContinuityCheck::ElementLength:
+        return "element_length";
+    case ContinuityCheck::ElementStation:
+        return "element_station";
+    case ContinuityCheck::StationEquation:
+        return "station_equation";
+    default:
+        return "alignment_length";
+    }
+}
+
+void ContinuityValidator::WriteJson(std::ostream& stream, std::span<const FileContinuity> files, const ContinuityTolerances& tolerances) {
+    std::size_t unreadable = 0, alignmentCount = 0, junctionCount = 0, issueCount = 0;
+    for (const FileContinuity& file : files) {
+        unreadable += file.Error.empty() ? 0 : 1;
+        alignmentCount += file.Alignments.size();
+        for (const AlignmentContinuity& alignment : file.Alignments) {
+            junctionCount += alignment.ElementCount > 0 ? alignment.ElementCount - 1 : 0;
+            issueCount += alignment.Issues.size();
+        }
+    }
+
+    stream << "{\n  \"tolerances\": {"
+           << "\"position\": " << JsonUtils::Number(tolerances.Position)
+           << ", \"angle\": " << JsonUtils::Number(tolerances.Angle)
+           << ", \"curvature\": " << JsonUtils::Number(tolerances.Curvature)
+           << ", \"length\": " << JsonUtils::Number(tolerances.Length) << "},\n"
+           << "  \"summary\": {"
+           << "\"files\": " << files.size()
+           << ", \"unreadable_files\": " << unreadable
+           << ", \"alignments\": " << alignmentCount
+           << ", \"junctions\": " << junctionCount
+           << ", \"issues\": " << issueCount << "},\n"
+           << "  \"files\": [";
+    for (std::size_t f = 0; f < files.size(); ++f) {
+        const FileContinuity& file = files[f];
+        stream << (f == 0 ? "\n" : ",\n")
+               << "    {\"file\": " << JsonUtils::String(file.FileName)
+               << ", \"error\": " << (file.Error.empty() ? std::string("null") : JsonUtils::String(file.Error))
+               << ", \"alignments\": [";
+        for (std::size_t a = 0; a < file.Alignments.size(); ++a) {
+            const AlignmentContinuity& alignment = file.Alignments[a];
+            stream << (a == 0 ? "\n" : ",\n")
+                   << "      {\"name\": " << JsonUtils::String(alignment.Name)
+                   << ", \"elements\": " << alignment.ElementCount
+                   << ", \"max_position_gap\": " << JsonUtils::Number(alignment.MaxPositionGap)
+                   << ", \"max_angle_gap\": " << JsonUtils::Number(alignment.MaxAngleGap)
+                   << ", \"max_curvature_jump\": " << JsonUtils::Number(alignment.MaxCurvatureJump)
+                   << ", \"external_stations\": " << (alignment.ExternalStations ? "true" : "false")
+                   << ", \"issues\": [";
+            for (std::size_t i = 0; i < alignment.Issues.size(); ++i) {
+                const ContinuityIssue& issue = alignment.Issues[i];
+                stream << (i == 0 ? "\n" : ",\n")
+                       << "        {\"check\": " << JsonUtils::String(CheckName(issue.Check))
+                       << ", \"element\": " << issue.Element
+                       << ", \"station\": " << JsonUtils::Number(issue.Station)
+                       << ", \"deviation\": " << JsonUtils::Number(issue.Deviation) << "}";
+            }
+            stream << (alignment.Issues.empty() ? "]}" : "\n      ]}");
+        }
+        stream << (file.Alignments.empty() ? "]}" : "\n    ]}");
+    }
+    stream << (files.empty() ? "]\n}\n" : "\n  ]\n}\n");
+}
+
+} // namespace LineaCore::Geometry::Alignments
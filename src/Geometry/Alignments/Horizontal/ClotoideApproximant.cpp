@@ -0,0 +1,202 @@
+// ClotoideApproximant.cpp
+
+#include "LineaCore/Geometry/Alignments/Horizontal/ClotoideApproximant.hpp"
+#include "LineaCore/Geometry/Alignments/BatchUtils.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numbers>
+
+namespace LineaCore::Geometry::Alignments::Horizontal {
+
+namespace {
+
+constexpr std::size_t N = ClotoideApproximant::Degree + 1;
+constexpr std::size_t ErrorSamplesPerSegment = 4 * N;   // Échantillonnage de vérification
+
+// Coefficients des polynômes de Tchebychev T0..T(N-1) dans la base des monômes
+constexpr std::array<std::array<double, N>, N> ChebyshevToMonomial() {
+    std::array<std::array<double, N>, N> t{};
+    t[0][0] = 1.0;
+    t[1][1] = 1.0;
+    for (std::size_t k = 2; k < N; ++k) {
+        for (std::size_t i = 0; i < N; ++i) {
+            t[k][i] = (i > 0 ? 2.0 * t[k - 1][i - 1] : 0.0) - t[k - 2][i];
+        }
+    }
+    return t;
+}
+
+constexpr auto Monomials = ChebyshevToMonomial();
+
+inline double Horner(const double* coefficients, double u) {
+    double p = coefficients[0];
+    for (std::size_t i = 1; i < N; ++i) {
+        p = p * u + coefficients[i];
+    }
+    return p;
+}
+
+// Interpolation aux nœuds de Tchebychev : valeurs aux nœuds → coefficients de Horner (degré décroissant)
+void Interpolate(const double* values, double* coefficients) {
+    std::array<double, N> chebyshev{};
+    for (std::size_t m = 0; m < N; ++m) {
+        double sum = 0.0;
+        for (std::size_t j = 0; j < N; ++j) {
+            sum += values[j] * std::cos(std::numbers::pi * m * (j + 0.5) / N);
+        }
+        chebyshev[m] = sum * (m == 0 ? 1.0 : 2.0) / N;
+    }
+    for (std::size_t i = 0; i < N; ++i) {
+        double sum = 0.0;
+        for (std::size_t m = i; m < N; ++m) {
+            sum += chebyshev[m] * Monomials[m][i];
+        }
+        coefficients[N - 1 - i] = sum;
+    }
+}
+
+} // namespace
+
+ClotoideApproximant::ClotoideApproximant()
+    : _length(0.0), _segmentScale(0.0), _segmentCount(0), _tolerance(0.0), _maxError(0.0) {}
+
+bool ClotoideApproximant::TryBuild(const ClotoideTransition& clotoide, double tolerance, ClotoideApproximant& approximant) {
+    if (!(tolerance > 0.0) || !(clotoide.Length() > 0.0)) {
+        return false;
+    }
+
+    ClotoideApproximant result;
+    result._clotoide = clotoide;
+    result._length = clotoide.Length();
+    result._tolerance = tolerance;
+    for (std::size_t segmentCount = 1; segmentCount <= MaxSegmentCount; segmentCount *= 2) {
+        result.Fit(segmentCount);
+        result._maxError = result.MeasureError();
+        if (result._maxError <= tolerance) {
+            approximant = std::move(result);
+            return true;
+        }
+    }
+    return false;
+}
+
+void ClotoideApproximant::Fit(std::size_t segmentCount) {
+    _segmentCount = segmentCount;
+    _segmentScale = segmentCount / _length;
+    _coefficients.assign(segmentCount * SegmentStride, 0.0);
+
+    const double h = _length / segmentCount;
+    std::vector<double> s(segmentCount * N);
+    for (std::size_t k = 0; k < segmentCount; ++k) {
+        for (std::size_t j = 0; j < N; ++j) {
+            const double u = std::cos(std::numbers::pi * (j + 0.5) / N);
+            s[k * N + j] = (k + (u + 1.0) / 2.0) * h;
+        }
+    }
+    std::vector<Point2D> points(s.size());
+    std::vector<Vector2D> normals(s.size());
+    _clotoide.Point(s, points);
+    _clotoide.Normal(s, normals);
+
+    std::array<double, N> x, y, nx, ny;
+    for (std::size_t k = 0; k < segmentCount; ++k) {
+        for (std::size_t j = 0; j < N; ++j) {
+            x[j] = points[k * N + j].X;
+            y[j] = points[k * N + j].Y;
+            nx[j] = normals[k * N + j].X;
+            ny[j] = normals[k * N + j].Y;
+        }
+        double* coefficients = &_coefficients[k * SegmentStride];
+        Interpolate(x.data(), coefficients);
+        Interpolate(y.data(), coefficients + N);
+        Interpolate(nx.data(), coefficients + 2 * N);
+        Interpolate(ny.data(), coefficients + 3 * N);
+    }
+}
+
+double ClotoideApproximant::MeasureError() const {
+    const double h = _length / _segmentCount;
+    std::vector<double> s;
+    s.reserve(_segmentCount * ErrorSamplesPerSegment + 1);
+    for (std::size_t k = 0; k < _segmentCount; ++k) {
+        for (std::size_t i = 0; i < ErrorSamplesPerSegment; ++i) {
+            s.push_back((k + static_cast<double>(i) / ErrorSamplesPerSegment) * h);
+        }
+    }
+    s.push_back(_length);
+
+    std::vector<Point2D> exactPoints(s.size()), points(s.size());
+    std::vector<Vector2D> exactNormals(s.size()), normals(s.size());
+    _clotoide.Point(s, exactPoints);
+    _clotoide.Normal(s, exactNormals);
+    Point(s, points);
+    Normal(s, normals);
+
+    double maxError = 0.0;
+    for (std::size_t i = 0; i < s.size(); ++i) {
+        maxError = std::max({maxError, (points[i] - exactPoints[i]).Length(), (normals[i] - exactNormals[i]).Length()});
+    }
+    return maxError;
+}
+
+const double* ClotoideApproximant::Segment(double s, double& u) const {
+    const double position = s * _segmentScale;
+    const std::size_t k = std::min(static_cast<std::size_t>(position), _segmentCount - 1);
+    u = 2.0 * (position - static_cast<double>(k)) - 1.0;
+    return &_coefficients[k * SegmentStride];
+}
+
+const ClotoideTransition& ClotoideApproximant::Clotoide() const {
+    return _clotoide;
+}
+
+double ClotoideApproximant::Length() const {
+    return _length;
+}
+
+std::size_t ClotoideApproximant::SegmentCount() const {
+    return _segmentCount;
+}
+
+double ClotoideApproximant::Tolerance() const {
+    return _tolerance;
+}
+
+double ClotoideApproximant::MaxError() const {
+    return _maxError;
+}
+
+Point2D ClotoideApproximant::Point(double s) const {
+    if (!(s >= 0.0 && s <= _length) || _segmentCount == 0) {
+        return _clotoide.Point(s);
+    }
+    double u;
+    const double* coefficients = Segment(s, u);
+    return Point2D(Horner(coefficients, u), Horner(coefficients + N, u));
+}
+
+Vector2D ClotoideApproximant::Normal(double s) const {
+    if (!(s >= 0.0 && s <= _length) || _segmentCount == 0) {
+        return _clotoide.Normal(s);
+    }
+    double u;
+    const double* coefficients = Segment(s, u);
+    return Vector2D(Horner(coefficients + 2 * N, u), Horner(coefficients + 3 * N, u));
+}
+
+void ClotoideApproximant::Point(std::span<const double> s, std::span<Point2D> points) const {
+    BatchUtils::CheckBatchSize(s.size(), points.size());
+    for (std::size_t i = 0; i < s.size(); ++i) {
+        points[i] = Point(s[i]);
+    }
+}
+
+void ClotoideApproximant::Normal(std::span<const double> s, std::span<Vector2D> normals) const {
+    BatchUtils::CheckBatchSize(s.size(), normals.size());
+    for (std::size_t i = 0; i < s.size(); ++i) {
+        normals[i] = Normal(s[i]);
+    }
+}
+
+} // namespace LineaCore::Geometry::Alignments::Horizontal
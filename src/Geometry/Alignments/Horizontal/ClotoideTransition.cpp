@@ -1,8 +1,13 @@
 // ClotoideTransition.cpp
 
 #include "LineaCore/Geometry/Alignments/Horizontal/ClotoideTransition.hpp"
+#include "LineaCore/Geometry/Alignments/BatchUtils.hpp"
+#include "LineaCore/Geometry/Alignments/Horizontal/FresnelKernel.hpp"
 #include "LineaCore/LandXML/XMLUtils.hpp"
 #include "LineaCore/Geometry/GeometryUtils.hpp"
+#include <algorithm>
+#include <limits>
+#include <numbers>
 
 namespace LineaCore::Geometry::Alignments::Horizontal {
 
@@ -12,118 +17,178 @@ ClotoideTransition::ClotoideTransition(double parameter, double startAbscissa, d
     SetExtremities();
 }
 
-bool ClotoideTransition::TryFromVectorAndCurvatures(const Point2D& startingPoint, const Vector2D& chordVector, 
-                                                    double startingCurvature, double endingCurvature, 
-                                                    ClotoideTransition& clotoideArc) {
-    double c = chordVector.Length();    //longueur de la Corde entre le point origine et le point de fin de la cloto, initialisé avec la longueur de vect
-    double l = c;                       //La longueur développée de la cloto, initialisé avec la longueur de la corde
-    double d;                           //Distance entre le point de début et de fin calculé sur la cloto
-    double dl = 0.0;                    //Ecart entre cette distance et la corde à obtenir 
-    double A2;                          //Carré du paramètre de la cloto (porte le signe de la courbure)
-    Point2D ptDebLoc, ptFinLoc;         //Point de début et de fin sur la cloto dans le repère local
-    Vector2D vOrient, vectRot, vectTra;
-
-    double A, sDeb, ds;
-
-    const double dlmax = 1E-14;
-
-    do {
-        l += dl;
-        A2 = l / (endingCurvature - startingCurvature);
-        A = std::sqrt(std::fabs(A2)) * (A2 > 0 ? 1.0 : -1.0);
-        sDeb = A2 * startingCurvature;
-        ptDebLoc = PtLoc(sDeb, A);   // Point sur la clothoïde
-        ptFinLoc = PtLoc(sDeb + l, A);
-
-        vOrient = ptFinLoc - ptDebLoc;
-        d = vOrient.Length();
-        dl = c - d;
-    } while (std::fabs(dl / l) >= dlmax);
-
-    ds = l;
-    vectRot = chordVector.InVectorialReference(vOrient) / (d * d);
+namespace {
+
+// Résolution de la longueur de corde d(b) = c, où b = |A|.
+// Sur la clotoïde unitaire F, les extrémités sont aux abscisses t0 = b·k0 et t1 = b·k1, donc
+// d(b) = b·|F(t1) - F(t0)| et d'(b) = |G| + b·(G·G')/|G| avec G = F(t1) - F(t0),
+// G' = k1·F'(t1) - k0·F'(t0) et F'(t) = (cos(t²/2), sin(t²/2)).
+// La longueur développée vaut l = b²·|k1 - k0|.
+struct ChordSolver {
+    double Chord;
+    double StartingCurvature, EndingCurvature;
+    double B, Low, High;   // Estimation et encadrement de la racine (High infini tant qu'il n'est pas trouvé)
+    double Residual;
+    int Iterations;
+    bool Done, Converged;
+
+    static constexpr int MaxIterations = 100;
+    static constexpr double Tolerance = 1E-14;
+
+    ChordSolver(double chord, double k0, double k1)
+        : Chord(chord), StartingCurvature(k0), EndingCurvature(k1), Low(0.0),
+          High(std::numeric_limits<double>::infinity()), Residual(0.0), Iterations(0), Done(false), Converged(false) {
+        B = std::sqrt(chord / std::fabs(k1 - k0));   // Longueur développée initiale égale à la corde
+        if (!(chord > 0.0) || !std::isfinite(B) || !(B > 0.0)) {
+            Done = true;
+        }
+    }
+
+    double T0() const { return B * StartingCurvature; }
+    double T1() const { return B * EndingCurvature; }
+
+    // Mise à jour à partir des points F(t0) et F(t1) de la clotoïde unitaire
+    void Step(double x0, double y0, double x1, double y1) {
+        ++Iterations;
+        const double gx = x1 - x0, gy = y1 - y0;
+        const double g = std::hypot(gx, gy);
+        const double f = B * g - Chord;
+        Residual = std::fabs(f) / Chord;
+        if (Residual < Tolerance) {
+            Done = Converged = true;
+            return;
+        }
+        (f < 0.0 ? Low : High) = B;
+
+        const double t0 = T0(), t1 = T1();
+        const double dgx = EndingCurvature * std::cos(t1 * t1 / 2.0) - StartingCurvature * std::cos(t0 * t0 / 2.0);
+        const double dgy = EndingCurvature * std::sin(t1 * t1 / 2.0) - StartingCurvature * std::sin(t0 * t0 / 2.0);
+        const double derivative = g + B * (gx * dgx + gy * dgy) / g;
+        double next = B - f / derivative;
+
+        if (std::isinf(High)) {
+            // Pas encore d'encadrement : Newton vers le haut, au plus en doublant
+            if (!(next > B)) {
+                next = 2.0 * B;
+            }
+            next = std::min(next, 2.0 * B);
+        } else if (!(next > Low && next < High)) {
+            next = (Low + High) / 2.0;
+        }
+
+        if (std::fabs(next - B) <= 4.0 * std::numeric_limits<double>::epsilon() * B) {
+            // Pas inférieur à la précision machine : la corde ne peut être approchée davantage
+            Done = true;
+            Converged = Residual < 1E-12;
+            return;
+        }
+        B = next;
+        if (Iterations >= MaxIterations) {
+            Done = true;
+        }
+    }
+};
+
+ClotoideTransition BuildFromSolution(const ClotoideFitInput& input, double b) {
+    const double k0 = input.StartingCurvature, k1 = input.EndingCurvature;
+    const double l = b * b * std::fabs(k1 - k0);
+    const double A2 = l / (k1 - k0);   // Carré du paramètre de la cloto (porte le signe de la courbure)
+    const double A = k1 > k0 ? b : -b;
+    const double sDeb = A2 * k0;
+
+    Point2D ptDebLoc = ClotoideTransition::PtLoc(sDeb, A);
+    const Point2D ptFinLoc = ClotoideTransition::PtLoc(sDeb + l, A);
+    const Vector2D vOrient = ptFinLoc - ptDebLoc;
+    const double d = vOrient.Length();
+
+    const Vector2D vectRot = input.ChordVector.InVectorialReference(vOrient) / (d * d);
     ptDebLoc = ptDebLoc.RotatedBy(vectRot);
-    vectTra = startingPoint - ptDebLoc;
+    const Vector2D vectTra = input.StartingPoint - ptDebLoc;
+    return ClotoideTransition(A, sDeb, l, vectRot, vectTra);
+}
+
+} // namespace
+
+bool ClotoideTransition::TryFromVectorAndCurvatures(const Point2D& startingPoint, const Vector2D& chordVector,
+                                                    double startingCurvature, double endingCurvature,
+                                                    ClotoideTransition& clotoideArc, ClotoideFitStatistics* statistics) {
+    const ClotoideFitInput input{startingPoint, chordVector, startingCurvature, endingCurvature};
+    ChordSolver solver(chordVector.Length(), startingCurvature, endingCurvature);
+    while (!solver.Done) {
+        double x0, y0, x1, y1;
+        FresnelKernel::Evaluate(solver.T0(), x0, y0);
+        FresnelKernel::Evaluate(solver.T1(), x1, y1);
+        solver.Step(x0, y0, x1, y1);
+    }
 
-    clotoideArc = ClotoideTransition(A, sDeb, ds, vectRot, vectTra);
+    if (statistics != nullptr) {
+        *statistics = ClotoideFitStatistics{solver.Iterations, solver.Residual, solver.Converged};
+    }
+    if (!solver.Converged) {
+        return false;
+    }
+    clotoideArc = BuildFromSolution(input, solver.B);
     return true;
 }
 
-Point2D ClotoideTransition::PtLoc(double s, double A)
-{
-        constexpr double TwoRootPi = 3.54490770181103;
-        constexpr double SqrtTwo = 1.41421356237309;
-        constexpr double RootPiOverTwo = 1.2533141373155;
-
-        s /= std::fabs(A); // Réduit l'abscisse curviligne sur la clotoïde unitaire
-        double absS = std::fabs(s);
-        double x, y;
-
-        if (absS > TwoRootPi) {
-            double t = absS / SqrtTwo;
-            double F = 1.0 / t;
-            double G = 0.5 / (t * t * t);
-
-            if (absS < 5.75) {
-                F -= 0.75 / (t * t * t * t * t);
-                G -= 1.875 / (t * t * t * t * t * t * t);
-                if (absS < 4.0) {
-                    F += 6.5625 / (t * t * t * t * t * t * t * t * t);
-                    G += 29.53125 / (t * t * t * t * t * t * t * t * t * t * t);
-                }
-            }
-
-            double t2 = t * t;
-            double cost2 = std::cos(t2);
-            double sint2 = std::sin(t2);
+bool ClotoideTransition::TryFromVectorAndCurvatures(std::span<const ClotoideFitInput> inputs, std::span<ClotoideTransition> clotoideArcs,
+                                                    std::span<ClotoideFitStatistics> statistics) {
+    BatchUtils::CheckBatchSize(inputs.size(), clotoideArcs.size());
+    if (!statistics.empty()) {
+        BatchUtils::CheckBatchSize(inputs.size(), statistics.size());
+    }
 
-            x = (RootPiOverTwo + F * sint2 - G * cost2) * SqrtTwo * std::copysign(1.0, s) / 2.0;
-            y = (RootPiOverTwo - F * cost2 - G * sint2) * SqrtTwo * std::copysign(1.0, s) / 2.0;
+    std::vector<ChordSolver> solvers;
+    solvers.reserve(inputs.size());
+    for (const ClotoideFitInput& input : inputs) {
+        solvers.emplace_back(input.ChordVector.Length(), input.StartingCurvature, input.EndingCurvature);
+    }
 
-        } else {
-            x = s;
-            y = (s * s * s) / 6.0;
-
-            if (absS > 0.0730965294187392) {
-                x -= (s * s * s * s * s) / 40.0;
-                y -= (s * s * s * s * s * s * s) / 336.0;
-                if (absS > 0.458853326351216) {
-                    x += (s * s * s * s * s * s * s * s * s) / 3456.0;
-                    y += (s * s * s * s * s * s * s * s * s * s * s) / 42240.0;
-                    if (absS > 0.844610123283693) {
-                        x -= (s * s * s * s * s * s * s * s * s * s * s * s * s) / 599040.0;
-                        y -= (s * s * s * s * s * s * s * s * s * s * s * s * s * s * s) / 9676800.0;
-                        if (absS > 1.23036692021617) {
-                            x += (s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s) / 175472640.0;
-                            y += (s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s) / 3530096640.0;
-                            if (absS > 1.61612371714865) {
-                                x -= (s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s) / 78033715200.0;
-                                y -= (s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s) / 1880240947200.0;
-                                if (absS > 2.00188051408112) {
-                                    x += (s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s) / 49049763840000.0;
-                                    y += (s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s) / 1377317368627200.0;
-                                    if (absS > 2.3876373110136) {
-                                        x -= (s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s) / 41421544567603200.0;
-                                        y -= (s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s) / 1328346084409344000.0;
-                                        if (absS > 2.77339410794608) {
-                                            x += (s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s) / 45249466617298944000.0;
-                                            y += (s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s) / 1631723190138961920000.0;
-                                            if (absS > 3.15915090487856) {
-                                                x -= (s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s) / 62098722550431436800000.0;
-                                                y -= (s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s * s) / 248730558972268544000000.0;
-                                            }
-                                        }
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
+    // Itérations simultanées : les abscisses de toutes les clotoïdes actives sont évaluées en un lot
+    std::vector<std::size_t> active;
+    std::vector<double> t, x, y;
+    while (true) {
+        active.clear();
+        for (std::size_t i = 0; i < solvers.size(); ++i) {
+            if (!solvers[i].Done) {
+                active.push_back(i);
             }
         }
+        if (active.empty()) {
+            break;
+        }
+        t.resize(2 * active.size());
+        x.resize(t.size());
+        y.resize(t.size());
+        for (std::size_t j = 0; j < active.size(); ++j) {
+            t[2 * j] = solvers[active[j]].T0();
+            t[2 * j + 1] = solvers[active[j]].T1();
+        }
+        FresnelKernel::Evaluate(t, x, y);
+        for (std::size_t j = 0; j < active.size(); ++j) {
+            solvers[active[j]].Step(x[2 * j], y[2 * j], x[2 * j + 1], y[2 * j + 1]);
+        }
+    }
 
-        return Point2D(x * std::fabs(A), y * A);
+    bool succeeded = true;
+    for (std::size_t i = 0; i < solvers.size(); ++i) {
+        if (!statistics.empty()) {
+            statistics[i] = ClotoideFitStatistics{solvers[i].Iterations, solvers[i].Residual, solvers[i].Converged};
+        }
+        if (solvers[i].Converged) {
+            clotoideArcs[i] = BuildFromSolution(inputs[i], solvers[i].B);
+        } else {
+            succeeded = false;
+        }
+    }
+    return succeeded;
+}
 
+Point2D ClotoideTransition::PtLoc(double s, double A)
+{
+    double x, y;
+    FresnelKernel::Evaluate(s / std::fabs(A), x, y); // Réduit l'abscisse curviligne sur la clotoïde unitaire
+    return Point2D(x * std::fabs(A), y * A);
 }
 
 bool ClotoideTransition::IsCounterClockWise() const
@@ -148,6 +213,22 @@ double ClotoideTransition::Length() const {
     return _ds;
 }
 
+double ClotoideTransition::Parameter() const {
+    return _A;
+}
+
+double ClotoideTransition::StartAbscissa() const {
+    return _startAbscissa;
+}
+
+const Vector2D& ClotoideTransition::RotationVector() const {
+    return _rotationVector;
+}
+
+const Vector2D& ClotoideTransition::TranslationVector() const {
+    return _translationVector;
+}
+
 Point2D ClotoideTransition::Point(double s) const {
     return PtLoc(_startAbscissa + s, _A).RotatedBy(_rotationVector) + _translationVector;
 }
@@ -162,25 +243,170 @@ double ClotoideTransition::Curvature(double s) const {
     return (_startAbscissa + s) / _A / std::fabs(_A);
 }
 
-std::vector<Point2D> ClotoideTransition::Points(double maxThrow) const {
-    int N = static_cast<int>(std::ceil((_ds * _ds) / (4 * std::fabs(_A) * std::sqrt(2 * _ds * maxThrow)))) + 1;
-    double dTetha = (_ds * _ds) / (N * 2 * _A * _A);
-    std::vector<Point2D> points(N + 1);
-    double s = 0;
+void ClotoideTransition::Point(std::span<const double> s, std::span<Point2D> points) const {
+    BatchUtils::CheckBatchSize(s.size(), points.size());
 
-    for (int i = 0; i < N; ++i) {
-        points[i] = Point(std::fabs(s + _startAbscissa));
-        s = std::sqrt(s * s + 2 * _A * _A * dTetha);
+    // Évaluation par blocs sur la clotoïde unitaire avec le noyau vectoriel, sans allocation
+    constexpr std::size_t BlockSize = 256;
+    double t[BlockSize], x[BlockSize], y[BlockSize];
+    const double absA = std::fabs(_A);
+
+    for (std::size_t first = 0; first < s.size(); first += BlockSize) {
+        const std::size_t count = std::min(BlockSize, s.size() - first);
+        for (std::size_t i = 0; i < count; ++i) {
+            t[i] = (_startAbscissa + s[first + i]) / absA;
+        }
+        FresnelKernel::Evaluate(std::span<const double>(t, count), std::span<double>(x, count), std::span<double>(y, count));
+        for (std::size_t i = 0; i < count; ++i) {
+            const double xLoc = x[i] * absA;
+            const double yLoc = y[i] * _A;
+            points[first + i].X = (xLoc * _rotationVector.X - yLoc * _rotationVector.Y) + _translationVector.X;
+            points[first + i].Y = (yLoc * _rotationVector.X + xLoc * _rotationVector.Y) + _translationVector.Y;
+        }
     }
+}
 
-    s = _ds;
-    points[N] = Point(std::fabs(s + _startAbscissa));
+void ClotoideTransition::Normal(std::span<const double> s, std::span<Vector2D> normals) const {
+    BatchUtils::CheckBatchSize(s.size(), normals.size());
+    const double rotationAngle = _rotationVector.AngleMinusPiPi();
+    for (std::size_t i = 0; i < s.size(); ++i) {
+        const double sLocal = _startAbscissa + s[i];
+        const double AngVectTang = rotationAngle + (sLocal * sLocal) / _A / std::fabs(_A) / 2.0;
+        normals[i].X = std::sin(AngVectTang);
+        normals[i].Y = -std::cos(AngVectTang);
+    }
+}
 
-    return points;
+void ClotoideTransition::Curvature(std::span<const double> s, std::span<double> curvatures) const {
+    BatchUtils::CheckBatchSize(s.size(), curvatures.size());
+    for (std::size_t i = 0; i < s.size(); ++i) {
+        curvatures[i] = (_startAbscissa + s[i]) / _A / std::fabs(_A);
+    }
 }
 
-void ClotoideTransition::ReadLandXML(xmlTextReaderPtr reader) {
-    double length = LandXML::XMLUtils::ReadAttributeAsDouble(reader, "length");
+BoundingBox ClotoideTransition::Bounds() const {
+    BoundingBox box;
+    box.Extend(startingPoint);
+    box.Extend(endingPoint);
+
+    // Le cap φ(u) = φ0 + u²/(2A|A|) est monotone de part et d'autre du point d'inflexion u = 0 : les
+    // abscisses et ordonnées extrêmes sont atteintes aux abscisses où le cap est un multiple de π/2,
+    // obtenues directement par u² = 2A|A|(kπ/2 - φ0).
+    constexpr double Quarter = std::numbers::pi / 2.0;
+    const double u0 = _startAbscissa;
+    const double u1 = _startAbscissa + _ds;
+    const double rate = 1.0 / (2.0 * _A * std::fabs(_A));
+    const double phi0 = _rotationVector.AngleMinusPiPi();
+    const double minSquare = (u0 <= 0.0 && u1 >= 0.0) ? 0.0 : std::min(u0 * u0, u1 * u1);
+    const double maxSquare = std::max(u0 * u0, u1 * u1);
+    const double phiA = phi0 + rate * minSquare;
+    const double phiB = phi0 + rate * maxSquare;
+    const long long first = static_cast<long long>(std::ceil(std::min(phiA, phiB) / Quarter));
+    const long long last = static_cast<long long>(std::floor(std::max(phiA, phiB) / Quarter));
+    for (long long k = first; k <= last; ++k) {
+        const double square = (static_cast<double>(k) * Quarter - phi0) / rate;
+        if (square < 0.0) {
+            continue;
+        }
+        const double u = std::sqrt(square);
+        if (u >= u0 && u <= u1) {
+            box.Extend(Point(u - u0));
+        }
+        if (-u >= u0 && -u <= u1) {
+            box.Extend(Point(-u - u0));
+        }
+    }
+    return box;
+}
+
+double ClotoideTransition::Projection(const Point2D& point, double sSeed) const {
+    // Point et tangente en s, calculés dans le repère local puis tournés (sans atan2)
+    const Vector2D rotation = _rotationVector.Normalized();
+    const double A2 = _A * std::fabs(_A);
+    auto evaluate = [&](double s, Point2D& p, Vector2D& tangent) {
+        const double sLocal = _startAbscissa + s;
+        p = Point(s);
+        const double phi = sLocal * sLocal / A2 / 2.0;
+        tangent = static_cast<Vector2D>(Point2D(std::cos(phi), std::sin(phi)).RotatedBy(rotation));
+    };
+    // Dérivée (au facteur 2 près) de la distance au carré : (P(s) - point)·T(s)
+    auto derivative = [&](double s) {
+        Point2D p;
+        Vector2D tangent;
+        evaluate(s, p, tangent);
+        return (p - point) * tangent;
+    };
+
+    // Newton sur (P(s) - point)·T(s) = 0, dont la dérivée vaut 1 + κ(s)·(P(s) - point)·N(s),
+    // N(s) étant la normale à gauche. La convergence étant quadratique, le dernier pas appliqué
+    // laisse une erreur très inférieure à la tolérance, qui doit rester au-dessus du bruit
+    // d'arrondi des coordonnées globales.
+    const double tolerance = 1E-9 * std::max(1.0, _ds);
+    double s = std::clamp(sSeed, 0.0, _ds);
+    bool converged = false;
+    for (int iteration = 0; iteration < 16; ++iteration) {
+        Point2D p;
+        Vector2D tangent;
+        evaluate(s, p, tangent);
+        const Vector2D d = p - point;
+        const double g = d * tangent;
+        const double dg = 1.0 + Curvature(s) * (d * tangent.Rotated90CounterClockWise());
+        if (!(dg > 0.0)) {
+            break; // Point au-delà du centre de courbure : minimum non garanti
+        }
+        const double next = std::clamp(s - g / dg, 0.0, _ds);
+        const double step = next - s;
+        s = next;
+        if (std::fabs(step) <= tolerance) {
+            converged = true;
+            break;
+        }
+    }
+
+    if (!converged) {
+        // Repli sur une recherche de racine encadrée
+        s = 0.0;
+        if (derivative(0.0) < 0.0 && derivative(_ds) > 0.0) {
+            Point2D root = GeometryUtils::BrentFunctionValue(0.0, _ds, 0.0, _ds, derivative, nullptr);
+            if (!root.IsNaN()) {
+                s = root.X;
+            }
+        }
+    }
+
+    // Le minimum peut se trouver à une extrémité
+    const Vector2D d = Point(s) - point;
+    double best = s;
+    double bestDistance = d * d;
+    const Vector2D dStart = startingPoint - point;
+    const Vector2D dEnd = endingPoint - point;
+    if (dStart * dStart < bestDistance) {
+        best = 0.0;
+        bestDistance = dStart * dStart;
+    }
+    if (dEnd * dEnd < bestDistance) {
+        best = _ds;
+    }
+    return best;
+}
+
+std::size_t ClotoideTransition::PointCount(double maxThrow) const {
+    // Segments de même longueur, bornés par la courbure maximale de l'élément
+    return ChordSegmentCount(maxThrow) + 1;
+}
+
+void ClotoideTransition::Points(double maxThrow, std::span<Point2D> points) const {
+    CheckPointCount(PointCount(maxThrow), points.size());
+    // Abscisses uniformes évaluées par lots (noyau vectoriel) ; tampon réutilisé par thread
+    thread_local std::vector<double> abscissas;
+    abscissas.resize(points.size());
+    UniformAbscissas(_ds, abscissas);
+    Point(abscissas, points);
+}
+
+ClotoideFitInput ClotoideTransition::ReadFitInput(xmlTextReaderPtr reader) {
+    // Attribut obligatoire, contrôlé seulement : la longueur est recalculée par l'ajustement
+    LandXML::XMLUtils::ReadAttributeAsDouble(reader, "length");
     double radiusEnd = LandXML::XMLUtils::ReadAttributeAsDouble(reader, "radiusEnd");
     if (radiusEnd == 0) {
         throw std::runtime_error("Attribute 'radiusEnd' value cannot be zero in Element <Spiral>");
@@ -228,7 +454,12 @@ void ClotoideTransition::ReadLandXML(xmlTextReaderPtr reader) {
     double startCurvature = radiusStart == std::numeric_limits<double>::infinity() ? 0.0 : sens / radiusStart;
     double endCurvature = radiusEnd == std::numeric_limits<double>::infinity() ? 0.0 : sens / radiusEnd;
 
-    if (!TryFromVectorAndCurvatures(start, end - start, startCurvature, endCurvature, *this)) {
+    return ClotoideFitInput{start, end - start, startCurvature, endCurvature};
+}
+
+void ClotoideTransition::ReadLandXML(xmlTextReaderPtr reader) {
+    const ClotoideFitInput input = ReadFitInput(reader);
+    if (!TryFromVectorAndCurvatures(input.StartingPoint, input.ChordVector, input.StartingCurvature, input.EndingCurvature, *this)) {
         throw std::runtime_error("Clothoid Spiral could not be defined from the given values in Element <Spiral>");
     }
 
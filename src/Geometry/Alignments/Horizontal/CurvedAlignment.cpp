@@ -1,9 +1,12 @@
 // CurvedAlignment.cpp
 
 #include "LineaCore/Geometry/Alignments/Horizontal/CurvedAlignment.hpp"
+#include "LineaCore/Geometry/Alignments/BatchUtils.hpp"
 #include "LineaCore/LandXML/XMLUtils.hpp"
 #include <cmath>
 #include <stdexcept>
+#include <algorithm>
+#include <numbers>
 
 namespace LineaCore::Geometry::Alignments::Horizontal {
 
@@ -27,6 +30,14 @@ double CurvedAlignment::SignedRadius() const {
     return _sens * _absR;
 }
 
+const Point2D& CurvedAlignment::CenterPoint() const {
+    return _centerPoint;
+}
+
+double CurvedAlignment::StartAngle() const {
+    return _angDeb;
+}
+
 Point2D CurvedAlignment::Point(double s) const {
     return pointFromAngle(angle(s));
 }
@@ -39,21 +50,92 @@ double CurvedAlignment::Curvature(double /*s*/) const {
     return _sens / _absR;
 }
 
-std::vector<Point2D> CurvedAlignment::Points(double maxThrow) const {
-    int n = static_cast<int>(std::ceil(_ds / (_absR * 2.0 * std::acos(1.0 - maxThrow / _absR)))) + 1;
-    double dTheta = _ds / _absR / n;
+void CurvedAlignment::Point(std::span<const double> s, std::span<Point2D> points) const {
+    BatchUtils::CheckBatchSize(s.size(), points.size());
+    for (std::size_t i = 0; i < s.size(); ++i) {
+        const double a = _angDeb + _sens * s[i] / _absR;
+        points[i].X = _centerPoint.X + std::cos(a) * _absR;
+        points[i].Y = _centerPoint.Y + std::sin(a) * _absR;
+    }
+}
 
-    std::vector<Point2D> points;
-    points.reserve(n + 1);
+void CurvedAlignment::Normal(std::span<const double> s, std::span<Vector2D> normals) const {
+    BatchUtils::CheckBatchSize(s.size(), normals.size());
+    for (std::size_t i = 0; i < s.size(); ++i) {
+        const double a = _angDeb + _sens * s[i] / _absR;
+        normals[i].X = std::cos(a);
+        normals[i].Y = std::sin(a);
+    }
+}
+
+void CurvedAlignment::Curvature(std::span<const double> s, std::span<double> curvatures) const {
+    BatchUtils::CheckBatchSize(s.size(), curvatures.size());
+    std::fill(curvatures.begin(), curvatures.end(), _sens / _absR);
+}
+
+double CurvedAlignment::Projection(const Point2D& point, double /*sSeed*/) const {
+    Vector2D v = point - _centerPoint;
+    if (v.X == 0.0 && v.Y == 0.0) {
+        return 0.0; // Centre de l'arc : tous les points sont équidistants
+    }
+
+    // Angle parcouru depuis le début de l'arc dans le sens de l'arc, ramené dans [0, 2π)
+    constexpr double TwoPi = 2.0 * std::numbers::pi;
+    double delta = std::fmod(_sens * (v.Angle02Pi() - _angDeb), TwoPi);
+    if (delta < 0.0) {
+        delta += TwoPi;
+    }
+
+    double sweep = _ds / _absR;
+    if (delta <= sweep) {
+        return delta * _absR;
+    }
+    // Hors de l'arc : extrémité la plus proche angulairement
+    return (delta - sweep < TwoPi - delta) ? _ds : 0.0;
+}
+
+BoundingBox CurvedAlignment::Bounds() const {
+    BoundingBox box;
+    box.Extend(startingPoint);
+    box.Extend(endingPoint);
+
+    // Points extrêmes du cercle (angles multiples de π/2) compris dans le secteur parcouru ; au-delà
+    // d'un tour complet, les quatre sont atteints
+    constexpr double Quarter = std::numbers::pi / 2.0;
+    const double a0 = std::min(_angDeb, angle(_ds));
+    const double a1 = std::max(_angDeb, angle(_ds));
+    const long long first = static_cast<long long>(std::ceil(a0 / Quarter));
+    const long long last = std::min(static_cast<long long>(std::floor(a1 / Quarter)), first + 3);
+    for (long long k = first; k <= last; ++k) {
+        switch (((k % 4) + 4) % 4) {
+        case 0: box.Extend(Point2D(_centerPoint.X + _absR, _centerPoint.Y)); break;
+        case 1: box.Extend(Point2D(_centerPoint.X, _centerPoint.Y + _absR)); break;
+        case 2: box.Extend(Point2D(_centerPoint.X - _absR, _centerPoint.Y)); break;
+        default: box.Extend(Point2D(_centerPoint.X, _centerPoint.Y - _absR)); break;
+        }
+    }
+    return box;
+}
+
+std::size_t CurvedAlignment::PointCount(double maxThrow) const {
+    CheckMaxThrow(maxThrow);
+    // Demi-angle au centre d'une corde de flèche maxThrow, limité au quart de cercle
+    const double halfAngle = maxThrow >= _absR ? std::numbers::pi / 2.0 : std::acos(1.0 - maxThrow / _absR);
+    const double count = std::ceil(_ds / (_absR * 2.0 * halfAngle));
+    return (count > 1.0 ? static_cast<std::size_t>(count) : 1) + 1;
+}
+
+void CurvedAlignment::Points(double maxThrow, std::span<Point2D> points) const {
+    CheckPointCount(PointCount(maxThrow), points.size());
+    const std::size_t n = points.size() - 1;
+    double dTheta = _ds / _absR / n;
 
     double theta = _angDeb;
-    for (int i = 0; i < n; ++i) {
-        points.push_back(pointFromAngle(theta));
+    for (std::size_t i = 0; i < n; ++i) {
+        points[i] = pointFromAngle(theta);
         theta += _sens * dTheta;
     }
-    points.push_back(Point(_ds));
-
-    return points;
+    points[n] = Point(_ds);
 }
 
 void CurvedAlignment::ReadLandXML(xmlTextReaderPtr reader) {
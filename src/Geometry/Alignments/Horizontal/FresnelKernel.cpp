@@ -0,0 +1,348 @@
+// FresnelKernel.cpp
+
+#include "LineaCore/Geometry/Alignments/Horizontal/FresnelKernel.hpp"
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+#include <stdexcept>
+#include <string>
+
+#if (defined(__x86_64__) || defined(__i386__) || defined(_M_X64)) && (defined(__GNUC__) || defined(_MSC_VER))
+#define LINEACORE_FRESNEL_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define LINEACORE_TARGET(features)
+#else
+#define LINEACORE_TARGET(features) __attribute__((target(features)))
+#endif
+#endif
+
+namespace LineaCore::Geometry::Alignments::Horizontal {
+
+namespace {
+
+constexpr double TwoRootPi = 3.54490770181103;                  // Limite entre la série et le développement asymptotique
+constexpr double SqrtTwo = std::numbers::sqrt2;
+constexpr double RootPiOverTwo = 1.2533141373155002512;         // √(π/2)
+
+// Coefficients de x(t) = t·P(t⁴) : (-1)^n / ((4n+1)·(2n)!·2^2n)
+constexpr double P[10] = {
+    1.0,
+    -1.0 / 40.0,
+    1.0 / 3456.0,
+    -1.0 / 599040.0,
+    1.0 / 175472640.0,
+    -1.0 / 78033715200.0,
+    1.0 / 49049763840000.0,
+    -1.0 / 41421544567603200.0,
+    1.0 / 45249466617298944000.0,
+    -1.0 / 62098722550431350784000.0
+};
+
+// Coefficients de y(t) = t³·Q(t⁴) : (-1)^n / ((4n+3)·(2n+1)!·2^(2n+1))
+constexpr double Q[10] = {
+    1.0 / 6.0,
+    -1.0 / 336.0,
+    1.0 / 42240.0,
+    -1.0 / 9676800.0,
+    1.0 / 3530096640.0,
+    -1.0 / 1880240947200.0,
+    1.0 / 1377317368627200.0,
+    -1.0 / 1328346084409344000.0,
+    1.0 / 1631723190138961920000.0,
+    -1.0 / 2487305589722682753024000.0
+};
+
+// Développement asymptotique avec w = |t|/√2, r = 1/w et v = r⁴ :
+// F = r·(1 + v·(F1 + v·F2)), G = r³·(G0 + v·(G1 + v·G2))
+constexpr double F1 = -0.75;
+constexpr double F2 = 6.5625;
+constexpr double G0 = 0.5;
+constexpr double G1 = -1.875;
+constexpr double G2 = 29.53125;
+
+inline double Horner(const double (&c)[10], double u)
+{
+    double p = c[9];
+    for (int k = 8; k >= 0; --k) {
+        p = p * u + c[k];
+    }
+    return p;
+}
+
+inline void Series(double t, double& x, double& y)
+{
+    double t2 = t * t;
+    double u = t2 * t2;
+    x = t * Horner(P, u);
+    y = t2 * t * Horner(Q, u);
+}
+
+inline void Asymptotic(double t, double& x, double& y)
+{
+    double w = std::fabs(t) / SqrtTwo;
+    double r = 1.0 / w;
+    double r2 = r * r;
+    double v = r2 * r2;
+    double F = r * (1.0 + v * (F1 + v * F2));
+    double G = r2 * r * (G0 + v * (G1 + v * G2));
+
+    double w2 = w * w;
+    double cosw2 = std::cos(w2);
+    double sinw2 = std::sin(w2);
+    double k = SqrtTwo * std::copysign(1.0, t) / 2.0;
+
+    x = (RootPiOverTwo + F * sinw2 - G * cosw2) * k;
+    y = (RootPiOverTwo - F * cosw2 - G * sinw2) * k;
+}
+
+void EvaluateScalar(const double* t, double* x, double* y, std::size_t n)
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        FresnelKernel::Evaluate(t[i], x[i], y[i]);
+    }
+}
+
+#ifdef LINEACORE_FRESNEL_X86
+
+LINEACORE_TARGET("avx2,fma")
+inline void EvaluateBlockAVX2(const double* t, double* x, double* y)
+{
+    const __m256d vt = _mm256_loadu_pd(t);
+    const __m256d t2 = _mm256_mul_pd(vt, vt);
+    const __m256d u = _mm256_mul_pd(t2, t2);
+
+    __m256d p = _mm256_set1_pd(P[9]);
+    __m256d q = _mm256_set1_pd(Q[9]);
+    for (int k = 8; k >= 0; --k) {
+        p = _mm256_fmadd_pd(p, u, _mm256_set1_pd(P[k]));
+        q = _mm256_fmadd_pd(q, u, _mm256_set1_pd(Q[k]));
+    }
+    __m256d vx = _mm256_mul_pd(vt, p);
+    __m256d vy = _mm256_mul_pd(_mm256_mul_pd(t2, vt), q);
+
+    const __m256d signBit = _mm256_set1_pd(-0.0);
+    const __m256d absT = _mm256_andnot_pd(signBit, vt);
+    const __m256d mask = _mm256_cmp_pd(absT, _mm256_set1_pd(TwoRootPi), _CMP_GT_OQ);
+
+    // Le développement asymptotique n'est calculé que si une voie au moins le requiert
+    if (_mm256_movemask_pd(mask) != 0) {
+        const __m256d w = _mm256_div_pd(absT, _mm256_set1_pd(SqrtTwo));
+        const __m256d r = _mm256_div_pd(_mm256_set1_pd(1.0), w);
+        const __m256d r2 = _mm256_mul_pd(r, r);
+        const __m256d v = _mm256_mul_pd(r2, r2);
+        const __m256d F = _mm256_mul_pd(r, _mm256_fmadd_pd(v, _mm256_fmadd_pd(v, _mm256_set1_pd(F2), _mm256_set1_pd(F1)), _mm256_set1_pd(1.0)));
+        const __m256d G = _mm256_mul_pd(_mm256_mul_pd(r2, r), _mm256_fmadd_pd(v, _mm256_fmadd_pd(v, _mm256_set1_pd(G2), _mm256_set1_pd(G1)), _mm256_set1_pd(G0)));
+
+        alignas(32) double w2[4], cosw2[4], sinw2[4];
+        _mm256_store_pd(w2, _mm256_mul_pd(w, w));
+        for (int j = 0; j < 4; ++j) {
+            cosw2[j] = std::cos(w2[j]);
+            sinw2[j] = std::sin(w2[j]);
+        }
+        const __m256d c = _mm256_load_pd(cosw2);
+        const __m256d s = _mm256_load_pd(sinw2);
+        const __m256d k = _mm256_or_pd(_mm256_and_pd(signBit, vt), _mm256_set1_pd(SqrtTwo / 2.0));
+        const __m256d base = _mm256_set1_pd(RootPiOverTwo);
+
+        const __m256d ax = _mm256_mul_pd(_mm256_fnmadd_pd(G, c, _mm256_fmadd_pd(F, s, base)), k);
+        const __m256d ay = _mm256_mul_pd(_mm256_fnmadd_pd(G, s, _mm256_fnmadd_pd(F, c, base)), k);
+        vx = _mm256_blendv_pd(vx, ax, mask);
+        vy = _mm256_blendv_pd(vy, ay, mask);
+    }
+
+    _mm256_storeu_pd(x, vx);
+    _mm256_storeu_pd(y, vy);
+}
+
+LINEACORE_TARGET("avx2,fma")
+void EvaluateAVX2(const double* t, double* x, double* y, std::size_t n)
+{
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        EvaluateBlockAVX2(t + i, x + i, y + i);
+    }
+    if (i < n) {
+        // Fin de tableau complétée par des zéros pour rester sur le même noyau
+        double tt[4] = {0.0, 0.0, 0.0, 0.0}, xx[4], yy[4];
+        for (std::size_t j = i; j < n; ++j) {
+            tt[j - i] = t[j];
+        }
+        EvaluateBlockAVX2(tt, xx, yy);
+        for (std::size_t j = i; j < n; ++j) {
+            x[j] = xx[j - i];
+            y[j] = yy[j - i];
+        }
+    }
+}
+
+LINEACORE_TARGET("avx512f")
+void EvaluateAVX512(const double* t, double* x, double* y, std::size_t n)
+{
+    const __m512d signBit = _mm512_set1_pd(-0.0);
+    for (std::size_t i = 0; i < n; i += 8) {
+        const __mmask8 lanes = (n - i >= 8) ? static_cast<__mmask8>(0xFF) : static_cast<__mmask8>((1u << (n - i)) - 1u);
+        const __m512d vt = _mm512_maskz_loadu_pd(lanes, t + i);
+        const __m512d t2 = _mm512_mul_pd(vt, vt);
+        const __m512d u = _mm512_mul_pd(t2, t2);
+
+        __m512d p = _mm512_set1_pd(P[9]);
+        __m512d q = _mm512_set1_pd(Q[9]);
+        for (int k = 8; k >= 0; --k) {
+            p = _mm512_fmadd_pd(p, u, _mm512_set1_pd(P[k]));
+            q = _mm512_fmadd_pd(q, u, _mm512_set1_pd(Q[k]));
+        }
+        __m512d vx = _mm512_mul_pd(vt, p);
+        __m512d vy = _mm512_mul_pd(_mm512_mul_pd(t2, vt), q);
+
+        const __m512d absT = _mm512_abs_pd(vt);
+        const __mmask8 mask = _mm512_cmp_pd_mask(absT, _mm512_set1_pd(TwoRootPi), _CMP_GT_OQ) & lanes;
+
+        if (mask != 0) {
+            const __m512d w = _mm512_div_pd(absT, _mm512_set1_pd(SqrtTwo));
+            const __m512d r = _mm512_div_pd(_mm512_set1_pd(1.0), w);
+            const __m512d r2 = _mm512_mul_pd(r, r);
+            const __m512d v = _mm512_mul_pd(r2, r2);
+            const __m512d F = _mm512_mul_pd(r, _mm512_fmadd_pd(v, _mm512_fmadd_pd(v, _mm512_set1_pd(F2), _mm512_set1_pd(F1)), _mm512_set1_pd(1.0)));
+            const __m512d G = _mm512_mul_pd(_mm512_mul_pd(r2, r), _mm512_fmadd_pd(v, _mm512_fmadd_pd(v, _mm512_set1_pd(G2), _mm512_set1_pd(G1)), _mm512_set1_pd(G0)));
+
+            alignas(64) double w2[8], cosw2[8], sinw2[8];
+            _mm512_store_pd(w2, _mm512_mul_pd(w, w));
+            for (int j = 0; j < 8; ++j) {
+                cosw2[j] = std::cos(w2[j]);
+                sinw2[j] = std::sin(w2[j]);
+            }
+            const __m512d c = _mm512_load_pd(cosw2);
+            const __m512d s = _mm512_load_pd(sinw2);
+            const __m512d k = _mm512_castsi512_pd(_mm512_or_epi64(
+                _mm512_and_epi64(_mm512_castpd_si512(signBit), _mm512_castpd_si512(vt)),
+                _mm512_castpd_si512(_mm512_set1_pd(SqrtTwo / 2.0))));
+            const __m512d base = _mm512_set1_pd(RootPiOverTwo);
+
+            const __m512d ax = _mm512_mul_pd(_mm512_fnmadd_pd(G, c, _mm512_fmadd_pd(F, s, base)), k);
+            const __m512d ay = _mm512_mul_pd(_mm512_fnmadd_pd(G, s, _mm512_fnmadd_pd(F, c, base)), k);
+            vx = _mm512_mask_blend_pd(mask, vx, ax);
+            vy = _mm512_mask_blend_pd(mask, vy, ay);
+        }
+
+        _mm512_mask_storeu_pd(x + i, lanes, vx);
+        _mm512_mask_storeu_pd(y + i, lanes, vy);
+    }
+}
+
+#if defined(_MSC_VER) && !defined(__clang__)
+bool CpuSupports(FresnelKernel::Implementation implementation)
+{
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) {
+        return false;
+    }
+    __cpuid(info, 1);
+    const bool osxsave = (info[2] & (1 << 27)) != 0;
+    const bool fma = (info[2] & (1 << 12)) != 0;
+    if (!osxsave) {
+        return false;
+    }
+    const unsigned long long xcr0 = _xgetbv(0);
+    __cpuidex(info, 7, 0);
+    if (implementation == FresnelKernel::Implementation::AVX2) {
+        return fma && (info[1] & (1 << 5)) != 0 && (xcr0 & 0x6) == 0x6;
+    }
+    return (info[1] & (1 << 16)) != 0 && (xcr0 & 0xE6) == 0xE6;
+}
+#else
+bool CpuSupports(FresnelKernel::Implementation implementation)
+{
+    __builtin_cpu_init();
+    if (implementation == FresnelKernel::Implementation::AVX2) {
+        return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    }
+    return __builtin_cpu_supports("avx512f");
+}
+#endif
+
+#endif // LINEACORE_FRESNEL_X86
+
+void CheckSizes(std::size_t n, std::size_t nx, std::size_t ny)
+{
+    if (nx != n || ny != n) {
+        throw std::runtime_error("Fresnel kernel output sizes (" + std::to_string(nx) + ", " + std::to_string(ny) +
+                                 ") do not match the number of abscissas (" + std::to_string(n) + ")");
+    }
+}
+
+} // namespace
+
+void FresnelKernel::Evaluate(double t, double& x, double& y)
+{
+    // Un seul test, bien prédit, remplace la cascade de seuils de la série tronquée
+    if (std::fabs(t) > TwoRootPi) {
+        Asymptotic(t, x, y);
+    } else {
+        Series(t, x, y);
+    }
+}
+
+void FresnelKernel::Evaluate(std::span<const double> t, std::span<double> x, std::span<double> y)
+{
+    Evaluate(ActiveImplementation(), t, x, y);
+}
+
+void FresnelKernel::Evaluate(Implementation implementation, std::span<const double> t, std::span<double> x, std::span<double> y)
+{
+    CheckSizes(t.size(), x.size(), y.size());
+    switch (implementation) {
+#ifdef LINEACORE_FRESNEL_X86
+    case Implementation::AVX512:
+        if (IsSupported(Implementation::AVX512)) {
+            EvaluateAVX512(t.data(), x.data(), y.data(), t.size());
+            return;
+        }
+        break;
+    case Implementation::AVX2:
+        if (IsSupported(Implementation::AVX2)) {
+            EvaluateAVX2(t.data(), x.data(), y.data(), t.size());
+            return;
+        }
+        break;
+#endif
+    case Implementation::Scalar:
+        EvaluateScalar(t.data(), x.data(), y.data(), t.size());
+        return;
+    default:
+        break;
+    }
+    throw std::runtime_error("Fresnel kernel implementation not supported on this processor");
+}
+
+bool FresnelKernel::IsSupported(Implementation implementation)
+{
+    if (implementation == Implementation::Scalar) {
+        return true;
+    }
+#ifdef LINEACORE_FRESNEL_X86
+    static const bool avx2 = CpuSupports(Implementation::AVX2);
+    static const bool avx512 = CpuSupports(Implementation::AVX512);
+    return implementation == Implementation::AVX2 ? avx2 : avx512;
+#else
+    return false;
+#endif
+}
+
+FresnelKernel::Implementation FresnelKernel::ActiveImplementation()
+{
+    static const Implementation active = [] {
+        if (IsSupported(Implementation::AVX512)) {
+            return Implementation::AVX512;
+        }
+        if (IsSupported(Implementation::AVX2)) {
+            return Implementation::AVX2;
+        }
+        return Implementation::Scalar;
+    }();
+    return active;
+}
+
+} // namespace LineaCore::Geometry::Alignments::Horizontal
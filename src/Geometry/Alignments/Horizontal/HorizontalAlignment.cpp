@@ -1,6 +1,10 @@
 // HorizontalAlignment.cpp
 
 #include "LineaCore/Geometry/Alignments/Horizontal/HorizontalAlignment.hpp"
+#include "LineaCore/Geometry/Alignments/BatchUtils.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
 
 namespace LineaCore::Geometry::Alignments::Horizontal {
 
@@ -12,6 +16,78 @@ void HorizontalAlignment::SetExtremities()
     endingNormal = Normal(Length());
 }
 
+void HorizontalAlignment::CheckMaxThrow(double maxThrow)
+{
+    if (!(maxThrow > 0.0) || !std::isfinite(maxThrow)) {
+        throw std::runtime_error("Tessellation tolerance must be strictly positive and finite (got " + std::to_string(maxThrow) + ")");
+    }
+}
+
+std::size_t HorizontalAlignment::ChordSegmentCount(double length, double curvature, double maxThrow)
+{
+    CheckMaxThrow(maxThrow);
+    const double count = std::ceil(length * std::sqrt(std::fabs(curvature) / (8.0 * maxThrow)));
+    return count > 1.0 ? static_cast<std::size_t>(count) : 1;
+}
+
+std::size_t HorizontalAlignment::ChordSegmentCount(double maxThrow) const
+{
+    const double length = Length();
+    return ChordSegmentCount(length, std::max(std::fabs(Curvature(0.0)), std::fabs(Curvature(length))), maxThrow);
+}
+
+void HorizontalAlignment::UniformAbscissas(double length, std::span<double> abscissas)
+{
+    if (abscissas.empty()) {
+        return;
+    }
+    const std::size_t segmentCount = abscissas.size() - 1;
+    for (std::size_t k = 0; k < segmentCount; ++k) {
+        abscissas[k] = length * static_cast<double>(k) / static_cast<double>(segmentCount);
+    }
+    abscissas[segmentCount] = length;
+}
+
+void HorizontalAlignment::CheckPointCount(std::size_t pointCount, std::size_t outputCount)
+{
+    if (pointCount != outputCount) {
+        throw std::runtime_error("Tessellation output size (" + std::to_string(outputCount) +
+                                 ") does not match the point count (" + std::to_string(pointCount) + ")");
+    }
+}
+
+// Implémentations par défaut de l'évaluation par lots, basées sur les méthodes unitaires
+void HorizontalAlignment::Point(std::span<const double> s, std::span<Point2D> points) const
+{
+    BatchUtils::CheckBatchSize(s.size(), points.size());
+    for (std::size_t i = 0; i < s.size(); ++i) {
+        points[i] = Point(s[i]);
+    }
+}
+
+void HorizontalAlignment::Normal(std::span<const double> s, std::span<Vector2D> normals) const
+{
+    BatchUtils::CheckBatchSize(s.size(), normals.size());
+    for (std::size_t i = 0; i < s.size(); ++i) {
+        normals[i] = Normal(s[i]);
+    }
+}
+
+void HorizontalAlignment::Curvature(std::span<const double> s, std::span<double> curvatures) const
+{
+    BatchUtils::CheckBatchSize(s.size(), curvatures.size());
+    for (std::size_t i = 0; i < s.size(); ++i) {
+        curvatures[i] = Curvature(s[i]);
+    }
+}
+
+std::vector<Point2D> HorizontalAlignment::Points(double maxThrow) const
+{
+    std::vector<Point2D> points(PointCount(maxThrow));
+    Points(maxThrow, points);
+    return points;
+}
+
 // Getter pour la tangente de départ
 Vector2D HorizontalAlignment::StartingTangent() const{
     return startingNormal.Rotated90CounterClockWise();
@@ -22,4 +98,8 @@ Vector2D HorizontalAlignment::EndingTangent() const{
     return endingNormal.Rotated90CounterClockWise();
 }
 
+double HorizontalAlignment::NormalSide() const{
+    return Type() == H_Type::Curved && Curvature(0.0) < 0.0 ? -1.0 : 1.0;
+}
+
 } // namespace LineaCore::Geometry::Alignments::Horizontal
@@ -1,8 +1,10 @@
 // StraightAlignment.cpp
 #include "LineaCore/Geometry/Alignments/Horizontal/StraightAlignment.hpp"
+#include "LineaCore/Geometry/Alignments/BatchUtils.hpp"
 #include "LineaCore/LandXML/XMLUtils.hpp"
 #include <stdexcept>
 #include <cmath>
+#include <algorithm>
 
 namespace LineaCore::Geometry::Alignments::Horizontal {
 
@@ -28,6 +30,10 @@ double StraightAlignment::Length() const {
     return _ds;
 }
 
+const Vector2D& StraightAlignment::Direction() const {
+    return _normedVector;
+}
+
 Point2D StraightAlignment::Point(double s) const {
     return startingPoint + _normedVector * s;
 }
@@ -40,8 +46,48 @@ double StraightAlignment::Curvature(double /*s*/) const {
     return 0.0;
 }
 
-std::vector<Point2D> StraightAlignment::Points(double /*maxThrow*/) const {
-    return {startingPoint, startingPoint + _normedVector * _ds};
+void StraightAlignment::Point(std::span<const double> s, std::span<Point2D> points) const {
+    BatchUtils::CheckBatchSize(s.size(), points.size());
+    const double x0 = startingPoint.X;
+    const double y0 = startingPoint.Y;
+    const double ux = _normedVector.X;
+    const double uy = _normedVector.Y;
+    for (std::size_t i = 0; i < s.size(); ++i) {
+        points[i].X = x0 + ux * s[i];
+        points[i].Y = y0 + uy * s[i];
+    }
+}
+
+void StraightAlignment::Normal(std::span<const double> s, std::span<Vector2D> normals) const {
+    BatchUtils::CheckBatchSize(s.size(), normals.size());
+    std::fill(normals.begin(), normals.end(), _normedVector.Rotated90ClockWise());
+}
+
+void StraightAlignment::Curvature(std::span<const double> s, std::span<double> curvatures) const {
+    BatchUtils::CheckBatchSize(s.size(), curvatures.size());
+    std::fill(curvatures.begin(), curvatures.end(), 0.0);
+}
+
+double StraightAlignment::Projection(const Point2D& point, double /*sSeed*/) const {
+    return std::clamp((point - startingPoint) * _normedVector, 0.0, _ds);
+}
+
+BoundingBox StraightAlignment::Bounds() const {
+    BoundingBox box;
+    box.Extend(startingPoint);
+    box.Extend(endingPoint);
+    return box;
+}
+
+std::size_t StraightAlignment::PointCount(double maxThrow) const {
+    CheckMaxThrow(maxThrow);
+    return 2;
+}
+
+void StraightAlignment::Points(double maxThrow, std::span<Point2D> points) const {
+    CheckPointCount(PointCount(maxThrow), points.size());
+    points[0] = startingPoint;
+    points[1] = startingPoint + _normedVector * _ds;
 }
 
 // Implémentation de LandXMLSerializable
@@ -0,0 +1,193 @@
+// OffsetCurves.cpp
+
+#include "LineaCore/Geometry/Alignments/OffsetCurves.hpp"
+#include "LineaCore/Geometry/Alignments/BatchUtils.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+namespace LineaCore::Geometry::Alignments {
+
+using namespace Horizontal;
+
+namespace {
+
+constexpr std::size_t BlockSize = 256;   // Stations traitées ensemble (tampons en cache L1)
+
+// Nombre de segments d'un élément pour le décalage d, la longueur décalée étant au plus max|1 + κd| fois celle de l'élément.
+// La courbure κ/(1 + κd) et l'allongement 1 + κd sont monotones en κ, linéaire en s : leurs extrêmes sont aux extrémités.
+std::size_t SegmentCount(const HorizontalAlignment& element, double offset, double maxThrow) {
+    const double length = element.Length();
+    const double curvatureStart = element.Curvature(0.0);
+    const double curvatureEnd = element.Curvature(length);
+    // Décalage positif à droite : côté extérieur d'un virage à gauche (κ > 0)
+    const double stretchStart = 1.0 + curvatureStart * offset;
+    const double stretchEnd = 1.0 + curvatureEnd * offset;
+    if (!(stretchStart > 0.0) || !(stretchEnd > 0.0)) {
+        throw std::runtime_error("Offset " + std::to_string(offset) + " reaches the centre of curvature of an alignment element");
+    }
+    const double curvature = std::max(std::fabs(curvatureStart) / stretchStart, std::fabs(curvatureEnd) / stretchEnd);
+    return HorizontalAlignment::ChordSegmentCount(length * std::max(stretchStart, stretchEnd), curvature, maxThrow);
+}
+
+} // namespace
+
+OffsetCurves::OffsetCurves(const Alignment& alignment, std::vector<double> offsets)
+    : _alignment(alignment), _offsets(std::move(offsets)), _inputStationType(StationType::Internal) {
+    for (const double offset : _offsets) {
+        if (!std::isfinite(offset)) {
+            throw std::runtime_error("Offset must be finite (got " + std::to_string(offset) + ")");
+        }
+    }
+}
+
+std::size_t OffsetCurves::OffsetCount() const {
+    return _offsets.size();
+}
+
+std::span<const double> OffsetCurves::Offsets() const {
+    return _offsets;
+}
+
+StationType OffsetCurves::InputStationType() const {
+    return _inputStationType;
+}
+
+void OffsetCurves::SetInputStationType(StationType type) {
+    _inputStationType = type;
+}
+
+void OffsetCurves::Points(std::span<const double> stations, std::span<const std::span<Point2D>> outputs) const {
+    if (outputs.size() != _offsets.size()) {
+        throw std::runtime_error("Offset output count (" + std::to_string(outputs.size()) +
+                                 ") does not match the number of offsets (" + std::to_string(_offsets.size()) + ")");
+    }
+    for (const std::span<Point2D>& output : outputs) {
+        BatchUtils::CheckBatchSize(stations.size(), output.size());
+    }
+    if (_alignment.ElementCount() == 0) {
+        throw std::runtime_error("Alignment '" + _alignment.Name() + "' has no element");
+    }
+
+    const std::span<const double> elementStations = _alignment.Stations();
+    double internalStations[BlockSize];
+    double abscissas[BlockSize];
+    Point2D points[BlockSize];
+    Vector2D normals[BlockSize];
+
+    for (std::size_t blockStart = 0; blockStart < stations.size(); blockStart += BlockSize) {
+        const std::size_t count = std::min(BlockSize, stations.size() - blockStart);
+        std::span<const double> block = stations.subspan(blockStart, count);
+
+        // Stations externes converties par le curseur de zone des équations de station
+        if (_inputStationType == StationType::External) {
+            _alignment.StationEquations().InternalStations(block, std::span<double>(internalStations, count));
+            block = std::span<const double>(internalStations, count);
+        }
+
+        // Point et normale de l'axe, une fois par station ; les normales sont ramenées à droite
+        _alignment.ForEachElementRun(block, [&](std::size_t i, std::size_t j, std::size_t runCount) {
+            for (std::size_t k = j; k < j + runCount; ++k) {
+                abscissas[k] = block[k] - elementStations[i];
+            }
+            _alignment.ElementPoints(i, std::span<const double>(abscissas + j, runCount),
+                                     std::span<Point2D>(points + j, runCount), std::span<Vector2D>(normals + j, runCount));
+            const double side = _alignment.Element(i).NormalSide();
+            if (side < 0.0) {
+                for (std::size_t k = j; k < j + runCount; ++k) {
+                    normals[k] = normals[k] * side;
+                }
+            }
+        });
+
+        // Un décalage à la fois : écriture contiguë dans chaque tableau de sortie
+        for (std::size_t k = 0; k < _offsets.size(); ++k) {
+            const double offset = _offsets[k];
+            Point2D* output = outputs[k].data() + blockStart;
+            for (std::size_t j = 0; j < count; ++j) {
+                output[j] = Point2D(points[j].X + offset * normals[j].X, points[j].Y + offset * normals[j].Y);
+            }
+        }
+    }
+}
+
+std::vector<std::vector<Point2D>> OffsetCurves::Points(std::span<const double> stations) const {
+    std::vector<std::vector<Point2D>> curves(_offsets.size(), std::vector<Point2D>(stations.size()));
+    std::vector<std::span<Point2D>> outputs(curves.begin(), curves.end());
+    Points(stations, outputs);
+    return curves;
+}
+
+std::vector<std::vector<Point2D>> OffsetCurves::Tessellate(std::span<const double> maxThrows) const {
+    if (maxThrows.size() != _offsets.size()) {
+        throw std::runtime_error("Tolerance count (" + std::to_string(maxThrows.size()) +
+                                 ") does not match the number of offsets (" + std::to_string(_offsets.size()) + ")");
+    }
+    for (const double maxThrow : maxThrows) {
+        HorizontalAlignment::CheckMaxThrow(maxThrow);
+    }
+    if (_alignment.ElementCount() == 0) {
+        throw std::runtime_error("Alignment '" + _alignment.Name() + "' has no element");
+    }
+
+    const std::size_t offsetCount = _offsets.size();
+    std::vector<std::vector<Point2D>> curves(offsetCount);
+    std::vector<std::size_t> counts(offsetCount);
+    std::vector<std::size_t> distinctCounts;
+    std::vector<double> abscissas;
+    std::vector<Point2D> points;
+    std::vector<Vector2D> normals;
+
+    auto append = [&](std::size_t k, double side) {
+        const double offset = _offsets[k] * side;
+        for (std::size_t j = 0; j < points.size(); ++j) {
+            curves[k].push_back(points[j] + normals[j] * offset);
+        }
+    };
+
+    // Premier sommet de chaque courbe, au début du premier élément
+    abscissas.assign(1, 0.0);
+    points.resize(1);
+    normals.resize(1);
+    _alignment.ElementPoints(0, abscissas, points, normals);
+    for (std::size_t k = 0; k < offsetCount; ++k) {
+        append(k, _alignment.Element(0).NormalSide());
+    }
+
+    for (std::size_t i = 0; i < _alignment.ElementCount(); ++i) {
+        const HorizontalAlignment& element = _alignment.Element(i);
+        const double length = element.Length();
+        if (length == 0.0) {
+            continue;
+        }
+        for (std::size_t k = 0; k < offsetCount; ++k) {
+            counts[k] = SegmentCount(element, _offsets[k], maxThrows[k]);
+        }
+        distinctCounts.assign(counts.begin(), counts.end());
+        std::sort(distinctCounts.begin(), distinctCounts.end());
+        distinctCounts.erase(std::unique(distinctCounts.begin(), distinctCounts.end()), distinctCounts.end());
+
+        // Une évaluation de l'axe par nombre de segments ; le premier sommet de l'élément est la fin du précédent
+        for (const std::size_t n : distinctCounts) {
+            abscissas.resize(n + 1);
+            HorizontalAlignment::UniformAbscissas(length, abscissas);
+            points.resize(n);
+            normals.resize(n);
+            _alignment.ElementPoints(i, std::span<const double>(abscissas).subspan(1), points, normals);
+            for (std::size_t k = 0; k < offsetCount; ++k) {
+                if (counts[k] == n) {
+                    append(k, element.NormalSide());
+                }
+            }
+        }
+    }
+    return curves;
+}
+
+std::vector<std::vector<Point2D>> OffsetCurves::Tessellate(double maxThrow) const {
+    const std::vector<double> maxThrows(_offsets.size(), maxThrow);
+    return Tessellate(maxThrows);
+}
+
+} // namespace LineaCore::Geometry::Alignments
@@ -0,0 +1,372 @@
+// PackedAlignment.cpp
+
+#include "LineaCore/Geometry/Alignments/PackedAlignment.hpp"
+#include "LineaCore/Geometry/Alignments/BatchUtils.hpp"
+#include "LineaCore/Geometry/Alignments/Horizontal/StraightAlignment.hpp"
+#include "LineaCore/Geometry/Alignments/Horizontal/CurvedAlignment.hpp"
+#include "LineaCore/Geometry/Alignments/Horizontal/ClotoideTransition.hpp"
+#include "LineaCore/Geometry/Alignments/Horizontal/FresnelKernel.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace LineaCore::Geometry::Alignments {
+
+using namespace Horizontal;
+
+namespace {
+
+constexpr std::size_t BlockSize = 256;   // Taille des blocs d'abscisses locales évalués d'un seul tenant
+
+// Noyaux d'évaluation d'une plage d'abscisses locales sur un même élément.
+// Les formules sont celles des classes HorizontalAlignment correspondantes.
+
+void EvaluatePoints(const PackedLine& line, const double* s, Point2D* points, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        points[i].X = line.StartX + line.DirectionX * s[i];
+        points[i].Y = line.StartY + line.DirectionY * s[i];
+    }
+}
+
+void EvaluatePoints(const PackedArc& arc, const double* s, Point2D* points, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        const double a = arc.StartAngle + arc.Sens * s[i] / arc.AbsRadius;
+        points[i].X = arc.CenterX + std::cos(a) * arc.AbsRadius;
+        points[i].Y = arc.CenterY + std::sin(a) * arc.AbsRadius;
+    }
+}
+
+void EvaluatePoints(const PackedClothoid& clothoid, const double* s, Point2D* points, std::size_t count) {
+    double t[BlockSize], x[BlockSize], y[BlockSize];
+    const double absA = std::fabs(clothoid.A);
+    for (std::size_t i = 0; i < count; ++i) {
+        t[i] = (clothoid.StartAbscissa + s[i]) / absA;
+    }
+    FresnelKernel::Evaluate(std::span<const double>(t, count), std::span<double>(x, count), std::span<double>(y, count));
+    for (std::size_t i = 0; i < count; ++i) {
+        const double xLoc = x[i] * absA;
+        const double yLoc = y[i] * clothoid.A;
+        points[i].X = (xLoc * clothoid.RotationX - yLoc * clothoid.RotationY) + clothoid.TranslationX;
+        points[i].Y = (yLoc * clothoid.RotationX + xLoc * clothoid.RotationY) + clothoid.TranslationY;
+    }
+}
+
+template <typename Element>
+void EvaluateNormals(const Element& element, const double* s, Vector2D* normals, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        normals[i] = element.Normal(s[i]);
+    }
+}
+
+template <typename Element>
+void EvaluateCurvatures(const Element& element, const double* s, double* curvatures, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        curvatures[i] = element.Curvature(s[i]);
+    }
+}
+
+// Découpe un lot de stations en plages consécutives portées par un même élément, converties en
+// abscisses locales par blocs, puis appelle evaluate(index, abscisses, premier, nombre).
+template <typename Evaluate>
+void ForEachRun(const PackedAlignmentView& view, std::span<const double> stations, Evaluate&& evaluate) {
+    const std::size_t n = view.ElementCount();
+    const std::span<const double> starts = view.Stations();
+    constexpr double Infinity = std::numeric_limits<double>::infinity();
+
+    double s[BlockSize];
+    std::size_t i = 0;
+    while (i < stations.size()) {
+        const std::size_t index = view.ElementIndex(stations[i]);
+        const double low = index == 0 ? -Infinity : starts[index];
+        const double high = index + 1 == n ? Infinity : starts[index + 1];
+        const double start = starts[index];
+
+        std::size_t count = 0;
+        while (i + count < stations.size() && count < BlockSize) {
+            const double station = stations[i + count];
+            if (!(station >= low && station < high)) {
+                break;
+            }
+            s[count++] = station - start;
+        }
+        if (count == 0) {
+            // Station hors de toute plage (NaN) : évaluée seule sur l'élément retourné par la recherche
+            s[count++] = stations[i] - start;
+        }
+        evaluate(index, s, i, count);
+        i += count;
+    }
+}
+
+} // namespace
+
+// PackedLine
+
+Point2D PackedLine::Point(double s) const {
+    return Point2D(StartX, StartY) + Vector2D(DirectionX, DirectionY) * s;
+}
+
+Vector2D PackedLine::Normal(double /*s*/) const {
+    return Vector2D(DirectionX, DirectionY).Rotated90ClockWise();
+}
+
+double PackedLine::Curvature(double /*s*/) const {
+    return 0.0;
+}
+
+// PackedArc
+
+Point2D PackedArc::Point(double s) const {
+    const double a = StartAngle + Sens * s / AbsRadius;
+    return Point2D(CenterX + std::cos(a) * AbsRadius, CenterY + std::sin(a) * AbsRadius);
+}
+
+Vector2D PackedArc::Normal(double s) const {
+    return Vector2D::Polar(1.0, StartAngle + Sens * s / AbsRadius);
+}
+
+double PackedArc::Curvature(double /*s*/) const {
+    return Sens / AbsRadius;
+}
+
+// PackedClothoid
+
+Point2D PackedClothoid::Point(double s) const {
+    double x, y;
+    const double absA = std::fabs(A);
+    FresnelKernel::Evaluate((StartAbscissa + s) / absA, x, y);
+    return Point2D(x * absA, y * A).RotatedBy(Vector2D(RotationX, RotationY)) + Vector2D(TranslationX, TranslationY);
+}
+
+Vector2D PackedClothoid::Normal(double s) const {
+    const double sLocal = StartAbscissa + s;
+    const double angle = RotationAngle + (sLocal * sLocal) / A / std::fabs(A) / 2.0;
+    return Vector2D(std::sin(angle), -std::cos(angle));
+}
+
+double PackedClothoid::Curvature(double s) const {
+    return (StartAbscissa + s) / A / std::fabs(A);
+}
+
+// PackedAlignmentView
+
+PackedAlignmentView::PackedAlignmentView(Unchecked, std::span<const double> stations, std::span<const PackedElementRef> elements,
+                                         std::span<const PackedLine> lines, std::span<const PackedArc> arcs,
+                                         std::span<const PackedClothoid> clothoids)
+    : _stations(stations), _elements(elements), _lines(lines), _arcs(arcs), _clothoids(clothoids) {}
+
+PackedAlignmentView::PackedAlignmentView(std::span<const double> stations, std::span<const PackedElementRef> elements,
+                                         std::span<const PackedLine> lines, std::span<const PackedArc> arcs,
+                                         std::span<const PackedClothoid> clothoids)
+    : PackedAlignmentView(Unchecked{}, stations, elements, lines, arcs, clothoids) {
+    if (stations.size() != elements.size() + 1) {
+        throw std::runtime_error("Packed alignment has " + std::to_string(stations.size()) + " stations for " +
+                                 std::to_string(elements.size()) + " elements");
+    }
+    for (const PackedElementRef& ref : elements) {
+        std::size_t size = 0;
+        switch (ref.ElementKind) {
+        case PackedElementRef::Kind::Line:
+            size = lines.size();
+            break;
+        case PackedElementRef::Kind::Arc:
+            size = arcs.size();
+            break;
+        case PackedElementRef::Kind::Clothoid:
+            size = clothoids.size();
+            break;
+        default:
+            throw std::runtime_error("Packed alignment element has an unknown kind");
+        }
+        if (ref.Index >= size) {
+            throw std::runtime_error("Packed alignment element index " + std::to_string(ref.Index) + " is out of range");
+        }
+    }
+}
+
+double PackedAlignmentView::StaStart() const {
+    return _stations.front();
+}
+
+double PackedAlignmentView::StaEnd() const {
+    return _stations.back();
+}
+
+double PackedAlignmentView::Length() const {
+    return _stations.back() - _stations.front();
+}
+
+std::size_t PackedAlignmentView::ElementCount() const {
+    return _elements.size();
+}
+
+std::span<const double> PackedAlignmentView::Stations() const {
+    return _stations;
+}
+
+std::span<const PackedElementRef> PackedAlignmentView::Elements() const {
+    return _elements;
+}
+
+std::span<const PackedLine> PackedAlignmentView::Lines() const {
+    return _lines;
+}
+
+std::span<const PackedArc> PackedAlignmentView::Arcs() const {
+    return _arcs;
+}
+
+std::span<const PackedClothoid> PackedAlignmentView::Clothoids() const {
+    return _clothoids;
+}
+
+std::size_t PackedAlignmentView::ElementIndex(double station) const {
+    const std::size_t n = _elements.size();
+    if (n == 0) {
+        throw std::runtime_error("Packed alignment has no element");
+    }
+    // Recherche parmi les stations de début des éléments 1 à n - 1 : le rattachement aux extrémités est implicite
+    auto it = std::upper_bound(_stations.begin() + 1, _stations.begin() + n, station);
+    return static_cast<std::size_t>(it - _stations.begin()) - 1;
+}
+
+Point2D PackedAlignmentView::Point(double station) const {
+    const std::size_t i = ElementIndex(station);
+    const double s = station - _stations[i];
+    return Visit(i, [s](const auto& element) { return element.Point(s); });
+}
+
+Vector2D PackedAlignmentView::Normal(double station) const {
+    const std::size_t i = ElementIndex(station);
+    const double s = station - _stations[i];
+    return Visit(i, [s](const auto& element) { return element.Normal(s); });
+}
+
+double PackedAlignmentView::Curvature(double station) const {
+    const std::size_t i = ElementIndex(station);
+    const double s = station - _stations[i];
+    return Visit(i, [s](const auto& element) { return element.Curvature(s); });
+}
+
+void PackedAlignmentView::Point(std::span<const double> stations, std::span<Point2D> points) const {
+    BatchUtils::CheckBatchSize(stations.size(), points.size());
+    ForEachRun(*this, stations, [&](std::size_t index, const double* s, std::size_t first, std::size_t count) {
+        Visit(index, [&](const auto& element) { EvaluatePoints(element, s, points.data() + first, count); });
+    });
+}
+
+void PackedAlignmentView::Normal(std::span<const double> stations, std::span<Vector2D> normals) const {
+    BatchUtils::CheckBatchSize(stations.size(), normals.size());
+    ForEachRun(*this, stations, [&](std::size_t index, const double* s, std::size_t first, std::size_t count) {
+        Visit(index, [&](const auto& element) { EvaluateNormals(element, s, normals.data() + first, count); });
+    });
+}
+
+void PackedAlignmentView::Curvature(std::span<const double> stations, std::span<double> curvatures) const {
+    BatchUtils::CheckBatchSize(stations.size(), curvatures.size());
+    ForEachRun(*this, stations, [&](std::size_t index, const double* s, std::size_t first, std::size_t count) {
+        Visit(index, [&](const auto& element) { EvaluateCurvatures(element, s, curvatures.data() + first, count); });
+    });
+}
+
+// PackedAlignment
+
+PackedAlignment::PackedAlignment()
+    : PackedAlignment(std::string(), 0.0) {}
+
+PackedAlignment::PackedAlignment(std::string name, double staStart)
+    : _name(std::move(name)), _stations(1, staStart) {}
+
+PackedAlignment PackedAlignment::FromAlignment(const Alignment& alignment) {
+    PackedAlignment packed(alignment.Name(), alignment.StaStart());
+    const std::size_t n = alignment.ElementCount();
+    packed._stations.reserve(n + 1);
+    packed._elements.reserve(n);
+
+    for (std::size_t i = 0; i < n; ++i) {
+        packed.AddElement(alignment.Element(i));
+    }
+    return packed;
+}
+
+Alignment PackedAlignment::ToAlignment() const {
+    Alignment alignment(_name, _stations.front());
+    for (const PackedElementRef& ref : _elements) {
+        switch (ref.ElementKind) {
+        case PackedElementRef::Kind::Line: {
+            const PackedLine& line = _lines[ref.Index];
+            alignment.AddElement(std::make_unique<StraightAlignment>(Point2D(line.StartX, line.StartY),
+                                                                     Vector2D(line.DirectionX, line.DirectionY), line.Length));
+            break;
+        }
+        case PackedElementRef::Kind::Arc: {
+            const PackedArc& arc = _arcs[ref.Index];
+            alignment.AddElement(std::make_unique<CurvedAlignment>(Point2D(arc.CenterX, arc.CenterY), arc.AbsRadius,
+                                                                   arc.Sens, arc.StartAngle, arc.Length));
+            break;
+        }
+        case PackedElementRef::Kind::Clothoid: {
+            const PackedClothoid& clothoid = _clothoids[ref.Index];
+            alignment.AddElement(std::make_unique<ClotoideTransition>(clothoid.A, clothoid.StartAbscissa, clothoid.Length,
+                                                                      Vector2D(clothoid.RotationX, clothoid.RotationY),
+                                                                      Vector2D(clothoid.TranslationX, clothoid.TranslationY)));
+            break;
+        }
+        }
+    }
+    return alignment;
+}
+
+void PackedAlignment::AddElement(const HorizontalAlignment& element) {
+    if (auto line = dynamic_cast<const StraightAlignment*>(&element)) {
+        const Point2D& start = line->getStartingPoint();
+        const Vector2D& direction = line->Direction();
+        AddLine(PackedLine{start.X, start.Y, direction.X, direction.Y, line->Length()});
+    } else if (auto arc = dynamic_cast<const CurvedAlignment*>(&element)) {
+        const double signedRadius = arc->SignedRadius();
+        AddArc(PackedArc{arc->CenterPoint().X, arc->CenterPoint().Y, std::fabs(signedRadius),
+                         signedRadius >= 0.0 ? 1.0 : -1.0, arc->StartAngle(), arc->Length()});
+    } else if (auto clothoid = dynamic_cast<const ClotoideTransition*>(&element)) {
+        const Vector2D& rotation = clothoid->RotationVector();
+        const Vector2D& translation = clothoid->TranslationVector();
+        AddClothoid(PackedClothoid{clothoid->Parameter(), clothoid->StartAbscissa(), rotation.X, rotation.Y,
+                                   rotation.AngleMinusPiPi(), translation.X, translation.Y, clothoid->Length()});
+    } else {
+        throw std::runtime_error("Element " + std::to_string(_elements.size()) + " of Alignment '" + _name + "' cannot be packed");
+    }
+}
+
+void PackedAlignment::AddLine(const PackedLine& line) {
+    _elements.push_back({PackedElementRef::Kind::Line, static_cast<std::uint32_t>(_lines.size())});
+    _lines.push_back(line);
+    _stations.push_back(_stations.back() + line.Length);
+}
+
+void PackedAlignment::AddArc(const PackedArc& arc) {
+    _elements.push_back({PackedElementRef::Kind::Arc, static_cast<std::uint32_t>(_arcs.size())});
+    _arcs.push_back(arc);
+    _stations.push_back(_stations.back() + arc.Length);
+}
+
+void PackedAlignment::AddClothoid(const PackedClothoid& clothoid) {
+    _elements.push_back({PackedElementRef::Kind::Clothoid, static_cast<std::uint32_t>(_clothoids.size())});
+    _clothoids.push_back(clothoid);
+    _stations.push_back(_stations.back() + clothoid.Length);
+}
+
+const std::string& PackedAlignment::Name() const {
+    return _name;
+}
+
+PackedAlignmentView PackedAlignment::View() const {
+    return PackedAlignmentView(PackedAlignmentView::Unchecked{}, _stations, _elements, _lines, _arcs, _clothoids);
+}
+
+std::size_t PackedAlignment::MemoryUsage() const {
+    return _stations.size() * sizeof(double) + _elements.size() * sizeof(PackedElementRef) +
+           _lines.size() * sizeof(PackedLine) + _arcs.size() * sizeof(PackedArc) +
+           _clothoids.size() * sizeof(PackedClothoid);
+}
+
+} // namespace LineaCore::Geometry::Alignments
@@ -0,0 +1,372 @@
+// PackedAlignmentFile.cpp
+
+#include "LineaCore/Geometry/Alignments/PackedAlignmentFile.hpp"
+#include "LineaCore/LandXML/LandXMLStreamReader.hpp"
+#include <atomic>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace LineaCore::Geometry::Alignments {
+
+namespace {
+
+constexpr char Magic[8] = {'L', 'C', 'A', 'L', 'I', 'G', 'N', '\0'};
+constexpr std::uint32_t EndianMarker = 0x01020304;
+constexpr std::uint64_t Alignment8 = 8;
+
+static_assert(std::numeric_limits<double>::is_iec559, "The alignment cache format requires IEEE 754 doubles");
+static_assert(std::is_trivially_copyable_v<PackedLine> && std::is_trivially_copyable_v<PackedArc> &&
+              std::is_trivially_copyable_v<PackedClothoid> && std::is_trivially_copyable_v<PackedElementRef>,
+              "Packed elements must be trivially copyable to be stored as is");
+
+struct FileHeader {
+    char Signature[8];
+    std::uint32_t Version;
+    std::uint32_t Endian;
+    std::uint64_t SourceHash;
+    std::uint64_t AlignmentCount;
+    std::uint64_t DirectoryOffset;
+    std::uint64_t FileSize;
+};
+
+struct DirectoryEntry {
+    std::uint64_t NameOffset, NameLength;
+    std::uint64_t ElementCount, LineCount, ArcCount, ClothoidCount;
+    std::uint64_t StationsOffset, ElementsOffset, LinesOffset, ArcsOffset, ClothoidsOffset;
+};
+
+std::uint64_t AlignUp(std::uint64_t offset) {
+    return (offset + Alignment8 - 1) / Alignment8 * Alignment8;
+}
+
+// Tableau typé dans la projection, après contrôle des bornes et de l'alignement
+template <typename T>
+std::span<const T> MappedArray(const char* data, std::uint64_t size, std::uint64_t offset, std::uint64_t count) {
+    if (offset % alignof(T) != 0 || offset > size || count > (size - offset) / sizeof(T)) {
+        throw std::runtime_error("Alignment cache file is truncated or corrupted");
+    }
+    return std::span<const T>(reinterpret_cast<const T*>(data + offset), count);
+}
+
+// Nom de fichier temporaire propre à l'appel : processus, tirage aléatoire et compteur du processus
+std::string TemporaryFileName(const std::string& fileName) {
+    static std::atomic<std::uint64_t> counter{0};
+#ifdef _WIN32
+    const unsigned long processId = GetCurrentProcessId();
+#else
+    const long processId = static_cast<long>(getpid());
+#endif
+    std::random_device random;
+    return fileName + "." + std::to_string(processId) + "." + std::to_string(random()) + "." + std::to_string(counter++) + ".tmp";
+}
+
+// Supprime le fichier temporaire à la sortie de la portée, sauf s'il a été renommé
+class TemporaryFileGuard {
+private:
+    std::string _fileName;
+    bool _released = false;
+
+public:
+    explicit TemporaryFileGuard(std::string fileName) : _fileName(std::move(fileName)) {}
+    TemporaryFileGuard(const TemporaryFileGuard&) = delete;
+    TemporaryFileGuard& operator=(const TemporaryFileGuard&) = delete;
+    ~TemporaryFileGuard() {
+        if (!_released) {
+            std::error_code error;
+            std::filesystem::remove(_fileName, error);
+        }
+    }
+
+    void Release() { _released = true; }
+};
+
+} // namespace
+
+// Projection en lecture seule d'un fichier
+
+struct PackedAlignmentFile::Mapping {
+    const char* Data = nullptr;
+    std::uint64_t Size = 0;
+#ifdef _WIN32
+    HANDLE File = INVALID_HANDLE_VALUE;
+    HANDLE View = nullptr;
+#endif
+
+    explicit Mapping(const std::string& fileName) {
+#ifdef _WIN32
+        File = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        LARGE_INTEGER fileSize;
+        if (File == INVALID_HANDLE_VALUE || !GetFileSizeEx(File, &fileSize) || fileSize.QuadPart == 0) {
+            Release();
+            throw std::runtime_error("Cannot map alignment cache file '" + fileName + "'");
+        }
+        View = CreateFileMappingA(File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        void* address = View != nullptr ? MapViewOfFile(View, FILE_MAP_READ, 0, 0, 0) : nullptr;
+        if (address == nullptr) {
+            Release();
+            throw std::runtime_error("Cannot map alignment cache file '" + fileName + "'");
+        }
+        Data = static_cast<const char*>(address);
+        Size = static_cast<std::uint64_t>(fileSize.QuadPart);
+#else
+        const int fd = ::open(fileName.c_str(), O_RDONLY);
+        struct stat status;
+        if (fd < 0 || ::fstat(fd, &status) != 0 || status.st_size == 0) {
+            if (fd >= 0) {
+                ::close(fd);
+            }
+            throw std::runtime_error("Cannot map alignment cache file '" + fileName + "'");
+        }
+        void* address = ::mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (address == MAP_FAILED) {
+            throw std::runtime_error("Cannot map alignment cache file '" + fileName + "'");
+        }
+        Data = static_cast<const char*>(address);
+        Size = static_cast<std::uint64_t>(status.st_size);
+#endif
+    }
+
+    ~Mapping() {
+        Release();
+    }
+
+    void Release() {
+#ifdef _WIN32
+        if (Data != nullptr) {
+            UnmapViewOfFile(Data);
+        }
+        if (View != nullptr) {
+            CloseHandle(View);
+        }
+        if (File != INVALID_HANDLE_VALUE) {
+            CloseHandle(File);
+        }
+        View = nullptr;
+        File = INVALID_HANDLE_VALUE;
+#else
+        if (Data != nullptr) {
+            ::munmap(const_cast<char*>(Data), static_cast<std::size_t>(Size));
+        }
+#endif
+        Data = nullptr;
+    }
+};
+
+PackedAlignmentFile::PackedAlignmentFile(const std::string& fileName)
+    : _mapping(std::make_unique<Mapping>(fileName)), _sourceHash(0) {
+    const char* data = _mapping->Data;
+    const std::uint64_t size = _mapping->Size;
+
+    FileHeader header;
+    if (size < sizeof(header)) {
+        throw std::runtime_error("File '" + fileName + "' is not an alignment cache file");
+    }
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.Signature, Magic, sizeof(Magic)) != 0) {
+        throw std::runtime_error("File '" + fileName + "' is not an alignment cache file");
+    }
+    if (header.Endian != EndianMarker) {
+        throw std::runtime_error("Alignment cache file '" + fileName + "' was written with a different byte order");
+    }
+    if (header.Version != FormatVersion) {
+        throw std::runtime_error("Alignment cache file '" + fileName + "' has version " + std::to_string(header.Version) +
+                                 " (expected " + std::to_string(FormatVersion) + ")");
+    }
+    if (header.FileSize != size) {
+        throw std::runtime_error("Alignment cache file '" + fileName + "' is truncated or corrupted");
+    }
+    _sourceHash = header.SourceHash;
+
+    std::span<const DirectoryEntry> directory = MappedArray<DirectoryEntry>(data, size, header.DirectoryOffset, header.AlignmentCount);
+    _names.reserve(directory.size());
+    _views.reserve(directory.size());
+    for (const DirectoryEntry& entry : directory) {
+        std::span<const char> name = MappedArray<char>(data, size, entry.NameOffset, entry.NameLength);
+        _names.emplace_back(name.data(), name.size());
+        _views.emplace_back(MappedArray<double>(data, size, entry.StationsOffset, entry.ElementCount + 1),
+                            MappedArray<PackedElementRef>(data, size, entry.ElementsOffset, entry.ElementCount),
+                            MappedArray<PackedLine>(data, size, entry.LinesOffset, entry.LineCount),
+                            MappedArray<PackedArc>(data, size, entry.ArcsOffset, entry.ArcCount),
+                            MappedArray<PackedClothoid>(data, size, entry.ClothoidsOffset, entry.ClothoidCount));
+    }
+}
+
+PackedAlignmentFile::PackedAlignmentFile(PackedAlignmentFile&&) noexcept = default;
+PackedAlignmentFile& PackedAlignmentFile::operator=(PackedAlignmentFile&&) noexcept = default;
+PackedAlignmentFile::~PackedAlignmentFile() = default;
+
+bool PackedAlignmentFile::TryOpen(const std::string& fileName, std::uint64_t expectedSourceHash, std::unique_ptr<PackedAlignmentFile>& file) {
+    std::error_code error;
+    if (!std::filesystem::is_regular_file(fileName, error)) {
+        file.reset();
+        return false;
+    }
+    try {
+        auto opened = std::make_unique<PackedAlignmentFile>(fileName);
+        if (opened->SourceHash() != expectedSourceHash) {
+            file.reset();
+            return false;
+        }
+        file = std::move(opened);
+        return true;
+    } catch (const std::runtime_error&) {
+        file.reset();
+        return false;
+    }
+}
+
+void PackedAlignmentFile::Write(const std::string& fileName, std::span<const PackedAlignment> alignments, std::uint64_t sourceHash) {
+    // Disposition : en-tête, répertoire, puis nom et tableaux de chaque axe
+    std::vector<DirectoryEntry> directory(alignments.size());
+    std::vector<PackedAlignmentView> views;
+    std::uint64_t offset = AlignUp(sizeof(FileHeader) + directory.size() * sizeof(DirectoryEntry));
+    for (std::size_t i = 0; i < alignments.size(); ++i) {
+        const PackedAlignmentView view = alignments[i].View();
+        DirectoryEntry& entry = directory[i];
+        entry.NameOffset = offset;
+        entry.NameLength = alignments[i].Name().size();
+        entry.ElementCount = view.ElementCount();
+        entry.LineCount = view.Lines().size();
+        entry.ArcCount = view.Arcs().size();
+        entry.ClothoidCount = view.Clothoids().size();
+        entry.StationsOffset = AlignUp(entry.NameOffset + entry.NameLength);
+        entry.ElementsOffset = AlignUp(entry.StationsOffset + view.Stations().size_bytes());
+        entry.LinesOffset = AlignUp(entry.ElementsOffset + view.Elements().size_bytes());
+        entry.ArcsOffset = AlignUp(entry.LinesOffset + view.Lines().size_bytes());
+        entry.ClothoidsOffset = AlignUp(entry.ArcsOffset + view.Arcs().size_bytes());
+        offset = AlignUp(entry.ClothoidsOffset + view.Clothoids().size_bytes());
+        views.push_back(view);
+    }
+
+    FileHeader header{};
+    std::memcpy(header.Signature, Magic, sizeof(Magic));
+    header.Version = FormatVersion;
+    header.Endian = EndianMarker;
+    header.SourceHash = sourceHash;
+    header.AlignmentCount = alignments.size();
+    header.DirectoryOffset = sizeof(FileHeader);
+    header.FileSize = offset;
+
+    // Écriture dans un fichier temporaire renommé à la fin : un lecteur concurrent ne voit jamais de fichier partiel,
+    // et deux écrivains concurrents n'écrivent jamais dans le même fichier temporaire
+    const std::string temporaryName = TemporaryFileName(fileName);
+    TemporaryFileGuard temporary(temporaryName);
+    {
+        std::ofstream stream(temporaryName, std::ios::binary | std::ios::trunc);
+        if (!stream) {
+            throw std::runtime_error("Cannot write alignment cache file '" + temporaryName + "'");
+        }
+        std::uint64_t position = 0;
+        auto write = [&](std::uint64_t at, const void* bytes, std::uint64_t count) {
+            static const char zeros[Alignment8] = {};
+            stream.write(zeros, static_cast<std::streamsize>(at - position));
+            stream.write(static_cast<const char*>(bytes), static_cast<std::streamsize>(count));
+            position = at + count;
+        };
+        write(0, &header, sizeof(header));
+        write(header.DirectoryOffset, directory.data(), directory.size() * sizeof(DirectoryEntry));
+        for (std::size_t i = 0; i < alignments.size(); ++i) {
+            const DirectoryEntry& entry = directory[i];
+            const PackedAlignmentView& view = views[i];
+            write(AlignUp(position), nullptr, 0);
+            write(entry.NameOffset, alignments[i].Name().data(), entry.NameLength);
+            write(entry.StationsOffset, view.Stations().data(), view.Stations().size_bytes());
+            write(entry.ElementsOffset, view.Elements().data(), view.Elements().size_bytes());
+            write(entry.LinesOffset, view.Lines().data(), view.Lines().size_bytes());
+            write(entry.ArcsOffset, view.Arcs().data(), view.Arcs().size_bytes());
+            write(entry.ClothoidsOffset, view.Clothoids().data(), view.Clothoids().size_bytes());
+        }
+        write(header.FileSize, nullptr, 0);
+        if (!stream) {
+            throw std::runtime_error("Cannot write alignment cache file '" + temporaryName + "'");
+        }
+    }
+    std::error_code error;
+    std::filesystem::rename(temporaryName, fileName, error);
+    if (error) {
+        throw std::runtime_error("Cannot write alignment cache file '" + fileName + "'");
+    }
+    temporary.Release();
+}
+
+std::uint64_t PackedAlignmentFile::HashFile(const std::string& fileName) {
+    std::ifstream stream(fileName, std::ios::binary);
+    if (!stream) {
+        throw std::runtime_error("Cannot read file '" + fileName + "'");
+    }
+    std::uint64_t hash = 14695981039346656037ull;   // FNV-1a 64 bits
+    char buffer[1 << 16];
+    while (stream.read(buffer, sizeof(buffer)) || stream.gcount() > 0) {
+        const std::streamsize count = stream.gcount();
+        for (std::streamsize i = 0; i < count; ++i) {
+            hash ^= static_cast<unsigned char>(buffer[i]);
+            hash *= 1099511628211ull;
+        }
+    }
+    return hash;
+}
+
+PackedAlignmentFile PackedAlignmentFile::LoadOrBuild(const std::string& landXmlFileName, const std::string& cacheFileName, bool* rebuilt) {
+    const std::uint64_t sourceHash = HashFile(landXmlFileName);
+    std::unique_ptr<PackedAlignmentFile> cached;
+    if (TryOpen(cacheFileName, sourceHash, cached)) {
+        if (rebuilt != nullptr) {
+            *rebuilt = false;
+        }
+        return std::move(*cached);
+    }
+
+    std::vector<PackedAlignment> alignments;
+    LandXML::LandXMLStreamReader::Callbacks callbacks;
+    callbacks.AlignmentBegin = [&](const LandXML::StreamedAlignment& alignment) {
+        alignments.emplace_back(alignment.Name, alignment.StaStart);
+    };
+    callbacks.Element = [&](LandXML::StreamedElement&& element) {
+        alignments.back().AddElement(*element.Element);
+    };
+    LandXML::LandXMLStreamReader::ReadFile(landXmlFileName, callbacks);
+
+    Write(cacheFileName, alignments, sourceHash);
+    if (rebuilt != nullptr) {
+        *rebuilt = true;
+    }
+    return PackedAlignmentFile(cacheFileName);
+}
+
+std::uint64_t PackedAlignmentFile::SourceHash() const {
+    return _sourceHash;
+}
+
+std::size_t PackedAlignmentFile::AlignmentCount() const {
+    return _views.size();
+}
+
+std::string_view PackedAlignmentFile::Name(std::size_t index) const {
+    return _names.at(index);
+}
+
+const PackedAlignmentView& PackedAlignmentFile::View(std::size_t index) const {
+    return _views.at(index);
+}
+
+} // namespace LineaCore::Geometry::Alignments
@@ -0,0 +1,243 @@
+// SegmentIntersector.cpp
+
+#include "LineaCore/Geometry/Alignments/SegmentIntersector.hpp"
+#include "LineaCore/Geometry/Alignments/BatchUtils.hpp"
+#include "LineaCore/Geometry/Alignments/Horizontal/CurvedAlignment.hpp"
+#include "LineaCore/Geometry/Alignments/Horizontal/StraightAlignment.hpp"
+#include "LineaCore/Geometry/BoundingBox.hpp"
+#include "LineaCore/Geometry/GeometryUtils.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+namespace LineaCore::Geometry::Alignments {
+
+using namespace Horizontal;
+
+namespace {
+
+constexpr std::size_t CellsPerSegment = 1;          // Nombre moyen de cellules de grille par segment
+constexpr std::size_t MaxRootIterations = 60;
+constexpr std::size_t MinElementsPerThread = 16;
+
+// Marquage des segments déjà examinés pour l'élément courant, propre à chaque thread
+struct VisitScratch {
+    VisitStamps visited;
+    std::vector<std::uint32_t> candidates;
+    std::vector<Point2D> points;
+    std::vector<double> abscissas;
+    std::vector<double> signedDistances;
+};
+
+thread_local VisitScratch visitScratch;
+
+Vector2D Tangent(const HorizontalAlignment& element, double s) {
+    return element.Normal(s).Rotated90CounterClockWise() * element.NormalSide();
+}
+
+// Racine de f(s) = (P(s) - origin)·normal sur [s0, s1], où f change de signe : Newton, repli sur la dichotomie
+double ClotoideRoot(const HorizontalAlignment& element, const Point2D& origin, const Vector2D& normal, double s0, double f0, double s1) {
+    double low = s0, high = s1;
+    const bool increasing = f0 < 0.0;
+    double s = (low + high) / 2.0;
+    for (std::size_t iteration = 0; iteration < MaxRootIterations; ++iteration) {
+        const double f = (element.Point(s) - origin) * normal;
+        if (f == 0.0) {
+            return s;
+        }
+        if ((f < 0.0) == increasing) {
+            low = s;
+        } else {
+            high = s;
+        }
+        const double derivative = Tangent(element, s) * normal;
+        double next = derivative != 0.0 ? s - f / derivative : low - 1.0;
+        if (!(next > low && next < high)) {
+            next = (low + high) / 2.0;
+        }
+        if (std::fabs(next - s) <= 1e-13 * (1.0 + std::fabs(s))) {
+            return next;
+        }
+        s = next;
+    }
+    return s;
+}
+
+} // namespace
+
+SegmentIntersector::SegmentIntersector(std::span<const Point2D> starts, std::span<const Point2D> ends)
+    : _starts(starts.begin(), starts.end()), _ends(ends.begin(), ends.end()) {
+    if (starts.size() != ends.size()) {
+        throw std::runtime_error("Segment end count (" + std::to_string(ends.size()) +
+                                 ") does not match the number of segment starts (" + std::to_string(starts.size()) + ")");
+    }
+    _polylines.resize(_starts.size());
+    _firstSegments.resize(_starts.size() + 1);
+    for (std::size_t i = 0; i < _starts.size(); ++i) {
+        _polylines[i] = static_cast<std::uint32_t>(i);
+        _firstSegments[i] = static_cast<std::uint32_t>(i);
+    }
+    _firstSegments.back() = static_cast<std::uint32_t>(_starts.size());
+    BuildGrid();
+}
+
+SegmentIntersector::SegmentIntersector(std::span<const std::vector<Point2D>> polylines) {
+    _firstSegments.reserve(polylines.size() + 1);
+    for (std::size_t p = 0; p < polylines.size(); ++p) {
+        _firstSegments.push_back(static_cast<std::uint32_t>(_starts.size()));
+        const std::vector<Point2D>& vertices = polylines[p];
+        for (std::size_t k = 0; k + 1 < vertices.size(); ++k) {
+            _starts.push_back(vertices[k]);
+            _ends.push_back(vertices[k + 1]);
+            _polylines.push_back(static_cast<std::uint32_t>(p));
+        }
+    }
+    _firstSegments.push_back(static_cast<std::uint32_t>(_starts.size()));
+    BuildGrid();
+}
+
+std::size_t SegmentIntersector::SegmentCount() const {
+    return _starts.size();
+}
+
+std::size_t SegmentIntersector::PolylineCount() const {
+    return _firstSegments.size() - 1;
+}
+
+void SegmentIntersector::BuildGrid() {
+    _segmentBounds.resize(_starts.size());
+    for (std::size_t i = 0; i < _starts.size(); ++i) {
+        _segmentBounds[i] = BoundingBox(std::min(_starts[i].X, _ends[i].X), std::min(_starts[i].Y, _ends[i].Y),
+                                        std::max(_starts[i].X, _ends[i].X), std::max(_starts[i].Y, _ends[i].Y));
+    }
+    _grid = UniformGrid(_segmentBounds, CellsPerSegment);
+}
+
+void SegmentIntersector::IntersectElement(const Alignment& alignment, std::size_t index, double maxThrow,
+                                          std::vector<SegmentCrossing>& crossings) const {
+    const HorizontalAlignment& element = alignment.Element(index);
+    const double length = element.Length();
+    const bool lastElement = index + 1 == alignment.ElementCount();
+    VisitScratch& scratch = visitScratch;
+
+    // Segments candidats : cellules recouvertes par la boîte exacte de l'élément, puis segments dont la
+    // boîte recoupe celle de l'élément
+    const BoundingBox bounds = element.Bounds();
+    _grid.Candidates(bounds, scratch.visited, scratch.candidates);
+    std::erase_if(scratch.candidates, [&](std::uint32_t segment) { return !bounds.Intersects(_segmentBounds[segment]); });
+    if (scratch.candidates.empty()) {
+        return;
+    }
+
+    // Sommets des clotoïdes, de même pas en station, la polyligne restant à moins de maxThrow de la courbe
+    const bool clotoide = element.Type() == HorizontalAlignment::H_Type::Transition;
+    std::vector<Point2D>& points = scratch.points;
+    if (clotoide) {
+        const std::size_t segmentCount = element.ChordSegmentCount(maxThrow);
+        scratch.abscissas.resize(segmentCount + 1);
+        HorizontalAlignment::UniformAbscissas(length, scratch.abscissas);
+        points.resize(segmentCount + 1);
+        element.Point(scratch.abscissas, points);
+    }
+    const auto* line = dynamic_cast<const StraightAlignment*>(&element);
+    const auto* arc = dynamic_cast<const CurvedAlignment*>(&element);
+
+    for (const std::uint32_t segment : scratch.candidates) {
+        const Point2D& a = _starts[segment];
+        const Vector2D d = _ends[segment] - a;
+        const double d2 = d * d;
+        if (d2 == 0.0) {
+            continue;
+        }
+        // Le sommet final d'un segment appartient au segment suivant de la polyligne, sauf pour le dernier
+        const bool lastSegment = segment + 1 == _firstSegments[_polylines[segment] + 1];
+        auto report = [&](double s, const Point2D& point) {
+            const double t = ((point - a) * d) / d2;
+            if (!(s >= 0.0 && (s < length || (lastElement && s <= length)))) {
+                return;
+            }
+            if (!(t >= 0.0 && (t < 1.0 || (lastSegment && t <= 1.0)))) {
+                return;
+            }
+            const Vector2D tangent = Tangent(element, s);
+            const std::uint32_t polyline = _polylines[segment];
+            crossings.push_back(SegmentCrossing{alignment.ElementStation(index) + s, point, polyline, segment - _firstSegments[polyline], t,
+                                                std::atan2(tangent / d, tangent * d)});
+        };
+
+        if (line != nullptr) {
+            const Point2D crossing = GeometryUtils::IntersectionStraightStraight(line->getStartingPoint(), line->Direction(), a, d);
+            if (!std::isnan(crossing.X)) {
+                report((crossing - line->getStartingPoint()) * line->Direction(), crossing);
+            }
+        } else if (arc != nullptr) {
+            // |a + t·d - c|² = R², racines stables numériquement
+            const Vector2D w = a - arc->CenterPoint();
+            const double radius = std::fabs(arc->SignedRadius());
+            const double b = d * w;
+            const double c = w * w - radius * radius;
+            const double discriminant = b * b - d2 * c;
+            if (discriminant < 0.0) {
+                continue;
+            }
+            const double q = -(b + std::copysign(std::sqrt(discriminant), b));
+            double roots[2] = {q / d2, q != 0.0 ? c / q : q / d2};
+            const std::size_t rootCount = discriminant == 0.0 ? 1 : 2;
+            for (std::size_t r = 0; r < rootCount; ++r) {
+                const Point2D point = a + d * roots[r];
+                // Restriction au secteur de l'arc : la projection d'un point du cercle hors de l'arc est une extrémité
+                const double s = arc->Projection(point, 0.0);
+                if ((arc->Point(s) - point).Length() <= 1e-9 * (1.0 + radius)) {
+                    report(s, point);
+                }
+            }
+        } else {
+            // Distance signée des sommets à la droite du segment, changements de signe affinés
+            const Vector2D normal = d.Rotated90CounterClockWise() / std::sqrt(d2);
+            std::vector<double>& f = scratch.signedDistances;
+            f.resize(points.size());
+            for (std::size_t k = 0; k < points.size(); ++k) {
+                f[k] = (points[k] - a) * normal;
+            }
+            for (std::size_t k = 0; k + 1 < points.size(); ++k) {
+                if (f[k] == 0.0) {
+                    report(scratch.abscissas[k], points[k]);
+                } else if ((f[k] < 0.0) != (f[k + 1] < 0.0) && f[k + 1] != 0.0) {
+                    const double s = ClotoideRoot(element, a, normal, scratch.abscissas[k], f[k], scratch.abscissas[k + 1]);
+                    report(s, element.Point(s));
+                }
+            }
+            if (f.back() == 0.0) {
+                report(length, points.back());
+            }
+        }
+    }
+}
+
+std::vector<SegmentCrossing> SegmentIntersector::Intersect(const Alignment& alignment, double maxThrow, unsigned threadCount) const {
+    HorizontalAlignment::CheckMaxThrow(maxThrow);
+    const std::size_t elementCount = alignment.ElementCount();
+    const std::size_t chunkCount = std::min<std::size_t>(BatchUtils::ThreadCount(threadCount), std::max<std::size_t>(1, elementCount / MinElementsPerThread));
+
+    // Plages contiguës d'éléments, une par thread, concaténées dans l'ordre
+    std::vector<std::vector<SegmentCrossing>> results(chunkCount);
+    BatchUtils::ParallelFor(chunkCount, static_cast<unsigned>(chunkCount), [&](std::size_t t) {
+        const std::size_t last = elementCount * (t + 1) / chunkCount;
+        for (std::size_t i = elementCount * t / chunkCount; i < last; ++i) {
+            IntersectElement(alignment, i, maxThrow, results[t]);
+        }
+    });
+
+    std::vector<SegmentCrossing> crossings;
+    for (std::vector<SegmentCrossing>& result : results) {
+        crossings.insert(crossings.end(), result.begin(), result.end());
+    }
+    std::sort(crossings.begin(), crossings.end(), [](const SegmentCrossing& x, const SegmentCrossing& y) {
+        return x.Station != y.Station ? x.Station < y.Station
+                                      : (x.Polyline != y.Polyline ? x.Polyline < y.Polyline : x.Segment < y.Segment);
+    });
+    return crossings;
+}
+
+} // namespace LineaCore::Geometry::Alignments
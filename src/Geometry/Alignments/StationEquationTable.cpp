@@ -0,0 +1,162 @@
+// StationEquationTable.cpp
+
+#include "LineaCore/Geometry/Alignments/StationEquationTable.hpp"
+#include "LineaCore/Geometry/Alignments/BatchUtils.hpp"
+#include "LineaCore/LandXML/XMLUtils.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace LineaCore::Geometry::Alignments {
+
+namespace {
+
+[[noreturn]] void ThrowMissingStation(double externalStation) {
+    throw std::runtime_error("External station " + std::to_string(externalStation) + " does not exist (skipped by a station equation)");
+}
+
+} // namespace
+
+StationEquationTable::StationEquationTable()
+    : StationEquationTable(std::vector<StationEquation>()) {}
+
+StationEquationTable::StationEquationTable(std::vector<StationEquation> equations)
+    : _equations(std::move(equations)), _increasing(true) {
+    // Les documents n'écrivent pas toujours les équations dans l'ordre de l'axe
+    std::stable_sort(_equations.begin(), _equations.end(), [](const StationEquation& a, const StationEquation& b) {
+        return a.StaInternal < b.StaInternal;
+    });
+    const std::size_t n = _equations.size();
+    constexpr double infinity = std::numeric_limits<double>::infinity();
+    _internalStations.resize(n);
+    _offsets.assign(1, 0.0);
+    _zoneStarts.assign(1, -infinity);
+    _zoneEnds.clear();
+    for (std::size_t k = 0; k < n; ++k) {
+        const StationEquation& equation = _equations[k];
+        if (!std::isfinite(equation.StaInternal)) {
+            throw std::runtime_error("Station equation internal station must be finite (got " + std::to_string(equation.StaInternal) + ")");
+        }
+        if (k > 0 && equation.StaInternal == _equations[k - 1].StaInternal) {
+            throw std::runtime_error("Duplicate station equations at internal station " + std::to_string(equation.StaInternal));
+        }
+        _internalStations[k] = equation.StaInternal;
+        _zoneEnds.push_back(equation.StaInternal + _offsets.back());
+        _offsets.push_back(equation.StaAhead - equation.StaInternal);
+        _zoneStarts.push_back(equation.StaAhead);
+        _increasing = _increasing && _zoneStarts.back() >= _zoneEnds.back();
+    }
+    _zoneEnds.push_back(infinity);
+}
+
+std::size_t StationEquationTable::EquationCount() const {
+    return _equations.size();
+}
+
+std::span<const StationEquation> StationEquationTable::Equations() const {
+    return _equations;
+}
+
+double StationEquationTable::StaBackDeviation(std::size_t index) const {
+    return _equations.at(index).StaBack - _zoneEnds.at(index);
+}
+
+bool StationEquationTable::IsIncreasing() const {
+    return _increasing;
+}
+
+std::size_t StationEquationTable::Zone(double internalStation) const {
+    return static_cast<std::size_t>(std::upper_bound(_internalStations.begin(), _internalStations.end(), internalStation) - _internalStations.begin());
+}
+
+std::size_t StationEquationTable::ExternalZone(double externalStation) const {
+    if (_increasing) {
+        const std::size_t zone = static_cast<std::size_t>(std::upper_bound(_zoneStarts.begin() + 1, _zoneStarts.end(), externalStation) - _zoneStarts.begin()) - 1;
+        if (externalStation > _zoneEnds[zone]) {
+            ThrowMissingStation(externalStation);
+        }
+        return zone;
+    }
+    // Chaînage non croissant : première zone contenant la station
+    for (std::size_t zone = 0; zone < _zoneStarts.size(); ++zone) {
+        if (externalStation >= _zoneStarts[zone] && externalStation <= _zoneEnds[zone]) {
+            return zone;
+        }
+    }
+    ThrowMissingStation(externalStation);
+}
+
+double StationEquationTable::ExternalStation(double internalStation) const {
+    return internalStation + _offsets[Zone(internalStation)];
+}
+
+double StationEquationTable::InternalStation(double externalStation) const {
+    return externalStation - _offsets[ExternalZone(externalStation)];
+}
+
+void StationEquationTable::ExternalStations(std::span<const double> internalStations, std::span<double> externalStations) const {
+    BatchUtils::CheckBatchSize(internalStations.size(), externalStations.size());
+    // Curseur de zone : pour des stations triées, la zone courante est presque toujours la bonne et
+    // la recherche dichotomique n'est faite qu'au changement de zone. Les tableaux peuvent se recouvrir.
+    constexpr double infinity = std::numeric_limits<double>::infinity();
+    const std::size_t n = _equations.size();
+    double start = infinity, end = -infinity, offset = 0.0;
+    for (std::size_t i = 0; i < internalStations.size(); ++i) {
+        const double station = internalStations[i];
+        if (!(station >= start && station < end)) {
+            const std::size_t zone = Zone(station);
+            start = zone == 0 ? -infinity : _internalStations[zone - 1];
+            end = zone == n ? infinity : _internalStations[zone];
+            offset = _offsets[zone];
+        }
+        externalStations[i] = station + offset;
+    }
+}
+
+void StationEquationTable::InternalStations(std::span<const double> externalStations, std::span<double> internalStations) const {
+    BatchUtils::CheckBatchSize(externalStations.size(), internalStations.size());
+    if (!_increasing) {
+        for (std::size_t i = 0; i < externalStations.size(); ++i) {
+            internalStations[i] = InternalStation(externalStations[i]);
+        }
+        return;
+    }
+
+    // Même curseur, sur les stations externes de début de zone ; la fin de zone écarte les sauts
+    constexpr double infinity = std::numeric_limits<double>::infinity();
+    const std::size_t n = _equations.size();
+    double start = infinity, next = -infinity, end = -infinity, offset = 0.0;
+    for (std::size_t i = 0; i < externalStations.size(); ++i) {
+        const double station = externalStations[i];
+        if (!(station >= start && station < next)) {
+            const std::size_t zone = ExternalZone(station);
+            start = _zoneStarts[zone];
+            next = zone == n ? infinity : _zoneStarts[zone + 1];
+            end = _zoneEnds[zone];
+            offset = _offsets[zone];
+        } else if (station > end) {
+            ThrowMissingStation(station);
+        }
+        internalStations[i] = station - offset;
+    }
+}
+
+StationEquation StationEquationTable::ReadEquation(xmlTextReaderPtr reader) {
+    StationEquation equation;
+    equation.StaInternal = LandXML::XMLUtils::ReadAttributeAsDouble(reader, "staInternal");
+    equation.StaBack = LandXML::XMLUtils::ReadAttributeAsDouble(reader, "staBack");
+    equation.StaAhead = LandXML::XMLUtils::ReadAttributeAsDouble(reader, "staAhead");
+    return equation;
+}
+
+void StationEquationTable::WriteEquation(xmlTextWriterPtr writer, const StationEquation& equation) {
+    xmlTextWriterStartElement(writer, BAD_CAST "StaEquation");
+    xmlTextWriterWriteFormatAttribute(writer, BAD_CAST "staAhead", "%.15g", equation.StaAhead);
+    xmlTextWriterWriteFormatAttribute(writer, BAD_CAST "staBack", "%.15g", equation.StaBack);
+    xmlTextWriterWriteFormatAttribute(writer, BAD_CAST "staInternal", "%.15g", equation.StaInternal);
+    xmlTextWriterEndElement(writer);
+}
+
+} // namespace LineaCore::Geometry::Alignments
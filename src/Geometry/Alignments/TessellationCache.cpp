@@ -0,0 +1,140 @@
+// TessellationCache.cpp
+
+#include "LineaCore/Geometry/Alignments/TessellationCache.hpp"
+#include <cmath>
+#include <functional>
+
+namespace LineaCore::Geometry::Alignments {
+
+using namespace Horizontal;
+
+namespace {
+
+constexpr std::size_t EntryOverhead = 96;   // Estimation du coût d'une entrée hors points (liste, table, bloc partagé)
+
+} // namespace
+
+std::size_t TessellationCache::KeyHash::operator()(const Key& key) const {
+    const std::size_t h = std::hash<const void*>()(key.Element);
+    return h ^ (static_cast<std::size_t>(key.Level) * 0x9E3779B97F4A7C15ull + (h << 6) + (h >> 2));
+}
+
+TessellationCache::TessellationCache(std::size_t byteBudget, double baseThrow)
+    : _byteBudget(byteBudget), _baseThrow(baseThrow), _bytes(0), _hits(0), _misses(0), _evictions(0) {
+    HorizontalAlignment::CheckMaxThrow(baseThrow);
+}
+
+int TessellationCache::Level(double maxThrow) const {
+    HorizontalAlignment::CheckMaxThrow(maxThrow);
+    // maxThrow / baseThrow = m·2^e avec m dans [0.5, 1) : le niveau e - 1 est le plus grand dont la flèche ne dépasse pas maxThrow
+    int exponent;
+    std::frexp(maxThrow / _baseThrow, &exponent);
+    int level = exponent - 1;
+    if (LevelThrow(level) > maxThrow) {
+        --level; // Arrondi de la division
+    }
+    return level;
+}
+
+double TessellationCache::LevelThrow(int level) const {
+    return std::ldexp(_baseThrow, level);
+}
+
+TessellationCache::Polyline TessellationCache::Find(const Key& key) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _index.find(key);
+    if (it == _index.end()) {
+        return nullptr;
+    }
+    _entries.splice(_entries.begin(), _entries, it->second);
+    return it->second->Points;
+}
+
+TessellationCache::Polyline TessellationCache::Insert(const Key& key, Polyline points) {
+    const std::size_t bytes = points->capacity() * sizeof(Point2D) + EntryOverhead;
+    if (bytes > _byteBudget) {
+        return points; // Trop volumineux pour être conservé
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _index.find(key);
+    if (it != _index.end()) {
+        // Calculé entre-temps par un autre thread : l'entrée existante est conservée
+        _entries.splice(_entries.begin(), _entries, it->second);
+        return it->second->Points;
+    }
+    _entries.push_front(Entry{key, points, bytes});
+    _index.emplace(key, _entries.begin());
+    _bytes += bytes;
+    EvictOverBudget();
+    return points;
+}
+
+void TessellationCache::EvictOverBudget() {
+    while (_bytes > _byteBudget && !_entries.empty()) {
+        const Entry& oldest = _entries.back();
+        _bytes -= oldest.Bytes;
+        _index.erase(oldest.EntryKey);
+        _entries.pop_back();
+        _evictions.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+TessellationCache::Polyline TessellationCache::Points(const HorizontalAlignment& element, double maxThrow) {
+    const Key key{&element, Level(maxThrow)};
+    if (Polyline cached = Find(key)) {
+        _hits.fetch_add(1, std::memory_order_relaxed);
+        return cached;
+    }
+    _misses.fetch_add(1, std::memory_order_relaxed);
+
+    // Discrétisation hors verrou : les autres threads ne sont pas bloqués par le calcul
+    auto points = std::make_shared<const std::vector<Point2D>>(element.Points(LevelThrow(key.Level)));
+    return Insert(key, std::move(points));
+}
+
+void TessellationCache::Warm(const HorizontalAlignment& element, double minThrow, double maxThrow) {
+    HorizontalAlignment::CheckMaxThrow(maxThrow);
+    const int first = Level(minThrow);
+    const int last = Level(maxThrow);
+    for (int level = first; level <= last; ++level) {
+        const Key key{&element, level};
+        if (!Find(key)) {
+            Insert(key, std::make_shared<const std::vector<Point2D>>(element.Points(LevelThrow(level))));
+        }
+    }
+}
+
+void TessellationCache::Warm(const Alignment& alignment, double minThrow, double maxThrow) {
+    for (std::size_t i = 0; i < alignment.ElementCount(); ++i) {
+        Warm(alignment.Element(i), minThrow, maxThrow);
+    }
+}
+
+void TessellationCache::Invalidate(const HorizontalAlignment& element) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (auto it = _entries.begin(); it != _entries.end();) {
+        if (it->EntryKey.Element == &element) {
+            _bytes -= it->Bytes;
+            _index.erase(it->EntryKey);
+            it = _entries.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void TessellationCache::Clear() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _entries.clear();
+    _index.clear();
+    _bytes = 0;
+}
+
+TessellationCache::Statistics TessellationCache::GetStatistics() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return Statistics{_hits.load(std::memory_order_relaxed), _misses.load(std::memory_order_relaxed),
+                      _evictions.load(std::memory_order_relaxed), _entries.size(), _bytes};
+}
+
+} // namespace LineaCore::Geometry::Alignments
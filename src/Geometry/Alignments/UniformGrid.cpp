@@ -0,0 +1,140 @@
+// UniformGrid.cpp
+
+#include "LineaCore/Geometry/Alignments/UniformGrid.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace LineaCore::Geometry::Alignments {
+
+namespace {
+
+constexpr std::size_t MaxCellCount = 1 << 22;
+
+// Index de cellule d'une coordonnée, ramené dans [0, count - 1] (NaN donne 0)
+std::size_t CellIndex(double coordinate, double origin, double cellSize, std::size_t count) {
+    const double index = (coordinate - origin) / cellSize;
+    return index > 0.0 ? static_cast<std::size_t>(std::min(index, static_cast<double>(count - 1))) : 0;
+}
+
+} // namespace
+
+void VisitStamps::NextQuery(std::size_t itemCount) {
+    if (_stamps.size() < itemCount) {
+        _stamps.resize(itemCount, 0);
+    }
+    if (++_stamp == 0) {
+        std::fill(_stamps.begin(), _stamps.end(), 0);
+        _stamp = 1;
+    }
+}
+
+bool VisitStamps::Visit(std::uint32_t item) {
+    if (_stamps[item] == _stamp) {
+        return false;
+    }
+    _stamps[item] = _stamp;
+    return true;
+}
+
+UniformGrid::UniformGrid() : _itemCount(0), _minX(0.0), _minY(0.0), _cellSize(1.0), _columns(1), _rows(1), _cellStarts(2, 0) {}
+
+UniformGrid::UniformGrid(std::span<const BoundingBox> boxes, std::size_t cellsPerBox) : _itemCount(boxes.size()) {
+    BoundingBox extent;
+    for (const BoundingBox& box : boxes) {
+        extent.Extend(box);
+    }
+    if (extent.IsEmpty()) {
+        extent = BoundingBox(0.0, 0.0, 0.0, 0.0);
+    }
+
+    const double width = extent.Width();
+    const double height = extent.Height();
+    const double targetCells = static_cast<double>(std::clamp<std::size_t>(boxes.size() * cellsPerBox, 1, MaxCellCount));
+    _cellSize = std::max({std::sqrt(width * height / targetCells), std::max(width, height) / targetCells, 1E-6});
+    _columns = std::max<std::size_t>(1, static_cast<std::size_t>(std::ceil(width / _cellSize)));
+    _rows = std::max<std::size_t>(1, static_cast<std::size_t>(std::ceil(height / _cellSize)));
+    _minX = extent.MinX;
+    _minY = extent.MinY;
+
+    // Stockage compressé par ligne : comptage puis remplissage
+    _cellStarts.assign(_columns * _rows + 1, 0);
+    for (const BoundingBox& box : boxes) {
+        const CellRange range = Range(box);
+        for (std::size_t r = range.FirstRow; r <= range.LastRow; ++r) {
+            for (std::size_t c = range.FirstColumn; c <= range.LastColumn; ++c) {
+                ++_cellStarts[r * _columns + c + 1];
+            }
+        }
+    }
+    for (std::size_t k = 1; k < _cellStarts.size(); ++k) {
+        _cellStarts[k] += _cellStarts[k - 1];
+    }
+    _cellItems.resize(_cellStarts.back());
+    std::vector<std::uint32_t> fill(_cellStarts.begin(), _cellStarts.end() - 1);
+    for (std::size_t i = 0; i < boxes.size(); ++i) {
+        const CellRange range = Range(boxes[i]);
+        for (std::size_t r = range.FirstRow; r <= range.LastRow; ++r) {
+            for (std::size_t c = range.FirstColumn; c <= range.LastColumn; ++c) {
+                _cellItems[fill[r * _columns + c]++] = static_cast<std::uint32_t>(i);
+            }
+        }
+    }
+}
+
+std::size_t UniformGrid::ItemCount() const {
+    return _itemCount;
+}
+
+double UniformGrid::MinX() const {
+    return _minX;
+}
+
+double UniformGrid::MinY() const {
+    return _minY;
+}
+
+double UniformGrid::CellSize() const {
+    return _cellSize;
+}
+
+std::size_t UniformGrid::Columns() const {
+    return _columns;
+}
+
+std::size_t UniformGrid::Rows() const {
+    return _rows;
+}
+
+BoundingBox UniformGrid::Bounds() const {
+    return BoundingBox(_minX, _minY, _minX + static_cast<double>(_columns) * _cellSize, _minY + static_cast<double>(_rows) * _cellSize);
+}
+
+UniformGrid::CellRange UniformGrid::Range(const BoundingBox& box) const {
+    return CellRange{CellIndex(box.MinX, _minX, _cellSize, _columns), CellIndex(box.MaxX, _minX, _cellSize, _columns),
+                     CellIndex(box.MinY, _minY, _cellSize, _rows), CellIndex(box.MaxY, _minY, _cellSize, _rows)};
+}
+
+std::span<const std::uint32_t> UniformGrid::CellItems(std::size_t column, std::size_t row) const {
+    const std::size_t cell = row * _columns + column;
+    return std::span<const std::uint32_t>(_cellItems.data() + _cellStarts[cell], _cellStarts[cell + 1] - _cellStarts[cell]);
+}
+
+void UniformGrid::Candidates(const BoundingBox& box, VisitStamps& visited, std::vector<std::uint32_t>& items) const {
+    items.clear();
+    if (_itemCount == 0 || !box.Intersects(Bounds())) {
+        return;
+    }
+    visited.NextQuery(_itemCount);
+    const CellRange range = Range(box);
+    for (std::size_t r = range.FirstRow; r <= range.LastRow; ++r) {
+        for (std::size_t c = range.FirstColumn; c <= range.LastColumn; ++c) {
+            for (std::uint32_t item : CellItems(c, r)) {
+                if (visited.Visit(item)) {
+                    items.push_back(item);
+                }
+            }
+        }
+    }
+}
+
+} // namespace LineaCore::Geometry::Alignments
@@ -0,0 +1,298 @@
+// VerticalAlignment.cpp
+
+#include "LineaCore/Geometry/Alignments/Vertical/VerticalAlignment.hpp"
+#include "LineaCore/Geometry/Alignments/BatchUtils.hpp"
+#include "LineaCore/LandXML/XMLUtils.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+namespace LineaCore::Geometry::Alignments::Vertical {
+
+namespace {
+
+// Tolérance de chevauchement entre deux raccordements (arrondis des fichiers)
+constexpr double OverlapTolerance = 1E-6;
+
+std::string FormatStation(double station) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%.6f", station);
+    return buffer;
+}
+
+} // namespace
+
+// Segment
+
+double VerticalAlignment::Segment::Elevation(double start, double station) const {
+    if (IsCircle) {
+        const double u = station - A;
+        return B - (C > 0.0 ? 1.0 : -1.0) * std::sqrt(std::max(0.0, C * C - u * u));
+    }
+    const double t = station - start;
+    return A + t * (B + t * C);
+}
+
+double VerticalAlignment::Segment::Grade(double start, double station) const {
+    if (IsCircle) {
+        const double u = station - A;
+        return (C > 0.0 ? 1.0 : -1.0) * u / std::sqrt(std::max(0.0, C * C - u * u));
+    }
+    return B + 2.0 * C * (station - start);
+}
+
+double VerticalAlignment::Segment::Curvature(double start, double station) const {
+    if (IsCircle) {
+        return 1.0 / C;
+    }
+    const double grade = B + 2.0 * C * (station - start);
+    return 2.0 * C / std::pow(1.0 + grade * grade, 1.5);
+}
+
+// VerticalAlignment
+
+VerticalAlignment::VerticalAlignment() = default;
+
+VerticalAlignment::VerticalAlignment(std::string name, std::vector<VerticalPVI> pvis)
+    : _name(std::move(name)), _pvis(std::move(pvis)) {
+    BuildSegments();
+}
+
+void VerticalAlignment::BuildSegments() {
+    const std::size_t n = _pvis.size();
+    if (n < 2) {
+        throw std::runtime_error("Vertical alignment '" + _name + "' requires at least two PVI");
+    }
+    for (std::size_t i = 1; i < n; ++i) {
+        if (!(_pvis[i].Station > _pvis[i - 1].Station)) {
+            throw std::runtime_error("PVI stations of vertical alignment '" + _name + "' are not increasing at station " + FormatStation(_pvis[i].Station));
+        }
+    }
+    if (_pvis.front().Curve != VerticalPVI::CurveType::None || _pvis.back().Curve != VerticalPVI::CurveType::None) {
+        throw std::runtime_error("First and last PVI of vertical alignment '" + _name + "' cannot carry a vertical curve");
+    }
+
+    _stations.clear();
+    _segments.clear();
+
+    // Alignement droit sur la pente du PVI i-1 au PVI i, de la station 'from' à la station 'to'
+    auto addTangent = [this](std::size_t i, double from, double to) {
+        const VerticalPVI& p0 = _pvis[i - 1];
+        const VerticalPVI& p1 = _pvis[i];
+        const double grade = (p1.Elevation - p0.Elevation) / (p1.Station - p0.Station);
+        if (to > from || _segments.empty()) {
+            _stations.push_back(from);
+            _segments.push_back(Segment{false, p0.Elevation + grade * (from - p0.Station), grade, 0.0});
+        }
+    };
+
+    double current = _pvis.front().Station;   // Fin du dernier tronçon ajouté
+    for (std::size_t i = 1; i + 1 < n; ++i) {
+        VerticalPVI& pvi = _pvis[i];
+        const VerticalPVI& previous = _pvis[i - 1];
+        const VerticalPVI& next = _pvis[i + 1];
+        const double g1 = (pvi.Elevation - previous.Elevation) / (pvi.Station - previous.Station);
+        const double g2 = (next.Elevation - pvi.Elevation) / (next.Station - pvi.Station);
+
+        double begin = pvi.Station, end = pvi.Station;
+        Segment curve{false, 0.0, 0.0, 0.0};
+        if (pvi.Curve == VerticalPVI::CurveType::Parabola && pvi.Length > 0.0) {
+            begin = pvi.Station - pvi.Length / 2.0;
+            end = pvi.Station + pvi.Length / 2.0;
+            curve = Segment{false, pvi.Elevation - g1 * pvi.Length / 2.0, g1, (g2 - g1) / (2.0 * pvi.Length)};
+        } else if (pvi.Curve == VerticalPVI::CurveType::Circle && pvi.Radius > 0.0 && g1 != g2) {
+            // Cercle tangent aux deux pentes ; centre du côté de la concavité
+            const double theta1 = std::atan(g1), theta2 = std::atan(g2);
+            const double sign = theta2 > theta1 ? 1.0 : -1.0;
+            const double tangentLength = pvi.Radius * std::tan(std::fabs(theta2 - theta1) / 2.0);
+            begin = pvi.Station - tangentLength * std::cos(theta1);
+            end = pvi.Station + tangentLength * std::cos(theta2);
+            const double beginElevation = pvi.Elevation - tangentLength * std::sin(theta1);
+            curve = Segment{true, begin - sign * pvi.Radius * std::sin(theta1), beginElevation + sign * pvi.Radius * std::cos(theta1), sign * pvi.Radius};
+            pvi.Length = end - begin;
+        } else {
+            // Changement de pente sans raccordement
+            addTangent(i, current, pvi.Station);
+            current = std::max(pvi.Station, current);
+            continue;
+        }
+
+        if (begin < current - OverlapTolerance || end > next.Station + OverlapTolerance) {
+            throw std::runtime_error("Vertical curve at station " + FormatStation(pvi.Station) + " overlaps another curve in vertical alignment '" + _name + "'");
+        }
+        addTangent(i, current, begin);
+        _stations.push_back(std::max(begin, current));
+        _segments.push_back(curve);
+        current = std::max(end, current);
+    }
+    addTangent(n - 1, current, _pvis.back().Station);
+    _stations.push_back(_pvis.back().Station);
+}
+
+const std::string& VerticalAlignment::Name() const {
+    return _name;
+}
+
+double VerticalAlignment::StaStart() const {
+    return _pvis.empty() ? 0.0 : _pvis.front().Station;
+}
+
+double VerticalAlignment::StaEnd() const {
+    return _pvis.empty() ? 0.0 : _pvis.back().Station;
+}
+
+std::span<const VerticalPVI> VerticalAlignment::PVIs() const {
+    return _pvis;
+}
+
+std::size_t VerticalAlignment::SegmentCount() const {
+    return _segments.size();
+}
+
+std::span<const double> VerticalAlignment::SegmentStations() const {
+    return _stations;
+}
+
+std::size_t VerticalAlignment::SegmentIndex(double station) const {
+    if (_segments.empty()) {
+        throw std::runtime_error("Vertical alignment '" + _name + "' has no segment");
+    }
+    auto it = std::upper_bound(_stations.begin() + 1, _stations.end() - 1, station);
+    return static_cast<std::size_t>(it - _stations.begin()) - 1;
+}
+
+double VerticalAlignment::Elevation(double station) const {
+    const std::size_t i = SegmentIndex(station);
+    return _segments[i].Elevation(_stations[i], station);
+}
+
+double VerticalAlignment::Grade(double station) const {
+    const std::size_t i = SegmentIndex(station);
+    return _segments[i].Grade(_stations[i], station);
+}
+
+double VerticalAlignment::VerticalCurvature(double station) const {
+    const std::size_t i = SegmentIndex(station);
+    return _segments[i].Curvature(_stations[i], station);
+}
+
+template <typename SegmentFunction>
+void VerticalAlignment::EvaluateBatch(std::span<const double> stations, std::span<double> values, SegmentFunction evaluate) const {
+    BatchUtils::CheckBatchSize(stations.size(), values.size());
+    if (stations.empty()) {
+        return;
+    }
+
+    // Le tronçon courant est conservé tant que les stations y restent (stations croissantes)
+    const std::size_t last = _segments.size() - 1;
+    std::size_t i = SegmentIndex(stations[0]);
+    for (std::size_t k = 0; k < stations.size(); ++k) {
+        const double station = stations[k];
+        if ((i > 0 && station < _stations[i]) || (i < last && station >= _stations[i + 1])) {
+            if (i < last && station >= _stations[i + 1] && (i + 1 == last || station < _stations[i + 2])) {
+                ++i;
+            } else {
+                i = SegmentIndex(station);
+            }
+        }
+        values[k] = evaluate(_segments[i], _stations[i], station);
+    }
+}
+
+void VerticalAlignment::Elevation(std::span<const double> stations, std::span<double> elevations) const {
+    EvaluateBatch(stations, elevations, [](const Segment& segment, double start, double station) { return segment.Elevation(start, station); });
+}
+
+void VerticalAlignment::Grade(std::span<const double> stations, std::span<double> grades) const {
+    EvaluateBatch(stations, grades, [](const Segment& segment, double start, double station) { return segment.Grade(start, station); });
+}
+
+void VerticalAlignment::VerticalCurvature(std::span<const double> stations, std::span<double> curvatures) const {
+    EvaluateBatch(stations, curvatures, [](const Segment& segment, double start, double station) { return segment.Curvature(start, station); });
+}
+
+void VerticalAlignment::Evaluate(std::span<const double> stations, std::span<double> elevations, std::span<double> grades) const {
+    BatchUtils::CheckBatchSize(stations.size(), grades.size());
+    std::size_t k = 0;
+    EvaluateBatch(stations, elevations, [&grades, &k](const Segment& segment, double start, double station) {
+        grades[k++] = segment.Grade(start, station);
+        return segment.Elevation(start, station);
+    });
+}
+
+void VerticalAlignment::ReadLandXML(xmlTextReaderPtr reader) {
+    std::string name = LandXML::XMLUtils::ReadAttributeAsString(reader, "name");
+    std::vector<VerticalPVI> pvis;
+
+    if (!xmlTextReaderIsEmptyElement(reader)) {
+        while (xmlTextReaderRead(reader) == 1) {
+            const int nodeType = xmlTextReaderNodeType(reader);
+            const char* nodeName = reinterpret_cast<const char*>(xmlTextReaderConstLocalName(reader));
+            if (nodeType == XML_READER_TYPE_ELEMENT) {
+                VerticalPVI pvi;
+                if (std::strcmp(nodeName, "PVI") == 0) {
+                    pvi.Curve = VerticalPVI::CurveType::None;
+                } else if (std::strcmp(nodeName, "ParaCurve") == 0) {
+                    pvi.Curve = VerticalPVI::CurveType::Parabola;
+                    pvi.Length = LandXML::XMLUtils::ReadAttributeAsDouble(reader, "length");
+                } else if (std::strcmp(nodeName, "CircCurve") == 0) {
+                    pvi.Curve = VerticalPVI::CurveType::Circle;
+                    pvi.Length = LandXML::XMLUtils::ReadAttributeAsDouble(reader, "length");
+                    pvi.Radius = std::fabs(LandXML::XMLUtils::ReadAttributeAsDouble(reader, "radius"));
+                } else if (std::strcmp(nodeName, "UnsymParaCurve") == 0) {
+                    throw std::runtime_error("Unsupported element <UnsymParaCurve> in <ProfAlign> '" + name + "'");
+                } else {
+                    continue;
+                }
+                // Contenu "station altitude"
+                const std::string elementName = nodeName;
+                double content[2];
+                LandXML::XMLUtils::ReadContentAsNumbers(reader, elementName, content);
+                pvi.Station = content[0];
+                pvi.Elevation = content[1];
+                pvis.push_back(pvi);
+            } else if (nodeType == XML_READER_TYPE_END_ELEMENT && std::strcmp(nodeName, "ProfAlign") == 0) {
+                break;
+            }
+        }
+    }
+
+    _name = std::move(name);
+    _pvis = std::move(pvis);
+    BuildSegments();
+}
+
+void VerticalAlignment::WriteLandXML(xmlTextWriterPtr writer) const {
+    xmlTextWriterStartElement(writer, BAD_CAST "ProfAlign");
+    xmlTextWriterWriteAttribute(writer, BAD_CAST "name", BAD_CAST _name.c_str());
+
+    for (std::size_t i = 0; i < _pvis.size(); ++i) {
+        const VerticalPVI& pvi = _pvis[i];
+        switch (pvi.Curve) {
+        case VerticalPVI::CurveType::Parabola:
+            xmlTextWriterStartElement(writer, BAD_CAST "ParaCurve");
+            xmlTextWriterWriteFormatAttribute(writer, BAD_CAST "length", "%.15g", pvi.Length);
+            break;
+        case VerticalPVI::CurveType::Circle: {
+            // Rayon positif pour un point haut, négatif pour un point bas
+            const double g1 = (pvi.Elevation - _pvis[i - 1].Elevation) / (pvi.Station - _pvis[i - 1].Station);
+            const double g2 = (_pvis[i + 1].Elevation - pvi.Elevation) / (_pvis[i + 1].Station - pvi.Station);
+            xmlTextWriterStartElement(writer, BAD_CAST "CircCurve");
+            xmlTextWriterWriteFormatAttribute(writer, BAD_CAST "radius", "%.15g", g2 > g1 ? -pvi.Radius : pvi.Radius);
+            xmlTextWriterWriteFormatAttribute(writer, BAD_CAST "length", "%.15g", pvi.Length);
+            break;
+        }
+        default:
+            xmlTextWriterStartElement(writer, BAD_CAST "PVI");
+            break;
+        }
+        xmlTextWriterWriteFormatString(writer, LandXML::xmlCoordFormat, pvi.Station, pvi.Elevation);
+        xmlTextWriterEndElement(writer);
+    }
+
+    xmlTextWriterEndElement(writer);
+}
+
+} // namespace LineaCore::Geometry::Alignments::Vertical
@@ -0,0 +1,157 @@
+// ViewportTessellator.cpp
+
+#include "LineaCore/Geometry/Alignments/ViewportTessellator.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <utility>
+
+namespace LineaCore::Geometry::Alignments {
+
+using namespace Horizontal;
+
+namespace {
+
+// Nombre maximal de segments d'un tronçon gardé sans subdivision : en deçà, les sommets hors de la
+// fenêtre coûtent moins que les tests de subdivision
+constexpr std::size_t LeafSegments = 32;
+
+using Run = std::pair<std::size_t, std::size_t>;   // Plage de sommets [first, last] de la grille d'un élément
+
+// Grille de sommets d'un élément : segments de même longueur, dont la flèche ne dépasse pas maxThrow
+struct ElementGrid {
+    const HorizontalAlignment* Element;
+    double Length;
+    std::size_t SegmentCount;
+
+    ElementGrid(const HorizontalAlignment& element, double maxThrow)
+        : Element(&element), Length(element.Length()), SegmentCount(element.ChordSegmentCount(maxThrow)) {}
+
+    double Station(std::size_t index) const {
+        return index == SegmentCount ? Length : Length * static_cast<double>(index) / static_cast<double>(SegmentCount);
+    }
+};
+
+// Plages de sommets des tronçons pouvant recouvrir la fenêtre, par ordre croissant, les plages contiguës étant fusionnées
+void CollectRuns(const ElementGrid& grid, std::size_t first, std::size_t last, const BoundingBox& window, std::vector<Run>& runs) {
+    const double start = grid.Station(first);
+    const double end = grid.Station(last);
+    const double radius = 0.5 * (end - start);
+    const Point2D middle = grid.Element->Point(start + radius);
+    if (window.Distance(middle) > radius) {
+        return;
+    }
+    if (last - first <= LeafSegments || window.Inflated(-radius).Contains(middle)) {
+        if (!runs.empty() && runs.back().second == first) {
+            runs.back().second = last;
+        } else {
+            runs.emplace_back(first, last);
+        }
+        return;
+    }
+    const std::size_t half = first + (last - first) / 2;
+    CollectRuns(grid, first, half, window, runs);
+    CollectRuns(grid, half, last, window, runs);
+}
+
+// Découpe de Liang–Barsky : paramètres [t0, t1] de la partie du segment [p, q] intérieure à la fenêtre
+bool ClipSegment(const Point2D& p, const Point2D& q, const BoundingBox& window, double& t0, double& t1) {
+    const double dx = q.X - p.X;
+    const double dy = q.Y - p.Y;
+    const double directions[4] = {-dx, dx, -dy, dy};
+    const double distances[4] = {p.X - window.MinX, window.MaxX - p.X, p.Y - window.MinY, window.MaxY - p.Y};
+    t0 = 0.0;
+    t1 = 1.0;
+    for (int k = 0; k < 4; ++k) {
+        if (directions[k] == 0.0) {
+            if (distances[k] < 0.0) {
+                return false;   // Parallèle au bord, à l'extérieur
+            }
+            continue;
+        }
+        const double t = distances[k] / directions[k];
+        if (directions[k] < 0.0) {
+            t0 = std::max(t0, t);
+        } else {
+            t1 = std::min(t1, t);
+        }
+        if (t0 > t1) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Ajoute à polylines les parties d'une polyligne intérieures à la fenêtre
+void ClipPolyline(std::span<const Point2D> points, const BoundingBox& window, std::vector<std::vector<Point2D>>& polylines) {
+    bool open = false;   // Le segment précédent se termine à l'intérieur de la fenêtre
+    for (std::size_t i = 0; i + 1 < points.size(); ++i) {
+        const Point2D& p = points[i];
+        const Point2D& q = points[i + 1];
+        double t0, t1;
+        if (!ClipSegment(p, q, window, t0, t1)) {
+            open = false;
+            continue;
+        }
+        if (!open || t0 > 0.0) {
+            polylines.emplace_back();
+            polylines.back().push_back(t0 == 0.0 ? p : p + (q - p) * t0);
+        }
+        polylines.back().push_back(t1 == 1.0 ? q : p + (q - p) * t1);
+        open = t1 == 1.0;
+    }
+}
+
+} // namespace
+
+ViewportTessellator::ViewportTessellator(const Alignment& alignment) : _alignment(&alignment), _tree(alignment) {}
+
+const Alignment& ViewportTessellator::GetAlignment() const {
+    return *_alignment;
+}
+
+std::vector<std::vector<Point2D>> ViewportTessellator::Tessellate(const BoundingBox& window, double pixelSize, double pixelTolerance) const {
+    if (window.IsEmpty()) {
+        throw std::runtime_error("Viewport window is empty");
+    }
+    if (!(pixelSize > 0.0) || !std::isfinite(pixelSize) || !(pixelTolerance > 0.0) || !std::isfinite(pixelTolerance)) {
+        throw std::runtime_error("Pixel size and pixel tolerance must be strictly positive and finite");
+    }
+    const double maxThrow = pixelSize * pixelTolerance;
+
+    std::vector<std::vector<Point2D>> polylines;
+    std::vector<Point2D> current;       // Polyligne en cours, avant découpe
+    std::vector<Run> runs;
+    std::vector<double> stations;
+    std::size_t previousElement = std::numeric_limits<std::size_t>::max();
+    bool previousAtEnd = false;         // La polyligne en cours se termine à la fin de l'élément précédent
+
+    for (std::size_t index : _tree.Query(window)) {
+        const ElementGrid grid(_alignment->Element(index), maxThrow);
+        runs.clear();
+        CollectRuns(grid, 0, grid.SegmentCount, window, runs);
+        for (const auto& [first, last] : runs) {
+            if (!current.empty() && first == 0 && previousAtEnd && previousElement + 1 == index) {
+                current.pop_back();     // Sommet de jonction : celui du début de l'élément suivant
+            } else {
+                ClipPolyline(current, window, polylines);
+                current.clear();
+            }
+            stations.resize(last - first + 1);
+            for (std::size_t k = 0; k < stations.size(); ++k) {
+                stations[k] = grid.Station(first + k);
+            }
+            const std::size_t offset = current.size();
+            current.resize(offset + stations.size());
+            _alignment->ElementPoints(index, stations, std::span<Point2D>(current).subspan(offset));
+            previousElement = index;
+            previousAtEnd = last == grid.SegmentCount;
+        }
+    }
+    ClipPolyline(current, window, polylines);
+    return polylines;
+}
+
+} // namespace LineaCore::Geometry::Alignments
@@ -0,0 +1,68 @@
+// BoundingBox.cpp
+#include "LineaCore/Geometry/BoundingBox.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace LineaCore::Geometry {
+
+// Constructeurs
+BoundingBox::BoundingBox()
+    : MinX(std::numeric_limits<double>::infinity()), MinY(std::numeric_limits<double>::infinity()),
+      MaxX(-std::numeric_limits<double>::infinity()), MaxY(-std::numeric_limits<double>::infinity()) {}
+
+BoundingBox::BoundingBox(double minX, double minY, double maxX, double maxY) : MinX(minX), MinY(minY), MaxX(maxX), MaxY(maxY) {}
+
+bool BoundingBox::IsEmpty() const {
+    return !(MinX <= MaxX && MinY <= MaxY);
+}
+
+double BoundingBox::Width() const {
+    return MaxX - MinX;
+}
+
+double BoundingBox::Height() const {
+    return MaxY - MinY;
+}
+
+// Extension
+void BoundingBox::Extend(const Point2D& p) {
+    MinX = std::min(MinX, p.X);
+    MinY = std::min(MinY, p.Y);
+    MaxX = std::max(MaxX, p.X);
+    MaxY = std::max(MaxY, p.Y);
+}
+
+void BoundingBox::Extend(const BoundingBox& box) {
+    MinX = std::min(MinX, box.MinX);
+    MinY = std::min(MinY, box.MinY);
+    MaxX = std::max(MaxX, box.MaxX);
+    MaxY = std::max(MaxY, box.MaxY);
+}
+
+BoundingBox BoundingBox::Inflated(double margin) const {
+    return BoundingBox(MinX - margin, MinY - margin, MaxX + margin, MaxY + margin);
+}
+
+// Requêtes
+bool BoundingBox::Intersects(const BoundingBox& box) const {
+    return MinX <= box.MaxX && box.MinX <= MaxX && MinY <= box.MaxY && box.MinY <= MaxY;
+}
+
+bool BoundingBox::Contains(const Point2D& p) const {
+    return p.X >= MinX && p.X <= MaxX && p.Y >= MinY && p.Y <= MaxY;
+}
+
+double BoundingBox::Distance(const Point2D& p) const {
+    const double dx = std::max({MinX - p.X, 0.0, p.X - MaxX});
+    const double dy = std::max({MinY - p.Y, 0.0, p.Y - MaxY});
+    return std::sqrt(dx * dx + dy * dy);
+}
+
+double BoundingBox::Distance(const BoundingBox& box) const {
+    const double dx = std::max({MinX - box.MaxX, 0.0, box.MinX - MaxX});
+    const double dy = std::max({MinY - box.MaxY, 0.0, box.MinY - MaxY});
+    return std::sqrt(dx * dx + dy * dy);
+}
+
+} // namespace LineaCore::Geometry
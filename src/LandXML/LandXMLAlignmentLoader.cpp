@@ -0,0 +1,239 @@
+// LandXMLAlignmentLoader.cpp
+
+#include "LineaCore/LandXML/LandXMLAlignmentLoader.hpp"
+#include "LineaCore/Geometry/Alignments/BatchUtils.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+namespace LineaCore::LandXML {
+
+using Geometry::Alignments::Alignment;
+using Geometry::Alignments::BatchUtils;
+
+namespace {
+
+bool IsNamed(xmlTextReaderPtr reader, const char* name) {
+    const char* nodeName = reinterpret_cast<const char*>(xmlTextReaderConstLocalName(reader));
+    return nodeName != nullptr && std::strcmp(nodeName, name) == 0;
+}
+
+// Lecture de tous les axes ; lineOffset corrige les numéros de ligne lorsque le lecteur porte sur une plage du document
+std::vector<Alignment> ReadAlignments(xmlTextReaderPtr reader, int lineOffset) {
+    std::vector<Alignment> alignments;
+    int status;
+    while ((status = xmlTextReaderRead(reader)) == 1) {
+        if (xmlTextReaderNodeType(reader) == XML_READER_TYPE_ELEMENT && IsNamed(reader, "Alignment")) {
+            Alignment alignment;
+            alignment.ReadLandXML(reader);
+            alignments.push_back(std::move(alignment));
+        }
+    }
+    if (status < 0) {
+        throw std::runtime_error("LandXML parse error near line " + std::to_string(xmlTextReaderGetParserLineNumber(reader) + lineOffset));
+    }
+    return alignments;
+}
+
+std::vector<Alignment> ReadBuffer(std::string_view buffer, const char* encoding, int lineOffset) {
+    // La taille est transmise à libxml2 sous forme d'int
+    if (buffer.size() > static_cast<std::size_t>(std::numeric_limits<int>::max())) {
+        throw std::runtime_error("LandXML buffer of " + std::to_string(buffer.size()) + " bytes exceeds the XML reader limit of " +
+                                 std::to_string(std::numeric_limits<int>::max()) + " bytes");
+    }
+    xmlTextReaderPtr reader = xmlReaderForMemory(buffer.data(), static_cast<int>(buffer.size()), nullptr, encoding, 0);
+    if (reader == nullptr) {
+        throw std::runtime_error("Cannot create LandXML reader");
+    }
+    try {
+        std::vector<Alignment> alignments = ReadAlignments(reader, lineOffset);
+        xmlFreeTextReader(reader);
+        return alignments;
+    } catch (...) {
+        xmlFreeTextReader(reader);
+        throw;
+    }
+}
+
+bool StartsWith(std::string_view text, std::size_t position, std::string_view prefix) {
+    return text.compare(position, prefix.size(), prefix) == 0;
+}
+
+bool IsNameEnd(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '/' || c == '>';
+}
+
+// Encodage déclaré dans <?xml ... encoding="..."?>, vide s'il est absent
+std::string DeclaredEncoding(std::string_view declaration) {
+    const std::size_t key = declaration.find("encoding");
+    if (key == std::string_view::npos) {
+        return {};
+    }
+    const std::size_t quote = declaration.find_first_of("\"'", key);
+    if (quote == std::string_view::npos) {
+        return {};
+    }
+    const std::size_t end = declaration.find(declaration[quote], quote + 1);
+    if (end == std::string_view::npos) {
+        return {};
+    }
+    return std::string(declaration.substr(quote + 1, end - quote - 1));
+}
+
+} // namespace
+
+std::vector<Alignment> LandXMLAlignmentLoader::Read(xmlTextReaderPtr reader) {
+    return ReadAlignments(reader, 0);
+}
+
+bool LandXMLAlignmentLoader::TryFindAlignmentRanges(std::string_view document, std::vector<AlignmentRange>& ranges, std::string& encoding) {
+    ranges.clear();
+    encoding.clear();
+
+    std::size_t position = 0;
+    if (StartsWith(document, 0, "\xEF\xBB\xBF")) {
+        position = 3;   // BOM UTF-8
+    }
+    // UTF-16/32 : les balises ne sont pas des suites d'octets ASCII
+    if (document.size() >= position + 2 && (document[position] == '\0' || document[position + 1] == '\0' ||
+                                            StartsWith(document, 0, "\xFE\xFF") || StartsWith(document, 0, "\xFF\xFE"))) {
+        return false;
+    }
+
+    std::size_t begin = 0;   // Début de l'axe en cours
+    bool inAlignment = false;
+    while (true) {
+        position = document.find('<', position);
+        if (position == std::string_view::npos) {
+            break;
+        }
+
+        std::string_view terminator;
+        if (StartsWith(document, position, "<!--")) {
+            terminator = "-->";
+        } else if (StartsWith(document, position, "<![CDATA[")) {
+            terminator = "]]>";
+        } else if (StartsWith(document, position, "<?")) {
+            terminator = "?>";
+        } else if (StartsWith(document, position, "<!")) {
+            return false;   // DOCTYPE : des entités pourraient être déclarées
+        }
+        if (!terminator.empty()) {
+            const std::size_t end = document.find(terminator, position);
+            if (end == std::string_view::npos) {
+                return false;
+            }
+            if (position == 0 || (position == 3 && StartsWith(document, 0, "\xEF\xBB\xBF"))) {
+                encoding = DeclaredEncoding(document.substr(position, end - position));
+            }
+            position = end + terminator.size();
+            continue;
+        }
+
+        // Balise ouvrante ou fermante : nom qualifié, puis fin de balise hors des valeurs d'attributs
+        const bool endTag = StartsWith(document, position, "</");
+        std::size_t nameEnd = position + (endTag ? 2 : 1);
+        while (nameEnd < document.size() && !IsNameEnd(document[nameEnd])) {
+            ++nameEnd;
+        }
+        const std::string_view name = document.substr(position + (endTag ? 2 : 1), nameEnd - position - (endTag ? 2 : 1));
+        std::size_t tagEnd = nameEnd;
+        char quote = '\0';
+        for (; tagEnd < document.size(); ++tagEnd) {
+            const char c = document[tagEnd];
+            if (quote != '\0') {
+                quote = c == quote ? '\0' : quote;
+            } else if (c == '"' || c == '\'') {
+                quote = c;
+            } else if (c == '>') {
+                break;
+            }
+        }
+        if (tagEnd == document.size()) {
+            return false;
+        }
+
+        const std::size_t colon = name.find(':');
+        const std::string_view localName = colon == std::string_view::npos ? name : name.substr(colon + 1);
+        if (localName == "Alignment") {
+            if (colon != std::string_view::npos) {
+                return false;   // Préfixe déclaré hors de la plage
+            }
+            if (endTag) {
+                if (!inAlignment) {
+                    return false;
+                }
+                ranges.push_back(AlignmentRange{begin, tagEnd + 1, 0});
+                inAlignment = false;
+            } else {
+                if (inAlignment) {
+                    return false;
+                }
+                if (document[tagEnd - 1] == '/') {
+                    ranges.push_back(AlignmentRange{position, tagEnd + 1, 0});
+                } else {
+                    begin = position;
+                    inAlignment = true;
+                }
+            }
+        }
+        position = tagEnd + 1;
+    }
+    if (inAlignment) {
+        return false;
+    }
+
+    // Numéros de ligne de début, pour les messages d'erreur
+    int line = 1;
+    std::size_t counted = 0;
+    for (AlignmentRange& range : ranges) {
+        line += static_cast<int>(std::count(document.begin() + counted, document.begin() + range.Begin, '\n'));
+        counted = range.Begin;
+        range.Line = line;
+    }
+    return true;
+}
+
+std::vector<Alignment> LandXMLAlignmentLoader::ReadMemory(std::string_view document, unsigned threadCount) {
+    threadCount = BatchUtils::ThreadCount(threadCount);
+    std::vector<AlignmentRange> ranges;
+    std::string encoding;
+    if (threadCount <= 1 || !TryFindAlignmentRanges(document, ranges, encoding) || ranges.size() <= 1) {
+        return ReadBuffer(document, nullptr, 0);
+    }
+
+    // Les plages sont distribuées dynamiquement : leurs tailles sont très inégales. L'erreur de la
+    // première plage en échec est relancée, comme lors d'une lecture séquentielle.
+    xmlInitParser();
+    const char* encodingName = encoding.empty() ? nullptr : encoding.c_str();
+    std::vector<std::vector<Alignment>> results(ranges.size());
+    BatchUtils::ParallelFor(ranges.size(), threadCount, [&](std::size_t i) {
+        const AlignmentRange& range = ranges[i];
+        results[i] = ReadBuffer(document.substr(range.Begin, range.End - range.Begin), encodingName, range.Line - 1);
+    });
+
+    std::vector<Alignment> alignments;
+    alignments.reserve(ranges.size());
+    for (std::vector<Alignment>& result : results) {
+        for (Alignment& alignment : result) {
+            alignments.push_back(std::move(alignment));
+        }
+    }
+    return alignments;
+}
+
+std::vector<Alignment> LandXMLAlignmentLoader::ReadFile(const std::string& fileName, unsigned threadCount) {
+    std::ifstream stream(fileName, std::ios::binary);
+    if (!stream) {
+        throw std::runtime_error("Cannot open LandXML file '" + fileName + "'");
+    }
+    std::ostringstream content;
+    content << stream.rdbuf();
+    return ReadMemory(content.view(), threadCount);
+}
+
+} // namespace LineaCore::LandXML
@@ -0,0 +1,179 @@
+// LandXMLStreamReader.cpp
+
+#include "LineaCore/LandXML/LandXMLStreamReader.hpp"
+#include "LineaCore/LandXML/XMLUtils.hpp"
+#include "LineaCore/Geometry/Alignments/Alignment.hpp"
+#include <cstring>
+#include <stdexcept>
+
+namespace LineaCore::LandXML {
+
+using Geometry::Alignments::Alignment;
+
+// StreamedElementQueue
+
+StreamedElementQueue::StreamedElementQueue(std::size_t capacity)
+    : _capacity(capacity), _closed(false), _cancelled(false) {
+    if (capacity == 0) {
+        throw std::runtime_error("Streamed element queue capacity must be positive");
+    }
+}
+
+bool StreamedElementQueue::Push(StreamedElement&& element) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _notFull.wait(lock, [this] { return _elements.size() < _capacity || _cancelled; });
+    if (_cancelled) {
+        return false;
+    }
+    _elements.push_back(std::move(element));
+    _notEmpty.notify_one();
+    return true;
+}
+
+bool StreamedElementQueue::Pop(StreamedElement& element) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _notEmpty.wait(lock, [this] { return !_elements.empty() || _closed; });
+    if (_elements.empty()) {
+        if (_error) {
+            std::rethrow_exception(_error);
+        }
+        return false;
+    }
+    element = std::move(_elements.front());
+    _elements.pop_front();
+    _notFull.notify_one();
+    return true;
+}
+
+void StreamedElementQueue::Close(std::exception_ptr error) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _closed = true;
+    _error = error;
+    _notEmpty.notify_all();
+}
+
+void StreamedElementQueue::Cancel() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _cancelled = true;
+    _elements.clear();
+    _notFull.notify_all();
+}
+
+// LandXMLStreamReader
+
+namespace {
+
+bool IsNamed(xmlTextReaderPtr reader, const char* name) {
+    const char* nodeName = reinterpret_cast<const char*>(xmlTextReaderConstLocalName(reader));
+    return nodeName != nullptr && std::strcmp(nodeName, name) == 0;
+}
+
+void ThrowParseError(xmlTextReaderPtr reader) {
+    throw std::runtime_error("LandXML parse error near line " + std::to_string(xmlTextReaderGetParserLineNumber(reader)));
+}
+
+} // namespace
+
+void LandXMLStreamReader::Read(xmlTextReaderPtr reader, const Callbacks& callbacks) {
+    if (!callbacks.Element) {
+        throw std::runtime_error("LandXML stream reader requires an element callback");
+    }
+
+    std::shared_ptr<StreamedAlignment> alignment;   // Axe en cours, nul hors d'un <Alignment>
+    std::size_t alignmentCount = 0;
+    std::size_t elementIndex = 0;
+    double station = 0.0;
+    int coordGeomDepth = -1;
+
+    auto endAlignment = [&]() {
+        if (callbacks.AlignmentEnd) {
+            callbacks.AlignmentEnd(*alignment);
+        }
+        alignment.reset();
+        coordGeomDepth = -1;
+    };
+
+    int status;
+    while ((status = xmlTextReaderRead(reader)) == 1) {
+        const int nodeType = xmlTextReaderNodeType(reader);
+        if (nodeType == XML_READER_TYPE_ELEMENT) {
+            const int depth = xmlTextReaderDepth(reader);
+            if (!alignment) {
+                if (IsNamed(reader, "Alignment")) {
+                    alignment = std::make_shared<StreamedAlignment>();
+                    alignment->Name = XMLUtils::ReadAttributeAsString(reader, "name");
+                    alignment->StaStart = XMLUtils::ReadAttributeAsDouble(reader, "staStart");
+                    alignment->DeclaredLength = XMLUtils::ReadOptionalAttributeAsDouble(reader, "length");
+                    alignment->Index = alignmentCount++;
+                    elementIndex = 0;
+                    station = alignment->StaStart;
+                    if (callbacks.AlignmentBegin) {
+                        callbacks.AlignmentBegin(*alignment);
+                    }
+                    if (xmlTextReaderIsEmptyElement(reader)) {
+                        endAlignment();
+                    }
+                }
+            } else if (IsNamed(reader, "CoordGeom")) {
+                coordGeomDepth = xmlTextReaderIsEmptyElement(reader) ? -1 : depth;
+            } else if (coordGeomDepth >= 0 && depth == coordGeomDepth + 1) {
+                // L'élément est lu jusqu'à sa balise fermante, puis transmis
+                auto element = Alignment::ReadElement(reader);
+                if (element) {
+                    const double elementStation = station;
+                    station += element->Length();
+                    callbacks.Element(StreamedElement{alignment, elementIndex++, elementStation, std::move(element)});
+                } else if (IsNamed(reader, "IrregularLine") || IsNamed(reader, "Chain")) {
+                    throw std::runtime_error("Unsupported element <" + std::string(reinterpret_cast<const char*>(xmlTextReaderConstLocalName(reader))) +
+                                             "> in <CoordGeom> of Alignment '" + alignment->Name + "'");
+                }
+            }
+        } else if (nodeType == XML_READER_TYPE_END_ELEMENT && alignment) {
+            if (IsNamed(reader, "CoordGeom")) {
+                coordGeomDepth = -1;
+            } else if (IsNamed(reader, "Alignment")) {
+                endAlignment();
+            }
+        }
+    }
+    if (status < 0) {
+        ThrowParseError(reader);
+    }
+}
+
+void LandXMLStreamReader::ReadFile(const std::string& fileName, const Callbacks& callbacks) {
+    xmlTextReaderPtr reader = xmlReaderForFile(fileName.c_str(), nullptr, 0);
+    if (reader == nullptr) {
+        throw std::runtime_error("Cannot open LandXML file '" + fileName + "'");
+    }
+    try {
+        Read(reader, callbacks);
+    } catch (...) {
+        xmlFreeTextReader(reader);
+        throw;
+    }
+    xmlFreeTextReader(reader);
+}
+
+std::thread LandXMLStreamReader::ReadFileAsync(const std::string& fileName, StreamedElementQueue& queue) {
+    return std::thread([fileName, &queue] {
+        // Exception interne servant à interrompre la lecture lorsque le consommateur abandonne
+        struct Cancelled {};
+        try {
+            Callbacks callbacks;
+            callbacks.Element = [&queue](StreamedElement&& element) {
+                if (!queue.Push(std::move(element))) {
+                    throw Cancelled{};
+                }
+            };
+            ReadFile(fileName, callbacks);
+            queue.Close();
+        } catch (const Cancelled&) {
+            queue.Close();
+        } catch (...) {
+            queue.Close(std::current_exception());
+        }
+    });
+}
+
+} // namespace LineaCore::LandXML
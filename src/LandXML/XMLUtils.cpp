@@ -1,37 +1,133 @@
 // XMLUtils.cpp
 #include "LineaCore/LandXML/XMLUtils.hpp"
 #include <libxml/xmlreader.h>
+#include <charconv>
 #include <stdexcept>
 #include <sstream>
-#include <iomanip>
-#include <limits>
 #include <cstring>
+#include <limits>
+#include <string>
+#include <string_view>
 
 namespace LineaCore::LandXML {
 
-double XMLUtils::ReadAttributeAsDouble(xmlTextReaderPtr reader, const char* attributeName) {
-    const char* attributeValue = reinterpret_cast<const char*>(xmlTextReaderGetAttribute(reader, BAD_CAST attributeName));
-    if (attributeValue == nullptr || std::strlen(attributeValue) == 0) {
+namespace {
+
+bool IsXmlSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+const char* SkipSpaces(const char* first, const char* last) {
+    while (first != last && IsXmlSpace(*first)) {
+        ++first;
+    }
+    return first;
+}
+
+const char* ElementName(xmlTextReaderPtr reader) {
+    const char* name = reinterpret_cast<const char*>(xmlTextReaderConstName(reader));
+    return name != nullptr ? name : "";
+}
+
+// Valeur d'un attribut de l'élément courant, sans copie (la chaîne appartient au lecteur).
+// Retourne nullptr si l'attribut est absent ; le lecteur reste positionné sur l'élément.
+const char* FindAttribute(xmlTextReaderPtr reader, const char* attributeName) {
+    if (xmlTextReaderMoveToAttribute(reader, BAD_CAST attributeName) != 1) {
+        return nullptr;
+    }
+    const char* value = reinterpret_cast<const char*>(xmlTextReaderConstValue(reader));
+    xmlTextReaderMoveToElement(reader);
+    return value;
+}
+
+[[noreturn]] void ThrowMissingAttribute(xmlTextReaderPtr reader, const char* attributeName) {
+    std::ostringstream oss;
+    oss << "Attribute '" << attributeName << "=\"\"' missing in Element <" << ElementName(reader) << ">";
+    throw std::runtime_error(oss.str());
+}
+
+// Texte d'un nombre hors des limites des doubles (std::from_chars : result_out_of_range) :
+// true si son ordre de grandeur décimal est positif (dépassement), false s'il est négatif (sous-dépassement)
+bool OverflowsToInfinity(const char* first, const char* last) {
+    if (first != last && *first == '-') {
+        ++first;
+    }
+    // Position du premier chiffre non nul par rapport à la virgule
+    long magnitude = 0;
+    bool found = false, fraction = false;
+    for (; first != last && *first != 'e' && *first != 'E'; ++first) {
+        if (*first == '.') {
+            fraction = true;
+        } else if (!found) {
+            if (fraction) {
+                --magnitude;
+            }
+            found = *first != '0';
+        } else if (!fraction) {
+            ++magnitude;
+        }
+    }
+    // Exposant explicite, saturé
+    long exponent = 0;
+    if (first != last) {
+        ++first;
+        const bool negative = first != last && *first == '-';
+        if (first != last && (*first == '-' || *first == '+')) {
+            ++first;
+        }
+        for (; first != last && exponent < 100000; ++first) {
+            exponent = exponent * 10 + (*first - '0');
+        }
+        if (negative) {
+            exponent = -exponent;
+        }
+    }
+    return magnitude + exponent >= 0;
+}
+
+// Contenu de l'élément courant, lu directement dans son premier nœud texte (xmlTextReaderConstValue),
+// sans copie ; la chaîne n'est valide que tant que le lecteur reste sur ce nœud.
+std::string_view ReadContent(xmlTextReaderPtr reader, const std::string& elementName) {
+    const char* content = nullptr;
+    if (!xmlTextReaderIsEmptyElement(reader)) {
+        const int depth = xmlTextReaderDepth(reader);
+        while (xmlTextReaderRead(reader) == 1 && xmlTextReaderDepth(reader) > depth) {
+            const int nodeType = xmlTextReaderNodeType(reader);
+            if (nodeType == XML_READER_TYPE_TEXT || nodeType == XML_READER_TYPE_CDATA) {
+                content = reinterpret_cast<const char*>(xmlTextReaderConstValue(reader));
+                break;
+            }
+        }
+    }
+
+    const std::string_view text = content != nullptr ? std::string_view(content) : std::string_view();
+    if (SkipSpaces(text.data(), text.data() + text.size()) == text.data() + text.size()) {
         std::ostringstream oss;
-        oss << "Attribute '" << attributeName << "=\"\"' missing in Element <" 
-            << reinterpret_cast<const char*>(xmlTextReaderConstName(reader)) << ">";
-        //std::cerr << oss.str() << std::endl; // Impression sur std::cerr
+        oss << "Missing content in Element <" << elementName << ">";
         throw std::runtime_error(oss.str());
     }
+    return text;
+}
+
+} // namespace
+
+double XMLUtils::ReadAttributeAsDouble(xmlTextReaderPtr reader, const char* attributeName) {
+    const char* attributeValue = FindAttribute(reader, attributeName);
+    if (attributeValue == nullptr || *attributeValue == '\0') {
+        ThrowMissingAttribute(reader, attributeName);
+    }
 
     try {
-        return ParseAsDouble(attributeValue, 
-                             reinterpret_cast<const char*>(xmlTextReaderConstName(reader)), 
-                             attributeName);
+        return ParseAsDouble(attributeValue, ElementName(reader), attributeName);
     } catch (const std::exception& ex) {
         std::ostringstream oss;
-        oss << "Error parsing attribute '" << attributeName << "' in Element <" 
-            << reinterpret_cast<const char*>(xmlTextReaderConstName(reader)) << ">: " << ex.what();
-        //std::cerr << oss.str() << std::endl; // Impression sur std::cerr
-        throw std::runtime_error(oss.str());    }
+        oss << "Error parsing attribute '" << attributeName << "' in Element <"
+            << ElementName(reader) << ">: " << ex.what();
+        throw std::runtime_error(oss.str());
+    }
 }
 
-/* 
+/*
 double XMLUtils::ReadAttributeAsNaNableDouble(const std::string& attributeValue) {
     if (attributeValue.empty()) {
         return std::numeric_limits<double>::quiet_NaN();
@@ -40,53 +136,98 @@ double XMLUtils::ReadAttributeAsNaNableDouble(const std::string& attributeValue)
 }
  */
 
+double XMLUtils::ReadOptionalAttributeAsDouble(xmlTextReaderPtr reader, const char* attributeName) {
+    const char* attributeValue = FindAttribute(reader, attributeName);
+    if (attributeValue == nullptr || *attributeValue == '\0') {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    return ReadAttributeAsDouble(reader, attributeName);
+}
+
 std::string XMLUtils::ReadAttributeAsString(xmlTextReaderPtr reader, const char* attributeName) {
-    const char* attributeValue = reinterpret_cast<const char*>(xmlTextReaderGetAttribute(reader, BAD_CAST attributeName));
-    if (attributeValue == nullptr || std::strlen(attributeValue) == 0)  {
-        std::ostringstream oss;
-        oss << "Attribute '" << attributeName << "=\"\"' missing in Element <" 
-            << reinterpret_cast<const char*>(xmlTextReaderConstName(reader)) << ">";
-        //std::cerr << oss.str() << std::endl; // Impression sur std::cerr
-        throw std::runtime_error(oss.str());    
+    const char* attributeValue = FindAttribute(reader, attributeName);
+    if (attributeValue == nullptr || *attributeValue == '\0') {
+        ThrowMissingAttribute(reader, attributeName);
     }
     return attributeValue;
 }
 
+std::string XMLUtils::ReadOptionalAttributeAsString(xmlTextReaderPtr reader, const char* attributeName, const std::string& defaultValue) {
+    const char* attributeValue = FindAttribute(reader, attributeName);
+    return attributeValue != nullptr ? std::string(attributeValue) : defaultValue;
+}
+
 Geometry::Point2D XMLUtils::ReadContentAsPoint2D(xmlTextReaderPtr reader, const std::string& elementName) {
-    
-    std::string contentValue = reinterpret_cast<const char*>(xmlTextReaderReadString(reader));
-    
-    if (contentValue.empty()) {
-        std::ostringstream oss;
-        oss << "Missing content in Element <" << elementName << ">";
-        //std::cerr << oss.str() << std::endl; // Impression sur std::cerr
-        throw std::runtime_error(oss.str());
-    }
+    const std::string_view content = ReadContent(reader, elementName);
+    const char* last = content.data() + content.size();
 
-    std::istringstream stream(contentValue);
+    // Northing puis Easting ; les valeurs suivantes éventuelles (altitude) sont ignorées
     double x = 0.0, y = 0.0;
-    if (!(stream >> y >> x)) {
+    const char* end = ParseNumber(content.data(), last, y);
+    if (end != nullptr && end != last && IsXmlSpace(*end)) {
+        end = ParseNumber(end, last, x);
+    } else {
+        end = nullptr;
+    }
+    if (end == nullptr || (end != last && !IsXmlSpace(*end))) {
         std::ostringstream oss;
         oss << "Content of two numerical values (Northing Easting) expected in Element <" << elementName << ">";
-        //std::cerr << oss.str() << std::endl; // Impression sur std::cerr
-        throw std::runtime_error(oss.str());    }
+        throw std::runtime_error(oss.str());
+    }
     return Geometry::Point2D(x, y);
 }
 
-double XMLUtils::ParseAsDouble(const std::string& strValue, const std::string& elementName, const std::string& attributeName) {
-    if (strValue == "INF") {
-        return std::numeric_limits<double>::infinity();
+void XMLUtils::ReadContentAsNumbers(xmlTextReaderPtr reader, const std::string& elementName, std::span<double> values) {
+    const std::string_view content = ReadContent(reader, elementName);
+    const char* last = content.data() + content.size();
+
+    // Exactement values.size() valeurs, séparées par des blancs
+    const char* end = content.data();
+    for (double& value : values) {
+        end = ParseNumber(end, last, value);
+        if (end == nullptr || (end != last && !IsXmlSpace(*end))) {
+            break;
+        }
     }
-    if (strValue == "-INF") {
-        return -std::numeric_limits<double>::infinity();
+    if (end == nullptr || (end != last && !IsXmlSpace(*end)) || SkipSpaces(end, last) != last) {
+        std::ostringstream oss;
+        oss << "Content of " << values.size() << " numerical values expected in Element <" << elementName << ">";
+        throw std::runtime_error(oss.str());
     }
+}
 
-    char* endPtr = nullptr;
-    double value = std::strtod(strValue.c_str(), &endPtr);
+const char* XMLUtils::ParseNumber(const char* first, const char* last, double& value) {
+    first = SkipSpaces(first, last);
+    if (first != last && *first == '+') {
+        ++first; // std::from_chars n'accepte pas le signe +
+        if (first != last && *first == '-') {
+            return nullptr;
+        }
+    }
 
-    if (*endPtr != '\0') {
+    // Indépendant de la locale, sans allocation ; "INF" et "-INF" (LandXML) sont reconnus sans distinction de casse
+    auto [end, error] = std::from_chars(first, last, value);
+    if (error != std::errc()) {
+        if (error != std::errc::result_out_of_range || end == first) {
+            return nullptr;
+        }
+        // Dépassement : ±infini ou zéro signé, comme strtod, selon l'ordre de grandeur du texte déjà lu
+        value = OverflowsToInfinity(first, end) ? std::numeric_limits<double>::infinity() : 0.0;
+        if (*first == '-') {
+            value = -value;
+        }
+    }
+    return end;
+}
+
+double XMLUtils::ParseAsDouble(std::string_view strValue, std::string_view elementName, std::string_view attributeName) {
+    double value = 0.0;
+    const char* last = strValue.data() + strValue.size();
+    const char* end = ParseNumber(strValue.data(), last, value);
+
+    if (end != last) {
         std::ostringstream oss;
-        oss << "Attribute '" << attributeName << "=" << strValue 
+        oss << "Attribute '" << attributeName << "=" << strValue
             << "' numerical value expected in Element <" << elementName << ">";
         //std::cerr << oss.str() << std::endl; // Impression sur std::cerr
         throw std::runtime_error(oss.str());
@@ -96,4 +237,3 @@ double XMLUtils::ParseAsDouble(const std::string& strValue, const std::string& e
 }
 
 } // namespace LineaCore::LandXML
-
@@ -0,0 +1,36 @@
+// JsonUtils.cpp
+
+#include "LineaCore/Utils/JsonUtils.hpp"
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+
+namespace LineaCore::Utils {
+
+std::string JsonUtils::String(const std::string& text) {
+    std::string escaped = "\"";
+    for (const char c : text) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+            escaped += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char buffer[8];
+            std::snprintf(buffer, sizeof(buffer), "\\u%04x", static_cast<unsigned>(c));
+            escaped += buffer;
+        } else {
+            escaped += c;
+        }
+    }
+    return escaped + "\"";
+}
+
+std::string JsonUtils::Number(double value, int precision) {
+    if (!std::isfinite(value)) {
+        return "null";
+    }
+    char buffer[32];
+    const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::general, precision);
+    return std::string(buffer, result.ptr);
+}
+
+} // namespace LineaCore::Utils
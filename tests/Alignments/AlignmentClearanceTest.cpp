@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+#include "LineaCore/Geometry/Alignments/AlignmentClearance.hpp"
+#include "LineaCore/Geometry/Alignments/Horizontal/ClotoideTransition.hpp"
+#include "LineaCore/Geometry/Alignments/Horizontal/CurvedAlignment.hpp"
+#include "LineaCore/Geometry/Alignments/Horizontal/StraightAlignment.hpp"
+#include "ExampleFiles.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace LineaCore::Geometry::Alignments;
+using namespace LineaCore::Geometry::Alignments::Horizontal;
+using namespace LineaCore::Geometry;
+using namespace LineaCore::Tests;
+
+namespace {
+
+// Minimum par échantillonnage dense du premier axe et projection exacte sur le second
+double BruteForceMinimum(const Alignment& a, const Alignment& b, double step) {
+    const AlignmentProjector projector(b);
+    double minimum = std::numeric_limits<double>::infinity();
+    const std::size_t count = static_cast<std::size_t>(std::ceil((a.StaEnd() - a.StaStart()) / step));
+    for (std::size_t k = 0; k <= count; ++k) {
+        const Point2D p = a.Point(std::min(a.StaEnd(), a.StaStart() + step * static_cast<double>(k)));
+        minimum = std::min(minimum, (p - b.Point(projector.Project(p).Station)).Length());
+    }
+    return minimum;
+}
+
+void ExpectConsistent(const Alignment& a, const Alignment& b, const ClearancePoint& minimum) {
+    EXPECT_LE((minimum.PointA - a.Point(minimum.StationA)).Length(), 1e-9);
+    EXPECT_LE((minimum.PointB - b.Point(minimum.StationB)).Length(), 1e-9);
+    EXPECT_NEAR((minimum.PointA - minimum.PointB).Length(), minimum.Distance, 1e-12);
+}
+
+} // namespace
+
+TEST(AlignmentClearanceTest, LinesAndArcsClosedForms) {
+    Alignment line("Line", 0.0);
+    line.AddElement(std::make_unique<StraightAlignment>(Point2D(-100.0, 0.0), Vector2D(1.0, 0.0), 200.0));
+    Alignment parallel("Parallel", 0.0);
+    parallel.AddElement(std::make_unique<StraightAlignment>(Point2D(-50.0, 4.0), Vector2D(1.0, 0.0), 300.0));
+    Alignment crossing("Crossing", 0.0);
+    crossing.AddElement(std::make_unique<StraightAlignment>(Point2D(10.0, -10.0), Vector2D(1.0, 1.0), 30.0));
+    // Demi-cercle inférieur de centre (0, 50) et de rayon 20, parcouru dans le sens antihoraire
+    Alignment arc("Arc", 0.0);
+    arc.AddElement(std::make_unique<CurvedAlignment>(Point2D(0.0, 50.0), 20.0, 1.0, M_PI, 20.0 * M_PI));
+    Alignment outerArc("OuterArc", 0.0);
+    outerArc.AddElement(std::make_unique<CurvedAlignment>(Point2D(100.0, 50.0), 30.0, 1.0, M_PI / 2.0, 30.0 * M_PI));
+
+    const AlignmentClearance lineClearance(line);
+    const AlignmentClearance parallelClearance(parallel);
+    const AlignmentClearance crossingClearance(crossing);
+    const AlignmentClearance arcClearance(arc);
+    const AlignmentClearance outerArcClearance(outerArc);
+
+    EXPECT_NEAR(lineClearance.Minimum(parallelClearance).Distance, 4.0, 1e-12);
+    EXPECT_NEAR(lineClearance.Minimum(crossingClearance).Distance, 0.0, 1e-12);
+
+    const ClearancePoint lineArc = lineClearance.Minimum(arcClearance);
+    EXPECT_NEAR(lineArc.Distance, 30.0, 1e-9);
+    EXPECT_NEAR(lineArc.PointA.X, 0.0, 1e-9);
+    EXPECT_NEAR(lineArc.PointB.Y, 30.0, 1e-9);
+    ExpectConsistent(line, arc, lineArc);
+    EXPECT_NEAR(arcClearance.Minimum(lineClearance).Distance, 30.0, 1e-9);
+
+    // Demi-cercle gauche de centre (100, 50) : 100 - 20 - 30 sur la ligne des centres, à la fin du premier arc
+    const ClearancePoint arcArc = arcClearance.Minimum(outerArcClearance);
+    EXPECT_NEAR(arcArc.Distance, 50.0, 1e-9);
+    EXPECT_NEAR(arcArc.PointA.X, 20.0, 1e-9);
+    ExpectConsistent(arc, outerArc, arcArc);
+}
+
+TEST(AlignmentClearanceTest, ClothoidsAgainstBruteForce) {
+    Alignment a("A", 0.0);
+    a.AddElement(std::make_unique<StraightAlignment>(Point2D(0.0, 0.0), Vector2D(1.0, 0.0), 100.0));
+    a.AddElement(std::make_unique<ClotoideTransition>(50.0, 0.0, 25.0, Vector2D(1.0, 0.0), Vector2D(100.0, 0.0)));
+    Alignment b("B", 0.0);
+    b.AddElement(std::make_unique<ClotoideTransition>(40.0, 5.0, 30.0, Vector2D(0.0, -1.0), Vector2D(130.0, 40.0)));
+
+    const AlignmentClearance clearanceA(a);
+    const AlignmentClearance clearanceB(b);
+    const ClearancePoint minimum = clearanceA.Minimum(clearanceB);
+    ExpectConsistent(a, b, minimum);
+    const double bruteForce = std::min(BruteForceMinimum(a, b, 0.01), BruteForceMinimum(b, a, 0.01));
+    EXPECT_LE(minimum.Distance, bruteForce + 1e-9);
+    EXPECT_GE(minimum.Distance, bruteForce - 1e-4);
+    EXPECT_NEAR(clearanceB.Minimum(clearanceA).Distance, minimum.Distance, 1e-9);
+}
+
+TEST(AlignmentClearanceTest, CentreAndRailProfiles) {
+    const Alignment centre = ReadFirstAlignment("TAE_Centre_01_01.xml");
+    const Alignment rail = ReadFirstAlignment("TAE_Centre_01_01_Rail.xml");
+    const AlignmentClearance centreClearance(centre);
+    const AlignmentClearance railClearance(rail);
+
+    const ClearanceProfile profile = centreClearance.Profile(railClearance, 1.0);
+    ExpectConsistent(centre, rail, profile.Minimum);
+    ASSERT_EQ(profile.Stations.size(), profile.Distances.size());
+    EXPECT_DOUBLE_EQ(profile.Stations.front(), centre.StaStart());
+    EXPECT_DOUBLE_EQ(profile.Stations.back(), centre.StaEnd());
+
+    const AlignmentProjector projector(rail);
+    for (std::size_t k = 0; k < profile.Stations.size(); k += 97) {
+        const Point2D p = centre.Point(profile.Stations[k]);
+        EXPECT_NEAR(profile.Distances[k], (p - rail.Point(projector.Project(p).Station)).Length(), 1e-9) << profile.Stations[k];
+    }
+    EXPECT_LE(profile.Minimum.Distance, *std::min_element(profile.Distances.begin(), profile.Distances.end()) + 1e-9);
+
+    // Répartition entre threads : mêmes résultats que le calcul séquentiel
+    const std::vector<std::pair<const AlignmentClearance*, const AlignmentClearance*>> pairs{
+        {&centreClearance, &railClearance}, {&railClearance, &centreClearance}, {&centreClearance, &centreClearance}};
+    const std::vector<ClearanceProfile> profiles = AlignmentClearance::Profiles(pairs, 5.0, 3);
+    ASSERT_EQ(profiles.size(), pairs.size());
+    for (std::size_t k = 0; k < pairs.size(); ++k) {
+        const ClearanceProfile expected = pairs[k].first->Profile(*pairs[k].second, 5.0);
+        EXPECT_EQ(profiles[k].Minimum.Distance, expected.Minimum.Distance);
+        EXPECT_EQ(profiles[k].Distances, expected.Distances);
+    }
+    EXPECT_EQ(profiles[2].Minimum.Distance, 0.0);
+
+    EXPECT_THROW(centreClearance.Profile(railClearance, 0.0), std::runtime_error);
+    EXPECT_THROW(AlignmentClearance{Alignment()}, std::runtime_error);
+}
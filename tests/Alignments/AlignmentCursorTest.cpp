@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+#include "LineaCore/Geometry/Alignments/AlignmentCursor.hpp"
+#include "LineaCore/Geometry/Alignments/Horizontal/CurvedAlignment.hpp"
+#include "LineaCore/Geometry/Alignments/Horizontal/ClotoideTransition.hpp"
+#include "LineaCore/LandXML/LandXMLAlignmentLoader.hpp"
+#include "ExampleFiles.hpp"
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace LineaCore::Geometry::Alignments;
+using namespace LineaCore::Geometry::Alignments::Horizontal;
+using namespace LineaCore::Geometry;
+using namespace LineaCore::Tests;
+
+namespace {
+
+void ExpectFollowsAlignment(const Alignment& alignment, double step, double tolerance) {
+    AlignmentCursor cursor(alignment, alignment.StaStart() - 3.0 * step, step);
+    for (std::size_t i = 0; cursor.Station() <= alignment.StaEnd() + 3.0 * step; ++i) {
+        const double s = cursor.Station();
+        EXPECT_DOUBLE_EQ(s, alignment.StaStart() - 3.0 * step + step * static_cast<double>(i));
+        const Point2D point = alignment.Point(s);
+        const Vector2D normal = alignment.Normal(s);
+        ASSERT_LE((cursor.Point() - point).Length(), tolerance) << s;
+        ASSERT_LE((cursor.Normal() - normal).Length(), tolerance) << s;
+        ASSERT_NEAR(cursor.Curvature(), alignment.Curvature(s), 1e-12) << s;
+        cursor.Next();
+    }
+}
+
+} // namespace
+
+TEST(AlignmentCursorTest, ArcsAndLines) {
+    Alignment alignment("Test", 100.0);
+    alignment.AddElement(std::make_unique<CurvedAlignment>(Point2D(0.0, 0.0), 250.0, 1.0, 0.3, 300.0));
+    alignment.AddElement(std::make_unique<CurvedAlignment>(Point2D(-500.0, 200.0), 120.0, -1.0, 2.0, 200.0));
+    for (const double step : {0.25, 1.0, 7.5}) {
+        ExpectFollowsAlignment(alignment, step, 1e-9);
+    }
+}
+
+TEST(AlignmentCursorTest, ExampleFiles) {
+    for (const char* fileName : {"TAE_Centre_01_01.xml", "v1.xml"}) {
+        const std::vector<Alignment> alignments = LineaCore::LandXML::LandXMLAlignmentLoader::ReadFile(ExamplesDir + "/" + fileName, 1);
+        for (const Alignment& alignment : alignments) {
+            for (const double step : {0.25, 2.0}) {
+                ExpectFollowsAlignment(alignment, step, 1e-7);
+            }
+        }
+    }
+}
+
+TEST(AlignmentCursorTest, SeekAndPoints) {
+    const std::vector<Alignment> alignments = LineaCore::LandXML::LandXMLAlignmentLoader::ReadFile(ExamplesDir + "/TAE_Centre_01_01.xml", 1);
+    const Alignment& alignment = alignments.front();
+    AlignmentCursor cursor(alignment, alignment.StaStart(), 0.5);
+
+    const double middle = (alignment.StaStart() + alignment.StaEnd()) / 2.0;
+    cursor.Seek(middle);
+    EXPECT_EQ(cursor.Station(), middle);
+    EXPECT_EQ(cursor.ElementIndex(), alignment.ElementIndex(middle));
+
+    std::vector<Point2D> points(500);
+    std::vector<Vector2D> normals(points.size());
+    cursor.Points(points, normals);
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        EXPECT_LE((points[i] - alignment.Point(middle + 0.5 * static_cast<double>(i))).Length(), 1e-8) << i;
+    }
+    EXPECT_DOUBLE_EQ(cursor.Station(), middle + 0.5 * static_cast<double>(points.size()));
+
+    std::vector<Vector2D> tooShort(1);
+    EXPECT_THROW(cursor.Points(points, tooShort), std::runtime_error);
+    EXPECT_THROW(AlignmentCursor(alignment, 0.0, 0.0), std::runtime_error);
+    EXPECT_THROW(AlignmentCursor(Alignment(), 0.0, 1.0), std::runtime_error);
+}
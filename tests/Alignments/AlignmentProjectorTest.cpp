@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+#include "LineaCore/Geometry/Alignments/AlignmentProjector.hpp"
+#include "LineaCore/Geometry/Alignments/Horizontal/StraightAlignment.hpp"
+#include "LineaCore/Geometry/Alignments/Horizontal/CurvedAlignment.hpp"
+#include "LineaCore/Geometry/Alignments/Horizontal/ClotoideTransition.hpp"
+#include "ExampleFiles.hpp"
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace LineaCore::Geometry::Alignments;
+using namespace LineaCore::Geometry::Alignments::Horizontal;
+using namespace LineaCore::Geometry;
+using namespace LineaCore::Tests;
+
+TEST(AlignmentProjectorTest, ElementProjection) {
+    StraightAlignment line(Point2D(0.0, 0.0), Vector2D(100.0, 0.0));
+    EXPECT_DOUBLE_EQ(line.Projection(Point2D(30.0, 5.0), 0.0), 30.0);
+    EXPECT_DOUBLE_EQ(line.Projection(Point2D(-10.0, 5.0), 0.0), 0.0);
+    EXPECT_DOUBLE_EQ(line.Projection(Point2D(150.0, 5.0), 0.0), 100.0);
+
+    CurvedAlignment curve(Point2D(0.0, 0.0), 100.0, 0.0, 100.0);
+    EXPECT_NEAR(curve.Projection(Point2D(0.0, 50.0), 0.0), 100.0, 1e-12);        // Au-delà de la fin
+    EXPECT_NEAR(curve.Projection(Point2D(150.0, -1.0), 0.0), 0.0, 1e-12);        // Avant le début
+    EXPECT_NEAR(curve.Projection(Point2D(std::cos(0.5) * 120.0, std::sin(0.5) * 120.0), 0.0), 50.0, 1e-9);
+
+    ClotoideTransition clotoide(200.0, 0.0, 120.0, Vector2D(1.0, 0.0), Vector2D(0.0, 0.0));
+    for (double s : {0.0, 10.0, 60.0, 119.0, 120.0}) {
+        for (double offset : {-15.0, 0.0, 8.0}) {
+            Point2D p = clotoide.Point(s) + clotoide.Normal(s) * offset;
+            EXPECT_NEAR(clotoide.Projection(p, std::min(120.0, s + 5.0)), s, 1e-8) << "s = " << s << ", offset = " << offset;
+        }
+    }
+}
+
+TEST(AlignmentProjectorTest, RoundTripOnExampleAlignment) {
+    Alignment alignment = ReadFirstAlignment("TAE_Centre_01_01.xml");
+    AlignmentProjector projector(alignment);
+
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<double> stations(alignment.StaStart(), alignment.StaEnd());
+    std::uniform_real_distribution<double> offsets(-20.0, 20.0);
+
+    std::vector<double> expectedStations, expectedOffsets;
+    std::vector<Point2D> points;
+    for (int i = 0; i < 20000; ++i) {
+        double station = stations(generator);
+        double offset = offsets(generator);
+        expectedStations.push_back(station);
+        expectedOffsets.push_back(offset);
+        // Normale ramenée à droite du sens de parcours (les normales des arcs horaires sont à gauche)
+        const double side = alignment.Element(alignment.ElementIndex(station)).NormalSide();
+        points.push_back(alignment.Point(station) + alignment.Normal(station) * (offset * side));
+    }
+
+    std::vector<StationOffset> results(points.size());
+    projector.Project(points, results, 4);
+
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        // Les jonctions ne sont continues qu'au millimètre : le déport fait foi, la station à 1 mm près
+        EXPECT_NEAR(results[i].Station, expectedStations[i], 1e-3) << "Point " << i;
+        EXPECT_NEAR(results[i].Offset, expectedOffsets[i], 1e-3) << "Point " << i;
+        StationOffset single = projector.Project(points[i]);
+        EXPECT_EQ(single.Station, results[i].Station);
+        EXPECT_EQ(single.Offset, results[i].Offset);
+    }
+}
+
+TEST(AlignmentProjectorTest, PointsFarFromAlignment) {
+    Alignment alignment("Test", 0.0);
+    alignment.AddElement(std::make_unique<StraightAlignment>(Point2D(0.0, 0.0), Vector2D(100.0, 0.0)));
+    alignment.AddElement(std::make_unique<CurvedAlignment>(Point2D(100.0, 100.0), 100.0, -std::acos(-1.0) / 2.0, 50.0));
+    AlignmentProjector projector(alignment);
+
+    StationOffset result = projector.Project(Point2D(-1000.0, 0.0));
+    EXPECT_DOUBLE_EQ(result.Station, 0.0);
+    EXPECT_EQ(result.ElementIndex, 0u);
+
+    result = projector.Project(Point2D(50.0, -500.0));
+    EXPECT_DOUBLE_EQ(result.Station, 50.0);
+    EXPECT_DOUBLE_EQ(result.Offset, 500.0);
+}
+
+TEST(AlignmentProjectorTest, OffsetSignOnClockwiseArc) {
+    // Droite vers +X suivie d'un arc horaire de rayon 100 (centre à droite de l'axe)
+    Alignment alignment("Test", 0.0);
+    alignment.AddElement(std::make_unique<StraightAlignment>(Point2D(0.0, 0.0), Vector2D(100.0, 0.0)));
+    alignment.AddElement(std::make_unique<CurvedAlignment>(Point2D(100.0, -100.0), -100.0, std::acos(-1.0) / 2.0, 80.0));
+    ASSERT_LT(alignment.Element(1).NormalSide(), 0.0);
+    AlignmentProjector projector(alignment);
+
+    for (double station : {50.0, 120.0, 150.0}) {
+        for (double offset : {-5.0, 5.0}) {
+            // Normale à droite construite depuis la tangente, indépendamment de la convention des éléments
+            const Point2D ahead = alignment.Point(station + 1e-4);
+            const Point2D behind = alignment.Point(station - 1e-4);
+            Vector2D tangent = ahead - behind;
+            tangent = tangent * (1.0 / tangent.Length());
+            const Vector2D right(tangent.Y, -tangent.X);
+
+            StationOffset result = projector.Project(alignment.Point(station) + right * offset);
+            EXPECT_NEAR(result.Station, station, 1e-6) << "Station " << station;
+            EXPECT_NEAR(result.Offset, offset, 1e-6) << "Station " << station << ", offset " << offset;
+        }
+    }
+}
+
+TEST(AlignmentProjectorTest, SizeMismatch) {
+    Alignment alignment("Test", 0.0);
+    alignment.AddElement(std::make_unique<StraightAlignment>(Point2D(0.0, 0.0), Vector2D(100.0, 0.0)));
+    AlignmentProjector projector(alignment);
+    std::vector<Point2D> points(3);
+    std::vector<StationOffset> results(2);
+    EXPECT_THROW(projector.Project(points, results), std::runtime_error);
+}
@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+#include "LineaCore/Geometry/Alignments/AlignmentSampler.hpp"
+#include "ExampleFiles.hpp"
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace LineaCore::Geometry::Alignments;
+using namespace LineaCore::Geometry;
+using namespace LineaCore::Tests;
+
+namespace {
+
+void ExpectMatchesScalar(const Alignment& alignment, const AlignmentSamples& samples) {
+    const Vertical::VerticalAlignment* profile = alignment.ProfileCount() > 0 ? &alignment.Profile(0) : nullptr;
+    const CantTable* cant = alignment.CantCount() > 0 ? &alignment.Cant(0) : nullptr;
+    for (std::size_t i = 0; i < samples.Size(); ++i) {
+        const double s = samples.Station[i];
+        const Point2D point = alignment.Point(s);
+        const double side = alignment.Element(alignment.ElementIndex(s)).NormalSide();
+        const Vector2D tangent = alignment.Normal(s).Rotated90CounterClockWise() * side;
+        EXPECT_NEAR(samples.X[i], point.X, 1e-6) << s;
+        EXPECT_NEAR(samples.Y[i], point.Y, 1e-6) << s;
+        EXPECT_NEAR(std::remainder(samples.Heading[i] - tangent.AngleMinusPiPi(), 2.0 * M_PI), 0.0, 1e-9) << s;
+        EXPECT_NEAR(samples.Curvature[i], alignment.Curvature(s), 1e-12) << s;
+        EXPECT_DOUBLE_EQ(samples.Z[i], profile != nullptr ? profile->Elevation(s) : 0.0) << s;
+        EXPECT_DOUBLE_EQ(samples.Grade[i], profile != nullptr ? profile->Grade(s) : 0.0) << s;
+        EXPECT_DOUBLE_EQ(samples.Cant[i], cant != nullptr ? cant->AppliedCant(s) : 0.0) << s;
+    }
+}
+
+} // namespace
+
+TEST(AlignmentSamplerTest, FixedStep) {
+    const Alignment alignment = ReadFirstAlignment("v1.xml");
+    ASSERT_EQ(alignment.ProfileCount(), 1u);
+    ASSERT_EQ(alignment.CantCount(), 1u);
+
+    const AlignmentSamples samples = AlignmentSampler(alignment).Sample(0.7, 1);
+    ASSERT_GT(samples.Size(), 2u);
+    EXPECT_DOUBLE_EQ(samples.Station.front(), alignment.StaStart());
+    EXPECT_DOUBLE_EQ(samples.Station.back(), alignment.StaEnd());
+    EXPECT_LE(samples.Station.back() - samples.Station[samples.Size() - 2], 0.7);
+    ExpectMatchesScalar(alignment, samples);
+
+    EXPECT_THROW(AlignmentSampler(alignment).Sample(0.0), std::runtime_error);
+}
+
+TEST(AlignmentSamplerTest, HeadingFollowsTravelDirection) {
+    // Gisement comparé à la différence finie des points, y compris sur les arcs parcourus en sens horaire
+    const Alignment alignment = ReadFirstAlignment("v1.xml");
+    bool clockwiseArc = false;
+    for (std::size_t i = 0; i < alignment.ElementCount(); ++i) {
+        clockwiseArc = clockwiseArc || alignment.Element(i).NormalSide() < 0.0;
+    }
+    ASSERT_TRUE(clockwiseArc);
+
+    const AlignmentSamples samples = AlignmentSampler(alignment).Sample(5.0, 1);
+    constexpr double h = 1e-3;
+    for (std::size_t i = 1; i + 1 < samples.Size(); ++i) {
+        const double s = samples.Station[i];
+        const Vector2D chord = alignment.Point(s + h) - alignment.Point(s - h);
+        EXPECT_NEAR(std::remainder(samples.Heading[i] - std::atan2(chord.Y, chord.X), 2.0 * M_PI), 0.0, 1e-6) << s;
+    }
+}
+
+TEST(AlignmentSamplerTest, UnsortedStationsAndApproximants) {
+    Alignment alignment = ReadFirstAlignment("TAE_Centre_01_01.xml");
+    ASSERT_TRUE(alignment.TryEnableApproximants(1e-7));
+
+    std::mt19937 generator(5);
+    std::uniform_real_distribution<double> distribution(alignment.StaStart() - 10.0, alignment.StaEnd() + 10.0);
+    std::vector<double> stations(3000);
+    for (double& s : stations) {
+        s = distribution(generator);
+    }
+    const AlignmentSamples samples = AlignmentSampler(alignment).Sample(stations, 1);
+    ExpectMatchesScalar(alignment, samples);
+}
+
+TEST(AlignmentSamplerTest, IndependentOfThreadCount) {
+    const Alignment alignment = ReadFirstAlignment("v1.xml");
+    const AlignmentSampler sampler(alignment);
+    const AlignmentSamples reference = sampler.Sample(0.1, 1);
+    ASSERT_GT(reference.Size(), 4u * 4096u);
+    const AlignmentSamples parallel = sampler.Sample(0.1, 4);
+    EXPECT_EQ(parallel.X, reference.X);
+    EXPECT_EQ(parallel.Y, reference.Y);
+    EXPECT_EQ(parallel.Z, reference.Z);
+    EXPECT_EQ(parallel.Heading, reference.Heading);
+    EXPECT_EQ(parallel.Cant, reference.Cant);
+}
+
+TEST(AlignmentSamplerTest, WithoutProfileOrCant) {
+    const Alignment alignment = ReadFirstAlignment("v1.xml");
+    const AlignmentSamples samples = AlignmentSampler(alignment, nullptr, nullptr).Sample(50.0, 1);
+    for (std::size_t i = 0; i < samples.Size(); ++i) {
+        EXPECT_EQ(samples.Z[i], 0.0);
+        EXPECT_EQ(samples.Grade[i], 0.0);
+        EXPECT_EQ(samples.Cant[i], 0.0);
+    }
+    EXPECT_THROW(AlignmentSampler(Alignment()).Sample(1.0), std::runtime_error);
+}
+
+TEST(AlignmentSamplerTest, ExternalChainageAcrossStationEquation) {
+    const Alignment alignment = ReadFirstAlignment("v1.xml");
+    ASSERT_EQ(alignment.StationEquations().EquationCount(), 1u);
+    const StationEquation& equation = alignment.StationEquations().Equations()[0];
+    ASSERT_GT(equation.StaAhead, equation.StaInternal);
+
+    // Chaînage externe de part et d'autre du saut de l'équation
+    std::vector<double> external;
+    for (double station = alignment.StaStart(); station < equation.StaInternal; station += 1.3) {
+        external.push_back(station);
+    }
+    for (double station = equation.StaAhead; station <= alignment.ExternalStation(alignment.StaEnd()); station += 1.3) {
+        external.push_back(station);
+    }
+    std::vector<double> internal(external.size());
+    alignment.StationEquations().InternalStations(external, internal);
+
+    AlignmentSampler sampler(alignment);
+    EXPECT_EQ(sampler.InputStationType(), StationType::Internal);
+    const AlignmentSamples reference = sampler.Sample(internal, 1);
+    sampler.SetInputStationType(StationType::External);
+    const AlignmentSamples samples = sampler.Sample(external, 1);
+    EXPECT_EQ(samples.Station, external);
+    EXPECT_EQ(samples.X, reference.X);
+    EXPECT_EQ(samples.Y, reference.Y);
+    EXPECT_EQ(samples.Z, reference.Z);
+    EXPECT_EQ(samples.Heading, reference.Heading);
+    EXPECT_EQ(samples.Cant, reference.Cant);
+    EXPECT_EQ(sampler.Sample(external, 4).X, reference.X);
+
+    // Pas constant en stations internes, stations restituées en chaînage externe
+    const AlignmentSamples fixedStep = sampler.Sample(0.7, 1);
+    const std::vector<double> steps = alignment.FixedStepStations(0.7);
+    ASSERT_EQ(fixedStep.Size(), steps.size());
+    for (std::size_t i = 0; i < steps.size(); ++i) {
+        EXPECT_DOUBLE_EQ(fixedStep.Station[i], alignment.ExternalStation(steps[i]));
+    }
+    EXPECT_EQ(fixedStep.X, AlignmentSampler(alignment).Sample(0.7, 1).X);
+
+    // Station externe dans le saut de l'équation
+    const std::vector<double> missing{0.5 * (equation.StaInternal + equation.StaAhead)};
+    EXPECT_THROW(sampler.Sample(missing, 1), std::runtime_error);
+}
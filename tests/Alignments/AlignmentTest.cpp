@@ -0,0 +1,265 @@
+#include <gtest/gtest.h>
+#include "LineaCore/Geometry/Alignments/Alignment.hpp"
+#include "LineaCore/Geometry/Alignments/Horizontal/StraightAlignment.hpp"
+#include "LineaCore/Geometry/Alignments/Horizontal/CurvedAlignment.hpp"
+#include "LineaCore/Geometry/Alignments/Horizontal/ClotoideTransition.hpp"
+#include "ExampleFiles.hpp"
+#include <limits>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace LineaCore::Geometry::Alignments;
+using namespace LineaCore::Geometry::Alignments::Horizontal;
+using namespace LineaCore::Geometry;
+using namespace LineaCore::Tests;
+
+namespace {
+
+// Recherche linéaire de référence
+std::size_t LinearElementIndex(const Alignment& alignment, double station) {
+    std::size_t index = 0;
+    while (index + 1 < alignment.ElementCount() && alignment.ElementStation(index + 1) <= station) {
+        ++index;
+    }
+    return index;
+}
+
+} // namespace
+
+TEST(AlignmentTest, StationsAndLookup) {
+    Alignment alignment("Test", 1000.0);
+    alignment.AddElement(std::make_unique<StraightAlignment>(Point2D(0.0, 0.0), Vector2D(100.0, 0.0)));
+    alignment.AddElement(std::make_unique<CurvedAlignment>(Point2D(100.0, 50.0), 50.0, -std::acos(-1.0) / 2.0, 25.0));
+    alignment.AddElement(std::make_unique<StraightAlignment>(Point2D(0.0, 0.0), Vector2D(0.0, 1.0), 0.5));
+
+    EXPECT_EQ(alignment.ElementCount(), 3u);
+    EXPECT_DOUBLE_EQ(alignment.StaStart(), 1000.0);
+    EXPECT_DOUBLE_EQ(alignment.StaEnd(), 1125.5);
+    EXPECT_DOUBLE_EQ(alignment.Length(), 125.5);
+
+    EXPECT_EQ(alignment.ElementIndex(999.0), 0u);
+    EXPECT_EQ(alignment.ElementIndex(1000.0), 0u);
+    EXPECT_EQ(alignment.ElementIndex(1099.999), 0u);
+    EXPECT_EQ(alignment.ElementIndex(1100.0), 1u);
+    EXPECT_EQ(alignment.ElementIndex(1125.2), 2u);
+    EXPECT_EQ(alignment.ElementIndex(1200.0), 2u);
+
+    Point2D junction = alignment.Point(1100.0);
+    EXPECT_NEAR(junction.X, 100.0, 1e-12);
+    EXPECT_NEAR(junction.Y, 0.0, 1e-12);
+    EXPECT_DOUBLE_EQ(alignment.Curvature(1050.0), 0.0);
+    EXPECT_DOUBLE_EQ(alignment.Curvature(1110.0), 1.0 / 50.0);
+}
+
+TEST(AlignmentTest, EmptyAlignmentThrows) {
+    Alignment alignment("Empty", 0.0);
+    EXPECT_THROW(alignment.Point(0.0), std::runtime_error);
+    EXPECT_THROW(alignment.AddElement(nullptr), std::runtime_error);
+}
+
+TEST(AlignmentTest, ReadLandXML) {
+    Alignment alignment = ReadFirstAlignment("TAE_Centre_01_01.xml");
+
+    EXPECT_EQ(alignment.Name(), "TAE_Centre_01_01_Xml");
+    EXPECT_EQ(alignment.ElementCount(), 131u);
+    EXPECT_DOUBLE_EQ(alignment.StaStart(), -356.673869696886);
+    EXPECT_NEAR(alignment.Length(), 17208.956844189459, 1e-3);
+
+    // Continuité de position aux jonctions
+    for (std::size_t i = 0; i + 1 < alignment.ElementCount(); ++i) {
+        Vector2D gap = alignment.Element(i).getEndingPoint() - alignment.Element(i + 1).getStartingPoint();
+        EXPECT_LT(gap.Length(), 1e-3) << "Junction " << i;
+    }
+}
+
+TEST(AlignmentTest, BucketLookupMatchesLinearScan) {
+    Alignment alignment = ReadFirstAlignment("TAE_Centre_01_01.xml");
+
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> distribution(alignment.StaStart() - 10.0, alignment.StaEnd() + 10.0);
+    for (int i = 0; i < 100000; ++i) {
+        double station = distribution(generator);
+        ASSERT_EQ(alignment.ElementIndex(station), LinearElementIndex(alignment, station)) << "Station " << station;
+    }
+    for (std::size_t i = 0; i < alignment.ElementCount(); ++i) {
+        EXPECT_EQ(alignment.ElementIndex(alignment.ElementStation(i)), LinearElementIndex(alignment, alignment.ElementStation(i)));
+    }
+}
+
+TEST(AlignmentTest, LookupWhileAddingElements) {
+    // Seaux prolongés à chaque ajout, reconstruits après doublement ou après un élément très long
+    Alignment alignment("Incremental", 50.0);
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<double> lengths(0.5, 40.0);
+    Point2D end(0.0, 0.0);
+    for (int k = 0; k < 200; ++k) {
+        const double length = k % 17 == 3 ? 0.0 : (k % 29 == 5 ? 4000.0 : lengths(generator));
+        alignment.AddElement(std::make_unique<StraightAlignment>(end, Vector2D(1.0, 0.0), length));
+        end = alignment.Element(alignment.ElementCount() - 1).getEndingPoint();
+
+        std::uniform_real_distribution<double> stations(alignment.StaStart() - 5.0, alignment.StaEnd() + 5.0);
+        for (int i = 0; i < 50; ++i) {
+            const double station = stations(generator);
+            ASSERT_EQ(alignment.ElementIndex(station), LinearElementIndex(alignment, station)) << k << " " << station;
+        }
+        for (std::size_t i = 0; i < alignment.ElementCount(); ++i) {
+            ASSERT_EQ(alignment.ElementIndex(alignment.ElementStation(i)), LinearElementIndex(alignment, alignment.ElementStation(i))) << k;
+        }
+    }
+}
+
+TEST(AlignmentTest, TessellationIntoSingleBuffer) {
+    Alignment alignment = ReadFirstAlignment("TAE_Centre_01_01.xml");
+
+    const double maxThrow = 0.001;
+    const std::size_t count = alignment.PointCount(maxThrow);
+    std::vector<Point2D> sequential = alignment.Points(maxThrow, 1);
+    ASSERT_EQ(sequential.size(), count);
+
+    // Concaténation des discrétisations des éléments, sommets de jonction fusionnés
+    std::vector<Point2D> expected;
+    for (std::size_t i = 0; i < alignment.ElementCount(); ++i) {
+        std::vector<Point2D> points = alignment.Element(i).Points(maxThrow);
+        if (!expected.empty()) {
+            EXPECT_LT((expected.back() - points.front()).Length(), 1e-3) << "element " << i;
+            expected.pop_back();
+        }
+        expected.insert(expected.end(), points.begin(), points.end());
+    }
+    ASSERT_EQ(expected.size(), count);
+    for (std::size_t i = 0; i < count; ++i) {
+        EXPECT_EQ(sequential[i], expected[i]) << i;
+    }
+
+    for (unsigned threadCount : {2u, 3u, 8u}) {
+        std::vector<Point2D> parallel(count);
+        alignment.Points(maxThrow, parallel, threadCount);
+        EXPECT_EQ(parallel, sequential) << threadCount << " threads";
+    }
+
+    std::vector<Point2D> wrongSize(count + 1);
+    EXPECT_THROW(alignment.Points(maxThrow, wrongSize), std::runtime_error);
+    EXPECT_EQ(Alignment("Empty", 0.0).PointCount(maxThrow), 0u);
+
+    // Flèche non positive ou non finie
+    for (double invalid : {0.0, -1.0, std::numeric_limits<double>::infinity(), std::numeric_limits<double>::quiet_NaN()}) {
+        EXPECT_THROW(alignment.PointCount(invalid), std::runtime_error);
+        EXPECT_THROW(alignment.Points(invalid, sequential), std::runtime_error);
+        EXPECT_THROW(Alignment("Empty", 0.0).PointCount(invalid), std::runtime_error);
+    }
+}
+
+TEST(AlignmentTest, ExternalStationQueries) {
+    const Alignment alignment = ReadFirstAlignment("v1.xml");
+    ASSERT_EQ(alignment.StationEquations().EquationCount(), 1u);
+    const StationEquation& equation = alignment.StationEquations().Equations()[0];
+    for (const double internal : {alignment.StaStart() + 10.0, equation.StaInternal - 1.0, equation.StaInternal, equation.StaInternal + 250.0}) {
+        const double external = alignment.ExternalStation(internal);
+        EXPECT_EQ(alignment.Point(external, StationType::External), alignment.Point(internal));
+        EXPECT_EQ(alignment.Normal(external, StationType::External), alignment.Normal(internal));
+        EXPECT_EQ(alignment.Curvature(external, StationType::External), alignment.Curvature(internal));
+        EXPECT_EQ(alignment.Point(internal, StationType::Internal), alignment.Point(internal));
+    }
+    EXPECT_THROW(alignment.Point(0.5 * (equation.StaInternal + equation.StaAhead), StationType::External), std::runtime_error);
+}
+
+TEST(AlignmentTest, FixedStepStations) {
+    Alignment alignment("Test", 100.0);
+    alignment.AddElement(std::make_unique<StraightAlignment>(Point2D(0.0, 0.0), Vector2D(25.0, 0.0)));
+    EXPECT_EQ(alignment.FixedStepStations(10.0), (std::vector<double>{100.0, 110.0, 120.0, 125.0}));
+    // Pas divisant la longueur à l'arrondi près : pas de dernier intervalle quasi nul
+    EXPECT_EQ(alignment.FixedStepStations(2.5).size(), 11u);
+    EXPECT_EQ(alignment.FixedStepStations(2.5).back(), 125.0);
+    EXPECT_EQ(alignment.FixedStepStations(1000.0), (std::vector<double>{100.0, 125.0}));
+    for (const double invalid : {0.0, -1.0, std::numeric_limits<double>::quiet_NaN()}) {
+        EXPECT_THROW(alignment.FixedStepStations(invalid), std::runtime_error);
+    }
+}
+
+TEST(AlignmentTest, ClotoideApproximants) {
+    Alignment alignment = ReadFirstAlignment("TAE_Centre_01_01.xml");
+    EXPECT_FALSE(alignment.ApproximantsEnabled());
+
+    std::vector<double> stations;
+    std::vector<Point2D> exactPoints;
+    std::vector<Vector2D> exactNormals;
+    for (double station = alignment.StaStart(); station <= alignment.StaEnd(); station += 3.7) {
+        stations.push_back(station);
+        exactPoints.push_back(alignment.Point(station));
+        exactNormals.push_back(alignment.Normal(station));
+    }
+
+    const double tolerance = 1e-7;
+    ASSERT_TRUE(alignment.TryEnableApproximants(tolerance));
+    EXPECT_TRUE(alignment.ApproximantsEnabled());
+    bool approximated = false;
+    for (std::size_t i = 0; i < stations.size(); ++i) {
+        EXPECT_LE((alignment.Point(stations[i]) - exactPoints[i]).Length(), tolerance);
+        EXPECT_LE((alignment.Normal(stations[i]) - exactNormals[i]).Length(), tolerance);
+        approximated = approximated || !(alignment.Point(stations[i]) == exactPoints[i]);
+    }
+    EXPECT_TRUE(approximated);
+
+    // Tolérance inatteignable : l'état de l'axe est inchangé
+    EXPECT_FALSE(alignment.TryEnableApproximants(1e-16));
+    EXPECT_TRUE(alignment.ApproximantsEnabled());
+
+    alignment.DisableApproximants();
+    EXPECT_FALSE(alignment.ApproximantsEnabled());
+    for (std::size_t i = 0; i < stations.size(); ++i) {
+        EXPECT_EQ(alignment.Point(stations[i]), exactPoints[i]);
+    }
+}
+
+TEST(AlignmentTest, ElementPointsFollowApproximants) {
+    Alignment alignment = ReadFirstAlignment("TAE_Centre_01_01.xml");
+    for (const bool approximated : {false, true}) {
+        if (approximated) {
+            ASSERT_TRUE(alignment.TryEnableApproximants(1e-7));
+        }
+        for (std::size_t i = 0; i < alignment.ElementCount(); ++i) {
+            const double length = alignment.Element(i).Length();
+            // Abscisses intérieures : à la jonction, Point et Normal retiennent l'élément suivant
+            const std::vector<double> s = {0.0, 0.3 * length, 0.7 * length};
+            std::vector<Point2D> points(s.size()), pointsOnly(s.size());
+            std::vector<Vector2D> normals(s.size());
+            alignment.ElementPoints(i, s, points, normals);
+            alignment.ElementPoints(i, s, pointsOnly);
+            for (std::size_t k = 0; k < s.size(); ++k) {
+                // Même évaluation que Point et Normal, qui utilisent l'approximation active
+                const double station = alignment.ElementStation(i) + s[k];
+                if (length > 0.0) {
+                    EXPECT_LE((points[k] - alignment.Point(station)).Length(), 1e-8) << "Element " << i;
+                    EXPECT_LE((normals[k] - alignment.Normal(station)).Length(), 1e-8) << "Element " << i;
+                }
+                EXPECT_EQ(pointsOnly[k], points[k]);
+            }
+        }
+    }
+    std::vector<Point2D> points(1);
+    EXPECT_THROW(alignment.ElementPoints(alignment.ElementCount(), std::vector<double>{0.0}, points), std::out_of_range);
+}
+
+TEST(AlignmentTest, ClotoideApproximantsSkipZeroLengthClotoide) {
+    // Clotoïde de longueur nulle devant une vraie clotoïde, comme dans certains exports LandXML
+    const Vector2D direction = Vector2D(-0.5654, -0.8248).Normalized();
+    const Vector2D origin(1319630.077000, 6248132.874953);
+    Alignment alignment("Test", 0.0);
+    alignment.AddElement(std::make_unique<ClotoideTransition>(373.9820021, 0.0, 0.0, direction, origin));
+    alignment.AddElement(std::make_unique<ClotoideTransition>(373.9820021, 0.0, 111.7202365, direction, origin));
+
+    const double tolerance = 1e-7;
+    ASSERT_TRUE(alignment.TryEnableApproximants(tolerance));
+    EXPECT_EQ(alignment.Approximant(0), nullptr);
+    ASSERT_NE(alignment.Approximant(1), nullptr);
+    const ClotoideTransition exact(373.9820021, 0.0, 111.7202365, direction, origin);
+    for (double station = 0.0; station <= alignment.StaEnd(); station += 3.7) {
+        EXPECT_LE((alignment.Point(station) - exact.Point(station)).Length(), tolerance);
+    }
+
+    // Seule une vraie clotoïde hors de portée de la tolérance fait échouer l'activation
+    EXPECT_FALSE(alignment.TryEnableApproximants(1e-16));
+}
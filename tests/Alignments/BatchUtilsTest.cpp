@@ -0,0 +1,41 @@
+#include <gtest/gtest.h>
+#include "LineaCore/Geometry/Alignments/BatchUtils.hpp"
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace LineaCore::Geometry::Alignments;
+
+TEST(BatchUtilsTest, CheckBatchSize) {
+    EXPECT_NO_THROW(BatchUtils::CheckBatchSize(3, 3));
+    EXPECT_THROW(BatchUtils::CheckBatchSize(3, 2), std::runtime_error);
+    EXPECT_GE(BatchUtils::ThreadCount(0), 1u);
+    EXPECT_EQ(BatchUtils::ThreadCount(5), 5u);
+}
+
+TEST(BatchUtilsTest, ParallelForRunsEveryTaskOnce) {
+    for (unsigned threadCount : {0u, 1u, 4u, 64u}) {
+        std::vector<std::atomic<int>> counts(1000);
+        BatchUtils::ParallelFor(counts.size(), threadCount, [&](std::size_t k) { ++counts[k]; });
+        for (std::size_t k = 0; k < counts.size(); ++k) {
+            ASSERT_EQ(counts[k].load(), 1) << "Task " << k << ", " << threadCount << " threads";
+        }
+    }
+    BatchUtils::ParallelFor(0, 4, [](std::size_t) { FAIL(); });
+}
+
+TEST(BatchUtilsTest, ParallelForRethrowsLowestFailingTask) {
+    for (unsigned threadCount : {1u, 4u}) {
+        try {
+            BatchUtils::ParallelFor(200, threadCount, [](std::size_t k) {
+                if (k % 50 == 7) {
+                    throw std::runtime_error(std::to_string(k));
+                }
+            });
+            FAIL() << "No exception";
+        } catch (const std::runtime_error& ex) {
+            EXPECT_EQ(std::string(ex.what()), "7") << threadCount << " threads";
+        }
+    }
+}
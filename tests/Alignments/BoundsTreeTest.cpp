@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+#include "LineaCore/Geometry/Alignments/BoundsTree.hpp"
+#include "ExampleFiles.hpp"
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace LineaCore::Geometry::Alignments;
+using namespace LineaCore::Geometry;
+using namespace LineaCore::Tests;
+
+TEST(BoundsTreeTest, NodesEncloseElements) {
+    const Alignment alignment = ReadFirstAlignment("TAE_Centre_01_01.xml");
+    const BoundsTree tree(alignment);
+    ASSERT_EQ(tree.ElementCount(), alignment.ElementCount());
+    EXPECT_EQ(tree.NodeCount(), 2 * alignment.ElementCount() - 1);
+
+    // Les boîtes exactes contiennent la discrétisation de chaque élément
+    for (std::size_t i = 0; i < alignment.ElementCount(); ++i) {
+        const BoundingBox box = tree.ElementBounds(i).Inflated(1e-9);
+        for (const Point2D& p : alignment.Element(i).Points(0.001)) {
+            EXPECT_TRUE(box.Contains(p)) << i;
+        }
+    }
+
+    // Chaque nœud interne est l'union de ses enfants et couvre leurs plages
+    std::size_t leafCount = 0;
+    for (std::size_t k = 0; k < tree.NodeCount(); ++k) {
+        const BoundsTree::Node& node = tree.GetNode(k);
+        if (node.Count == 1) {
+            EXPECT_EQ(node.First, leafCount++);
+            continue;
+        }
+        BoundingBox children = tree.GetNode(node.Left).Bounds;
+        children.Extend(tree.GetNode(node.Right).Bounds);
+        EXPECT_EQ(node.Bounds.MinX, children.MinX);
+        EXPECT_EQ(node.Bounds.MaxY, children.MaxY);
+        EXPECT_EQ(tree.GetNode(node.Left).First, node.First);
+        EXPECT_EQ(tree.GetNode(node.Left).Count + tree.GetNode(node.Right).Count, node.Count);
+    }
+    EXPECT_EQ(leafCount, alignment.ElementCount());
+}
+
+TEST(BoundsTreeTest, QueryMatchesBruteForce) {
+    const Alignment alignment = ReadFirstAlignment("TAE_Centre_01_01.xml");
+    const BoundsTree tree(alignment);
+    const BoundingBox bounds = tree.Bounds();
+
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<double> x(bounds.MinX, bounds.MaxX);
+    std::uniform_real_distribution<double> y(bounds.MinY, bounds.MaxY);
+    std::uniform_real_distribution<double> size(0.0, 0.1 * std::max(bounds.Width(), bounds.Height()));
+    for (int k = 0; k < 200; ++k) {
+        const double minX = x(generator), minY = y(generator);
+        const BoundingBox window(minX, minY, minX + size(generator), minY + size(generator));
+        std::vector<std::size_t> expected;
+        for (std::size_t i = 0; i < tree.ElementCount(); ++i) {
+            if (tree.ElementBounds(i).Intersects(window)) {
+                expected.push_back(i);
+            }
+        }
+        EXPECT_EQ(tree.Query(window), expected);
+    }
+
+    EXPECT_EQ(tree.Query(bounds).size(), alignment.ElementCount());
+    EXPECT_TRUE(tree.Query(BoundingBox(bounds.MaxX + 1.0, bounds.MinY, bounds.MaxX + 2.0, bounds.MaxY)).empty());
+}
+
+TEST(BoundsTreeTest, EmptyAlignment) {
+    const BoundsTree tree{Alignment()};
+    EXPECT_EQ(tree.NodeCount(), 0u);
+    EXPECT_TRUE(tree.Bounds().IsEmpty());
+    EXPECT_TRUE(tree.Query(BoundingBox(-1.0, -1.0, 1.0, 1.0)).empty());
+}
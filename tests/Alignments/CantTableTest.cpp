@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+#include "LineaCore/Geometry/Alignments/CantTable.hpp"
+#include "LineaCore/Geometry/Alignments/Alignment.hpp"
+#include "ExampleFiles.hpp"
+#include <libxml/xmlreader.h>
+#include <libxml/xmlwriter.h>
+#include <cstring>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace LineaCore::Geometry::Alignments;
+using namespace LineaCore::Tests;
+
+namespace {
+
+// Rampe 0 → 150 sur 100 m, palier, rampe 150 → 0 sur 50 m
+CantTable MakeCant() {
+    return CantTable("Test", 1.435, "insideRail", {
+        {1000.0, 0.0},
+        {1100.0, 150.0, CantCurvature::CounterClockwise},
+        {1300.0, 150.0, CantCurvature::CounterClockwise},
+        {1350.0, 0.0, CantCurvature::Clockwise, true},
+    });
+}
+
+CantTable ReadCant(const std::string& xml) {
+    xmlTextReaderPtr reader = xmlReaderForMemory(xml.data(), static_cast<int>(xml.size()), nullptr, nullptr, 0);
+    CantTable cant;
+    try {
+        while (xmlTextReaderRead(reader) == 1) {
+            if (xmlTextReaderNodeType(reader) == XML_READER_TYPE_ELEMENT &&
+                std::strcmp(reinterpret_cast<const char*>(xmlTextReaderConstLocalName(reader)), "Cant") == 0) {
+                cant.ReadLandXML(reader);
+                break;
+            }
+        }
+    } catch (...) {
+        xmlFreeTextReader(reader);
+        throw;
+    }
+    xmlFreeTextReader(reader);
+    return cant;
+}
+
+} // namespace
+
+TEST(CantTableTest, Interpolation) {
+    const CantTable cant = MakeCant();
+    EXPECT_EQ(cant.StationCount(), 4u);
+    EXPECT_DOUBLE_EQ(cant.AppliedCant(1050.0), 75.0);
+    EXPECT_DOUBLE_EQ(cant.CantGradient(1050.0), 1.5);
+    EXPECT_DOUBLE_EQ(cant.AppliedCant(1200.0), 150.0);
+    EXPECT_DOUBLE_EQ(cant.CantGradient(1200.0), 0.0);
+    EXPECT_DOUBLE_EQ(cant.AppliedCant(1325.0), 75.0);
+    EXPECT_DOUBLE_EQ(cant.CantGradient(1325.0), -3.0);
+
+    // Stations de la table et hors de la table
+    EXPECT_DOUBLE_EQ(cant.AppliedCant(1100.0), 150.0);
+    EXPECT_DOUBLE_EQ(cant.AppliedCant(900.0), 0.0);
+    EXPECT_DOUBLE_EQ(cant.CantGradient(900.0), 0.0);
+    EXPECT_DOUBLE_EQ(cant.AppliedCant(1400.0), 0.0);
+    EXPECT_DOUBLE_EQ(cant.CantGradient(1400.0), 0.0);
+
+    EXPECT_EQ(cant.IntervalIndex(900.0), 0u);
+    EXPECT_EQ(cant.IntervalIndex(1100.0), 1u);
+    EXPECT_EQ(cant.IntervalIndex(2000.0), 3u);
+
+    const CantStation last = cant.Station(3);
+    EXPECT_EQ(last.Curvature, CantCurvature::Clockwise);
+    EXPECT_TRUE(last.Adverse);
+}
+
+TEST(CantTableTest, BatchMatchesScalar) {
+    const CantTable cant = MakeCant();
+    std::vector<double> stations;
+    for (double s = 950.0; s <= 1400.0; s += 0.25) {
+        stations.push_back(s);
+    }
+    std::mt19937 generator(3);
+    std::uniform_real_distribution<double> distribution(950.0, 1400.0);
+    for (int i = 0; i < 200; ++i) {
+        stations.push_back(distribution(generator));
+    }
+
+    std::vector<double> cants(stations.size()), gradients(stations.size());
+    cant.AppliedCant(stations, cants);
+    cant.CantGradient(stations, gradients);
+    for (std::size_t i = 0; i < stations.size(); ++i) {
+        EXPECT_DOUBLE_EQ(cants[i], cant.AppliedCant(stations[i])) << stations[i];
+        EXPECT_DOUBLE_EQ(gradients[i], cant.CantGradient(stations[i])) << stations[i];
+    }
+
+    std::vector<double> tooShort(1);
+    EXPECT_THROW(cant.AppliedCant(stations, tooShort), std::runtime_error);
+}
+
+TEST(CantTableTest, InvalidTables) {
+    EXPECT_THROW(CantTable("A", 1.435, "", {}), std::runtime_error);
+    EXPECT_THROW(CantTable("A", 1.435, "", {{10.0, 0.0}, {10.0, 1.0}}), std::runtime_error);
+    EXPECT_THROW(CantTable().AppliedCant(0.0), std::runtime_error);
+    EXPECT_THROW(ReadCant("<Cant name=\"A\" gauge=\"1.435\"><CantStation station=\"0\" appliedCant=\"0\" curvature=\"left\"/></Cant>"),
+                 std::runtime_error);
+}
+
+TEST(CantTableTest, ReadWriteLandXML) {
+    const CantTable cant = MakeCant();
+    xmlBufferPtr buffer = xmlBufferCreate();
+    xmlTextWriterPtr writer = xmlNewTextWriterMemory(buffer, 0);
+    cant.WriteLandXML(writer);
+    xmlFreeTextWriter(writer);
+    const std::string xml(reinterpret_cast<const char*>(xmlBufferContent(buffer)));
+    xmlBufferFree(buffer);
+
+    const CantTable reread = ReadCant(xml);
+    EXPECT_EQ(reread.Name(), "Test");
+    EXPECT_DOUBLE_EQ(reread.Gauge(), 1.435);
+    EXPECT_EQ(reread.RotationPoint(), "insideRail");
+    ASSERT_EQ(reread.StationCount(), cant.StationCount());
+    for (std::size_t i = 0; i < cant.StationCount(); ++i) {
+        EXPECT_DOUBLE_EQ(reread.Station(i).Station, cant.Station(i).Station);
+        EXPECT_DOUBLE_EQ(reread.Station(i).AppliedCant, cant.Station(i).AppliedCant);
+        EXPECT_EQ(reread.Station(i).Curvature, cant.Station(i).Curvature);
+        EXPECT_EQ(reread.Station(i).Adverse, cant.Station(i).Adverse);
+    }
+}
+
+TEST(CantTableTest, ExampleFile) {
+    xmlTextReaderPtr reader = xmlReaderForFile((ExamplesDir + "/v1.xml").c_str(), nullptr, 0);
+    ASSERT_NE(reader, nullptr);
+    Alignment alignment;
+    while (xmlTextReaderRead(reader) == 1) {
+        if (xmlTextReaderNodeType(reader) == XML_READER_TYPE_ELEMENT &&
+            std::strcmp(reinterpret_cast<const char*>(xmlTextReaderConstLocalName(reader)), "Alignment") == 0) {
+            alignment.ReadLandXML(reader);
+            break;
+        }
+    }
+    xmlFreeTextReader(reader);
+
+    ASSERT_EQ(alignment.CantCount(), 1u);
+    const CantTable& cant = alignment.Cant(0);
+    EXPECT_DOUBLE_EQ(cant.Gauge(), 4.7083333);
+    EXPECT_EQ(cant.RotationPoint(), "insideRail");
+    ASSERT_EQ(cant.StationCount(), 18u);
+    EXPECT_DOUBLE_EQ(cant.Station(2).AppliedCant, 1.32);
+    EXPECT_EQ(cant.Station(4).Curvature, CantCurvature::CounterClockwise);
+    EXPECT_DOUBLE_EQ(cant.AppliedCant(478000.0), 1.32);
+    EXPECT_NEAR(cant.CantGradient(477800.0), 1.32 / (477847.8178122 - 477736.0975757), 1e-15);
+}
@@ -0,0 +1,185 @@
+#include <gtest/gtest.h>
+#include "LineaCore/Geometry/Alignments/ContinuityValidator.hpp"
+#include "LineaCore/Geometry/Alignments/Horizontal/CurvedAlignment.hpp"
+#include "LineaCore/Geometry/Alignments/Horizontal/StraightAlignment.hpp"
+#include "LineaCore/LandXML/LandXMLAlignmentLoader.hpp"
+#include "ExampleFiles.hpp"
+#include <cmath>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace LineaCore::Geometry::Alignments;
+using namespace LineaCore::Geometry::Alignments::Horizontal;
+using namespace LineaCore::Geometry;
+using namespace LineaCore::Tests;
+
+TEST(ContinuityValidatorTest, JunctionChecks) {
+    // Droite, arc tangent parcouru dans le sens horaire (G1 sans G2), puis droite décalée et brisée
+    Alignment alignment("Test", 100.0);
+    alignment.AddElement(std::make_unique<StraightAlignment>(Point2D(0.0, 0.0), Vector2D(1.0, 0.0), 100.0));
+    alignment.AddElement(std::make_unique<CurvedAlignment>(Point2D(100.0, -200.0), 200.0, -1.0, M_PI / 2.0, 100.0));
+    const Point2D arcEnd = alignment.Element(1).getEndingPoint();
+    alignment.AddElement(std::make_unique<StraightAlignment>(arcEnd + Vector2D(0.01, 0.0), Vector2D(1.0, -1.0), 50.0));
+
+    const AlignmentContinuity result = ContinuityValidator::Validate(alignment);
+    EXPECT_EQ(result.ElementCount, 3u);
+    ASSERT_EQ(result.Issues.size(), 4u);
+
+    // Jonction droite / arc : seule la courbure saute
+    EXPECT_EQ(result.Issues[0].Check, ContinuityCheck::Curvature);
+    EXPECT_EQ(result.Issues[0].Element, 1u);
+    EXPECT_DOUBLE_EQ(result.Issues[0].Station, 200.0);
+    EXPECT_NEAR(result.Issues[0].Deviation, 1.0 / 200.0, 1e-15);
+
+    // Jonction arc / droite : écart de 1 cm, tangente tournée de π/4 - 0,5 rad, courbure
+    EXPECT_EQ(result.Issues[1].Check, ContinuityCheck::Position);
+    EXPECT_NEAR(result.Issues[1].Deviation, 0.01, 1e-9);
+    EXPECT_EQ(result.Issues[2].Check, ContinuityCheck::Tangent);
+    EXPECT_NEAR(result.Issues[2].Deviation, M_PI / 4.0 - 0.5, 1e-12);
+    EXPECT_EQ(result.Issues[3].Check, ContinuityCheck::Curvature);
+    EXPECT_DOUBLE_EQ(result.Issues[3].Station, 300.0);
+
+    EXPECT_NEAR(result.MaxPositionGap, 0.01, 1e-9);
+    EXPECT_NEAR(result.MaxCurvatureJump, 1.0 / 200.0, 1e-15);
+
+    // Tolérances plus larges : aucun écart
+    ContinuityTolerances tolerances;
+    tolerances.Position = 0.02;
+    tolerances.Angle = 0.3;
+    tolerances.Curvature = 0.01;
+    EXPECT_TRUE(ContinuityValidator::Validate(alignment, tolerances).Issues.empty());
+}
+
+TEST(ContinuityValidatorTest, DeclaredValues) {
+    std::vector<Alignment> alignments = LineaCore::LandXML::LandXMLAlignmentLoader::ReadFile(ExamplesDir + "/v1.xml", 1);
+    Alignment& alignment = alignments.front();
+    EXPECT_DOUBLE_EQ(alignment.DeclaredLength(), 4998.2315227);
+    EXPECT_DOUBLE_EQ(alignment.DeclaredElementLength(0), 536.0975757);
+    EXPECT_DOUBLE_EQ(alignment.DeclaredElementStation(1), 477736.0975757);
+
+    // Stations de début déclarées en stations internes, malgré l'équation de station
+    EXPECT_TRUE(ContinuityValidator::Validate(alignment).Issues.empty());
+    EXPECT_FALSE(ContinuityValidator::Validate(alignment).ExternalStations);
+
+    // Élément ajouté après la lecture : pas de valeurs déclarées
+    alignment.AddElement(std::make_unique<StraightAlignment>(alignment.Element(alignment.ElementCount() - 1).getEndingPoint(), Vector2D(1.0, 0.0), 10.0));
+    EXPECT_TRUE(std::isnan(alignment.DeclaredElementLength(alignment.ElementCount() - 1)));
+
+    // La longueur déclarée de l'axe ne correspond plus
+    const AlignmentContinuity result = ContinuityValidator::Validate(alignment, ContinuityTolerances{1.0, 10.0, 1.0, 1e-3});
+    ASSERT_EQ(result.Issues.size(), 1u);
+    EXPECT_EQ(result.Issues[0].Check, ContinuityCheck::AlignmentLength);
+    EXPECT_NEAR(result.Issues[0].Deviation, 10.0, 1e-6);
+}
+
+TEST(ContinuityValidatorTest, StationEquations) {
+    // Équations dans le désordre, la seconde sur l'axe ayant un staBack décalé de 10 m (1150 attendu)
+    const std::string document = R"(<?xml version="1.0" encoding="utf-8"?>
+<LandXML xmlns="http://www.landxml.org/schema/LandXML-1.2">
+  <Alignments>
+    <Alignment name="A" staStart="0" length="200">
+      <CoordGeom>
+        <Line staStart="0" length="100"><Start>0 0</Start><End>0 100</End></Line>
+        <Line staStart="100" length="100"><Start>0 100</Start><End>0 200</End></Line>
+      </CoordGeom>
+      <StaEquation staInternal="150" staBack="1160" staAhead="2000"/>
+      <StaEquation staInternal="50" staBack="50" staAhead="1050"/>
+    </Alignment>
+  </Alignments>
+</LandXML>
+)";
+    const std::vector<Alignment> alignments = LineaCore::LandXML::LandXMLAlignmentLoader::ReadMemory(document, 1);
+    ASSERT_EQ(alignments.size(), 1u);
+    const Alignment& alignment = alignments.front();
+    EXPECT_DOUBLE_EQ(alignment.ExternalStation(100.0), 1100.0);
+    EXPECT_DOUBLE_EQ(alignment.ExternalStation(175.0), 2025.0);
+
+    const AlignmentContinuity result = ContinuityValidator::Validate(alignment);
+    ASSERT_EQ(result.Issues.size(), 1u);
+    EXPECT_EQ(result.Issues[0].Check, ContinuityCheck::StationEquation);
+    EXPECT_EQ(result.Issues[0].Element, 1u);
+    EXPECT_DOUBLE_EQ(result.Issues[0].Station, 150.0);
+    EXPECT_NEAR(result.Issues[0].Deviation, 10.0, 1e-9);
+    EXPECT_STREQ(ContinuityValidator::CheckName(ContinuityCheck::StationEquation), "station_equation");
+}
+
+TEST(ContinuityValidatorTest, ElementStationFrame) {
+    // Équation de station à 150 (150 → 1150) : les stations externes des éléments 2 et 3 sont 1200 et 1300
+    auto document = [](const std::string& staStart2, const std::string& staStart3) {
+        return R"(<?xml version="1.0" encoding="utf-8"?>
+<LandXML xmlns="http://www.landxml.org/schema/LandXML-1.2">
+  <Alignments>
+    <Alignment name="A" staStart="0" length="400">
+      <CoordGeom>
+        <Line staStart="0" length="100"><Start>0 0</Start><End>0 100</End></Line>
+        <Line staStart="100" length="100"><Start>0 100</Start><End>0 200</End></Line>
+        <Line staStart=")" + staStart2 + R"(" length="100"><Start>0 200</Start><End>0 300</End></Line>
+        <Line staStart=")" + staStart3 + R"(" length="100"><Start>0 300</Start><End>0 400</End></Line>
+      </CoordGeom>
+      <StaEquation staInternal="150" staBack="150" staAhead="1150"/>
+    </Alignment>
+  </Alignments>
+</LandXML>
+)";
+    };
+    auto validate = [](const std::string& text) {
+        return ContinuityValidator::Validate(LineaCore::LandXML::LandXMLAlignmentLoader::ReadMemory(text, 1).front());
+    };
+
+    // Stations externes, la dernière décalée de 0,5 m
+    AlignmentContinuity result = validate(document("1200", "1300.5"));
+    EXPECT_TRUE(result.ExternalStations);
+    ASSERT_EQ(result.Issues.size(), 1u);
+    EXPECT_EQ(result.Issues[0].Check, ContinuityCheck::ElementStation);
+    EXPECT_EQ(result.Issues[0].Element, 3u);
+    EXPECT_NEAR(result.Issues[0].Deviation, 0.5, 1e-9);
+
+    // Stations internes
+    result = validate(document("200", "300"));
+    EXPECT_FALSE(result.ExternalStations);
+    EXPECT_TRUE(result.Issues.empty());
+
+    // Repères mélangés : l'élément écrit en station interne est reporté dans le repère externe
+    result = validate(document("1200", "300"));
+    EXPECT_TRUE(result.ExternalStations);
+    ASSERT_EQ(result.Issues.size(), 1u);
+    EXPECT_EQ(result.Issues[0].Element, 3u);
+    EXPECT_NEAR(result.Issues[0].Deviation, 1000.0, 1e-9);
+}
+
+TEST(ContinuityValidatorTest, ValidateFilesAndReport) {
+    const std::vector<std::string> fileNames{ExamplesDir + "/TAE_Centre_01_01.xml", ExamplesDir + "/Missing.xml",
+                                             ExamplesDir + "/Toutes les voies et Surfaces.xml", ExamplesDir + "/v1.xml"};
+    const std::vector<FileContinuity> results = ContinuityValidator::ValidateFiles(fileNames, {}, 3);
+    ASSERT_EQ(results.size(), fileNames.size());
+    EXPECT_TRUE(results[0].Error.empty());
+    EXPECT_FALSE(results[1].Error.empty());
+    EXPECT_TRUE(results[1].Alignments.empty());
+    EXPECT_EQ(results[2].Alignments.size(), 3u);
+    for (std::size_t k : {0u, 2u, 3u}) {
+        EXPECT_EQ(results[k].FileName, fileNames[k]);
+        for (const AlignmentContinuity& alignment : results[k].Alignments) {
+            EXPECT_TRUE(alignment.Issues.empty()) << alignment.Name;
+            EXPECT_LT(alignment.MaxPositionGap, 1e-3);
+        }
+    }
+
+    // Mêmes résultats en séquentiel
+    const std::vector<FileContinuity> sequential = ContinuityValidator::ValidateFiles(fileNames, {}, 1);
+    for (std::size_t k = 0; k < results.size(); ++k) {
+        ASSERT_EQ(sequential[k].Alignments.size(), results[k].Alignments.size());
+        for (std::size_t a = 0; a < results[k].Alignments.size(); ++a) {
+            EXPECT_EQ(sequential[k].Alignments[a].MaxAngleGap, results[k].Alignments[a].MaxAngleGap);
+        }
+    }
+
+    std::ostringstream report;
+    ContinuityValidator::WriteJson(report, results, {});
+    const std::string json = report.str();
+    EXPECT_NE(json.find("\"unreadable_files\": 1"), std::string::npos);
+    EXPECT_NE(json.find("\"alignments\": 5"), std::string::npos);
+    EXPECT_NE(json.find("\"name\": \"Voie_Nivelee\""), std::string::npos);
+    EXPECT_NE(json.find("\"error\": null"), std::string::npos);
+}
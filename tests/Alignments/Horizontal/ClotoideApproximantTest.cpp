@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+#include "LineaCore/Geometry/Alignments/Horizontal/ClotoideApproximant.hpp"
+#include "LineaCore/Geometry/Point2D.hpp"
+#include "LineaCore/Geometry/Vector2D.hpp"
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace LineaCore::Geometry::Alignments::Horizontal;
+using namespace LineaCore::Geometry;
+
+namespace {
+
+ClotoideTransition MakeEntryClotoide() {
+    return ClotoideTransition(373.9820021, 0.0, 111.7202365, Vector2D(-0.5654, -0.8248).Normalized(), Vector2D(1319630.077000, 6248132.874953));
+}
+
+// Sortie de courbe serrée : forte variation de courbure
+ClotoideTransition MakeExitClotoide() {
+    return ClotoideTransition(-60.0, -120.0, 120.0, Vector2D(0.0, 1.0), Vector2D(500.0, 200.0));
+}
+
+} // namespace
+
+TEST(ClotoideApproximantTest, ErrorWithinTolerance) {
+    std::mt19937 generator(42);
+    for (const ClotoideTransition& clotoide : {MakeEntryClotoide(), MakeExitClotoide()}) {
+        for (const double tolerance : {1e-3, 1e-6, 1e-8}) {
+            ClotoideApproximant approximant;
+            ASSERT_TRUE(ClotoideApproximant::TryBuild(clotoide, tolerance, approximant)) << tolerance;
+            EXPECT_LE(approximant.MaxError(), tolerance);
+            EXPECT_GE(approximant.SegmentCount(), 1u);
+            EXPECT_DOUBLE_EQ(approximant.Length(), clotoide.Length());
+
+            std::uniform_real_distribution<double> distribution(0.0, clotoide.Length());
+            for (int i = 0; i < 1000; ++i) {
+                const double s = distribution(generator);
+                EXPECT_LE((approximant.Point(s) - clotoide.Point(s)).Length(), tolerance) << s;
+                EXPECT_LE((approximant.Normal(s) - clotoide.Normal(s)).Length(), tolerance) << s;
+            }
+            EXPECT_LE((approximant.Point(clotoide.Length()) - clotoide.getEndingPoint()).Length(), tolerance);
+        }
+    }
+}
+
+TEST(ClotoideApproximantTest, TighterToleranceUsesMoreSegments) {
+    ClotoideApproximant coarse, fine;
+    ASSERT_TRUE(ClotoideApproximant::TryBuild(MakeExitClotoide(), 1e-3, coarse));
+    ASSERT_TRUE(ClotoideApproximant::TryBuild(MakeExitClotoide(), 1e-8, fine));
+    EXPECT_LT(coarse.SegmentCount(), fine.SegmentCount());
+}
+
+TEST(ClotoideApproximantTest, ExactOutsideDomain) {
+    const ClotoideTransition clotoide = MakeEntryClotoide();
+    ClotoideApproximant approximant;
+    ASSERT_TRUE(ClotoideApproximant::TryBuild(clotoide, 1e-6, approximant));
+    for (const double s : {-10.0, -1e-9, clotoide.Length() + 1e-9, clotoide.Length() + 25.0}) {
+        EXPECT_EQ(approximant.Point(s), clotoide.Point(s));
+        EXPECT_EQ(approximant.Normal(s), clotoide.Normal(s));
+    }
+}
+
+TEST(ClotoideApproximantTest, BatchMatchesScalar) {
+    ClotoideApproximant approximant;
+    ASSERT_TRUE(ClotoideApproximant::TryBuild(MakeExitClotoide(), 1e-6, approximant));
+    std::vector<double> stations;
+    for (int i = -5; i <= 125; ++i) {
+        stations.push_back(static_cast<double>(i));
+    }
+    std::vector<Point2D> points(stations.size());
+    std::vector<Vector2D> normals(stations.size());
+    approximant.Point(stations, points);
+    approximant.Normal(stations, normals);
+    for (std::size_t i = 0; i < stations.size(); ++i) {
+        EXPECT_EQ(points[i], approximant.Point(stations[i]));
+        EXPECT_EQ(normals[i], approximant.Normal(stations[i]));
+    }
+
+    std::vector<Point2D> tooFew(1);
+    EXPECT_THROW(approximant.Point(stations, tooFew), std::runtime_error);
+}
+
+TEST(ClotoideApproximantTest, InvalidTolerance) {
+    ClotoideApproximant approximant;
+    EXPECT_FALSE(ClotoideApproximant::TryBuild(MakeEntryClotoide(), 0.0, approximant));
+    EXPECT_FALSE(ClotoideApproximant::TryBuild(MakeEntryClotoide(), -1.0, approximant));
+    // En deçà de la précision des coordonnées (~1e6 m), la tolérance ne peut être atteinte
+    EXPECT_FALSE(ClotoideApproximant::TryBuild(MakeEntryClotoide(), 1e-16, approximant));
+    EXPECT_EQ(approximant.SegmentCount(), 0u);
+}
@@ -0,0 +1,257 @@
+#include <gtest/gtest.h>
+#include "LineaCore/Geometry/Alignments/Horizontal/ClotoideTransition.hpp"
+#include "LineaCore/Geometry/Point2D.hpp"
+#include "LineaCore/Geometry/Vector2D.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+using namespace LineaCore::Geometry::Alignments::Horizontal;
+using namespace LineaCore::Geometry;
+
+namespace {
+
+// Écart en ULP entre deux doubles de même signe
+std::int64_t UlpDistance(double a, double b) {
+    if (a == b) {
+        return 0;
+    }
+    std::int64_t ia, ib;
+    std::memcpy(&ia, &a, sizeof(double));
+    std::memcpy(&ib, &b, sizeof(double));
+    if ((ia < 0) != (ib < 0)) {
+        return std::numeric_limits<std::int64_t>::max();
+    }
+    return ia > ib ? ia - ib : ib - ia;
+}
+
+// Le chemin par lots peut utiliser un noyau vectoriel (FMA) : on tolère quelques ULP
+constexpr std::int64_t MaxBatchUlp = 4;
+
+ClotoideTransition MakeEntryClotoide() {
+    ClotoideTransition clotoide(373.9820021, 0.0, 111.7202365, Vector2D(-0.5654, -0.8248).Normalized(), Vector2D(1319630.077000, 6248132.874953));
+    return clotoide;
+}
+
+} // namespace
+
+TEST(ClotoideTransitionTest, Extremities) {
+    ClotoideTransition clotoide = MakeEntryClotoide();
+
+    EXPECT_EQ(clotoide.Type(), HorizontalAlignment::H_Type::Transition);
+    EXPECT_DOUBLE_EQ(clotoide.Length(), 111.7202365);
+    EXPECT_DOUBLE_EQ(clotoide.Curvature(0.0), 0.0);
+    EXPECT_NEAR(clotoide.Curvature(clotoide.Length()), 1.0 / 1251.8997660, 1e-9);
+    EXPECT_NEAR(clotoide.getStartingPoint().X, 1319630.077000, 1e-9);
+    EXPECT_NEAR(clotoide.getStartingPoint().Y, 6248132.874953, 1e-9);
+}
+
+TEST(ClotoideTransitionTest, BatchEvaluationMatchesScalar) {
+    ClotoideTransition clotoide = MakeEntryClotoide();
+
+    std::vector<double> stations;
+    for (int i = 0; i <= 1000; ++i) {
+        stations.push_back(clotoide.Length() * i / 1000.0);
+    }
+    std::vector<Point2D> points(stations.size());
+    std::vector<Vector2D> normals(stations.size());
+    std::vector<double> curvatures(stations.size());
+
+    clotoide.Point(stations, points);
+    clotoide.Normal(stations, normals);
+    clotoide.Curvature(stations, curvatures);
+
+    for (std::size_t i = 0; i < stations.size(); ++i) {
+        Point2D expected = clotoide.Point(stations[i]);
+        EXPECT_LE(UlpDistance(points[i].X, expected.X), MaxBatchUlp);
+        EXPECT_LE(UlpDistance(points[i].Y, expected.Y), MaxBatchUlp);
+        EXPECT_EQ(normals[i], clotoide.Normal(stations[i]));
+        EXPECT_EQ(curvatures[i], clotoide.Curvature(stations[i]));
+    }
+}
+
+TEST(ClotoideTransitionTest, PointsFollowElementDirection) {
+    ClotoideTransition entry = MakeEntryClotoide();
+    // Clotoïde de sortie : même paramètre, parcourue de la courbure maximale vers l'origine
+    ClotoideTransition exit(373.9820021, -111.7202365, 111.7202365, Vector2D(1.0, 0.0), Vector2D(0.0, 0.0));
+
+    for (const ClotoideTransition* clotoide : {&entry, &exit}) {
+        const double maxThrow = 0.001;
+        std::vector<Point2D> points = clotoide->Points(maxThrow);
+        ASSERT_EQ(points.size(), clotoide->PointCount(maxThrow));
+        EXPECT_EQ(points.front(), clotoide->getStartingPoint());
+        EXPECT_EQ(points.back(), clotoide->getEndingPoint());
+
+        // Segments de même longueur
+        const std::size_t N = points.size() - 1;
+        const double length = clotoide->Length();
+        for (std::size_t i = 0; i < N; ++i) {
+            EXPECT_LT((points[i] - clotoide->Point(length * i / N)).Length(), 1e-9) << i;
+        }
+    }
+
+    std::vector<Point2D> tooSmall(3);
+    EXPECT_THROW(entry.Points(0.001, tooSmall), std::runtime_error);
+}
+
+TEST(ClotoideTransitionTest, PointsChordErrorWithinThrow) {
+    // Clotoïde partant de son origine : le pas angulaire constant dépassait la flèche près de l'origine
+    ClotoideTransition clotoide(200.0, 0.0, 120.0, Vector2D(1.0, 0.0), Vector2D(0.0, 0.0));
+    for (double maxThrow : {0.1, 0.01, 0.001}) {
+        const std::vector<Point2D> points = clotoide.Points(maxThrow);
+        const std::size_t N = points.size() - 1;
+        double worst = 0.0;
+        for (std::size_t i = 0; i < N; ++i) {
+            // Écart à la corde de points denses de l'arc [s_i, s_i+1]
+            const Vector2D chord = points[i + 1] - points[i];
+            const double chordLength = chord.Length();
+            for (int k = 1; k < 32; ++k) {
+                const Point2D p = clotoide.Point(clotoide.Length() * (i + k / 32.0) / N);
+                worst = std::max(worst, std::fabs((chord / (p - points[i])) / chordLength));
+            }
+        }
+        EXPECT_LE(worst, maxThrow) << maxThrow;
+    }
+}
+
+TEST(ClotoideTransitionTest, ChordSegmentCount) {
+    // ℓ·sqrt(c/(8·e)) = 10·sqrt(0.5/2) = 5
+    EXPECT_EQ(HorizontalAlignment::ChordSegmentCount(10.0, 0.5, 0.25), 5u);
+    EXPECT_EQ(HorizontalAlignment::ChordSegmentCount(10.0, -0.5, 0.25), 5u);
+    EXPECT_EQ(HorizontalAlignment::ChordSegmentCount(10.0, 0.0, 0.25), 1u);
+    EXPECT_EQ(HorizontalAlignment::ChordSegmentCount(0.0, 0.5, 0.25), 1u);
+    EXPECT_THROW(HorizontalAlignment::ChordSegmentCount(10.0, 0.5, 0.0), std::runtime_error);
+
+    ClotoideTransition clotoide(200.0, 0.0, 120.0, Vector2D(1.0, 0.0), Vector2D(0.0, 0.0));
+    EXPECT_EQ(clotoide.PointCount(0.01), clotoide.ChordSegmentCount(0.01) + 1);
+
+    std::vector<double> abscissas(4);
+    HorizontalAlignment::UniformAbscissas(3.0, abscissas);
+    EXPECT_EQ(abscissas, (std::vector<double>{0.0, 1.0, 2.0, 3.0}));
+}
+
+namespace {
+
+// Ancienne résolution par point fixe sur la longueur développée, pour comparaison
+double FixedPointLength(const Vector2D& chordVector, double startingCurvature, double endingCurvature) {
+    const double c = chordVector.Length();
+    double l = c, dl = 0.0;
+    do {
+        l += dl;
+        const double A2 = l / (endingCurvature - startingCurvature);
+        const double A = std::sqrt(std::fabs(A2)) * (A2 > 0 ? 1.0 : -1.0);
+        const double sDeb = A2 * startingCurvature;
+        dl = c - (ClotoideTransition::PtLoc(sDeb + l, A) - ClotoideTransition::PtLoc(sDeb, A)).Length();
+    } while (std::fabs(dl / l) >= 1E-14);
+    return l;
+}
+
+std::vector<ClotoideFitInput> MakeFitInputs() {
+    const ClotoideTransition entry = MakeEntryClotoide();
+    const Vector2D chord = entry.getEndingPoint() - entry.getStartingPoint();
+    return {
+        {entry.getStartingPoint(), chord, 0.0, entry.Curvature(entry.Length())},        // Entrée de courbe
+        {entry.getStartingPoint(), chord, -1.0 / 1251.8997660, 0.0},                    // Sortie de courbe à droite
+        {Point2D(10.0, 20.0), Vector2D(80.0, 5.0), 1.0 / 900.0, 1.0 / 300.0},           // Raccordement progressif
+        {Point2D(0.0, 0.0), Vector2D(0.0, -150.0), -1.0 / 200.0, -1.0 / 2000.0},
+        {Point2D(0.0, 0.0), Vector2D(30.0, 0.0), 0.0, 1.0 / 20.0},                      // Forte déviation
+    };
+}
+
+} // namespace
+
+TEST(ClotoideTransitionTest, TryFromVectorAndCurvatures) {
+    for (const ClotoideFitInput& input : MakeFitInputs()) {
+        ClotoideTransition clotoide;
+        ClotoideFitStatistics statistics;
+        ASSERT_TRUE(ClotoideTransition::TryFromVectorAndCurvatures(input.StartingPoint, input.ChordVector, input.StartingCurvature,
+                                                                   input.EndingCurvature, clotoide, &statistics));
+        EXPECT_TRUE(statistics.Converged);
+        EXPECT_LT(statistics.RelativeResidual, 1e-12);
+        EXPECT_LE(statistics.Iterations, 10);
+
+        EXPECT_NEAR(clotoide.Length(), FixedPointLength(input.ChordVector, input.StartingCurvature, input.EndingCurvature), 1e-9);
+        EXPECT_NEAR(clotoide.Curvature(0.0), input.StartingCurvature, 1e-12);
+        EXPECT_NEAR(clotoide.Curvature(clotoide.Length()), input.EndingCurvature, 1e-12);
+        EXPECT_NEAR(clotoide.getStartingPoint().X, input.StartingPoint.X, 1e-8);
+        EXPECT_NEAR(clotoide.getStartingPoint().Y, input.StartingPoint.Y, 1e-8);
+        EXPECT_NEAR(clotoide.getEndingPoint().X, input.StartingPoint.X + input.ChordVector.X, 1e-8);
+        EXPECT_NEAR(clotoide.getEndingPoint().Y, input.StartingPoint.Y + input.ChordVector.Y, 1e-8);
+    }
+}
+
+TEST(ClotoideTransitionTest, TryFromVectorAndCurvatures_Batch) {
+    const std::vector<ClotoideFitInput> inputs = MakeFitInputs();
+    std::vector<ClotoideTransition> clotoides(inputs.size());
+    std::vector<ClotoideFitStatistics> statistics(inputs.size());
+    ASSERT_TRUE(ClotoideTransition::TryFromVectorAndCurvatures(inputs, clotoides, statistics));
+
+    for (std::size_t i = 0; i < inputs.size(); ++i) {
+        ClotoideTransition expected;
+        ClotoideFitStatistics expectedStatistics;
+        ASSERT_TRUE(ClotoideTransition::TryFromVectorAndCurvatures(inputs[i].StartingPoint, inputs[i].ChordVector, inputs[i].StartingCurvature,
+                                                                   inputs[i].EndingCurvature, expected, &expectedStatistics));
+        EXPECT_TRUE(statistics[i].Converged);
+        EXPECT_NEAR(statistics[i].Iterations, expectedStatistics.Iterations, 1);
+        EXPECT_NEAR(clotoides[i].Parameter(), expected.Parameter(), 1e-12 * std::fabs(expected.Parameter()));
+        EXPECT_NEAR(clotoides[i].Length(), expected.Length(), 1e-12 * expected.Length());
+        EXPECT_NEAR(clotoides[i].getEndingPoint().X, expected.getEndingPoint().X, 1e-8);
+        EXPECT_NEAR(clotoides[i].getEndingPoint().Y, expected.getEndingPoint().Y, 1e-8);
+    }
+
+    std::vector<ClotoideTransition> tooFew(1);
+    EXPECT_THROW(ClotoideTransition::TryFromVectorAndCurvatures(inputs, tooFew), std::runtime_error);
+}
+
+TEST(ClotoideTransitionTest, TryFromVectorAndCurvatures_Failures) {
+    ClotoideTransition clotoide;
+    ClotoideFitStatistics statistics;
+
+    // Courbures égales ou corde nulle : données dégénérées
+    EXPECT_FALSE(ClotoideTransition::TryFromVectorAndCurvatures(Point2D(0.0, 0.0), Vector2D(100.0, 0.0), 0.01, 0.01, clotoide, &statistics));
+    EXPECT_FALSE(statistics.Converged);
+    EXPECT_FALSE(ClotoideTransition::TryFromVectorAndCurvatures(Point2D(0.0, 0.0), Vector2D(0.0, 0.0), 0.0, 0.01, clotoide, &statistics));
+
+    // Corde plus longue que toute clotoïde entre ces courbures : arrêt après un nombre borné d'itérations
+    EXPECT_FALSE(ClotoideTransition::TryFromVectorAndCurvatures(Point2D(0.0, 0.0), Vector2D(10000.0, 0.0), 1.0 / 100.0, 1.0 / 50.0, clotoide, &statistics));
+    EXPECT_FALSE(statistics.Converged);
+    EXPECT_GT(statistics.Iterations, 0);
+    EXPECT_LE(statistics.Iterations, 100);
+
+    std::vector<ClotoideFitInput> inputs = MakeFitInputs();
+    inputs[1].EndingCurvature = inputs[1].StartingCurvature;
+    std::vector<ClotoideTransition> clotoides(inputs.size());
+    std::vector<ClotoideFitStatistics> batchStatistics(inputs.size());
+    EXPECT_FALSE(ClotoideTransition::TryFromVectorAndCurvatures(inputs, clotoides, batchStatistics));
+    EXPECT_TRUE(batchStatistics[0].Converged);
+    EXPECT_FALSE(batchStatistics[1].Converged);
+    EXPECT_TRUE(batchStatistics[2].Converged);
+}
+
+TEST(ClotoideTransitionTest, Bounds) {
+    // Clotoïdes traversant leur point d'inflexion, le cap variant de plus d'un quadrant de chaque côté
+    const std::vector<ClotoideTransition> clotoides{
+        ClotoideTransition(30.0, -60.0, 120.0, Vector2D(1.0, 0.3).Normalized(), Vector2D(10.0, -5.0)),
+        ClotoideTransition(-30.0, -20.0, 90.0, Vector2D(-0.2, 1.0).Normalized(), Vector2D(0.0, 0.0)),
+        MakeEntryClotoide()};
+    for (const ClotoideTransition& clotoide : clotoides) {
+        const BoundingBox box = clotoide.Bounds();
+        BoundingBox sampled;
+        constexpr int SampleCount = 20000;
+        for (int i = 0; i <= SampleCount; ++i) {
+            sampled.Extend(clotoide.Point(clotoide.Length() * i / SampleCount));
+        }
+        // Boîte exacte : contient les échantillons et les serre à l'erreur d'échantillonnage près
+        EXPECT_LE(box.MinX, sampled.MinX + 1e-9);
+        EXPECT_LE(box.MinY, sampled.MinY + 1e-9);
+        EXPECT_GE(box.MaxX, sampled.MaxX - 1e-9);
+        EXPECT_GE(box.MaxY, sampled.MaxY - 1e-9);
+        EXPECT_NEAR(box.MinX, sampled.MinX, 1e-4);
+        EXPECT_NEAR(box.MinY, sampled.MinY, 1e-4);
+        EXPECT_NEAR(box.MaxX, sampled.MaxX, 1e-4);
+        EXPECT_NEAR(box.MaxY, sampled.MaxY, 1e-4);
+    }
+}
@@ -2,6 +2,8 @@
 #include "LineaCore/Geometry/Alignments/Horizontal/CurvedAlignment.hpp"
 #include "LineaCore/Geometry/Point2D.hpp" // Ensure this header file defines the Point2D class
 #include "LineaCore/Geometry/Vector2D.hpp"
+#include <stdexcept>
+#include <vector>
 
 using namespace LineaCore::Geometry::Alignments::Horizontal;
 using namespace LineaCore::Geometry;
@@ -93,3 +95,59 @@ TEST(CurvedAlignmentTest, Deserialization) {
     EXPECT_NEAR(curve->Point(25.0).X, 1319515.3114442297, 1e-3);
     EXPECT_NEAR(curve->Point(25.0).Y, 6248058.6181983491, 1e-3);
 }
+
+TEST(CurvedAlignmentTest, BatchEvaluationMatchesScalar) {
+    CurvedAlignment curve(Point2D(1318880.456219, 6249137.604699), -1251.8997660, 5.73, 499.9848217);
+
+    std::vector<double> stations;
+    for (int i = 0; i <= 1000; ++i) {
+        stations.push_back(curve.Length() * i / 1000.0);
+    }
+    std::vector<Point2D> points(stations.size());
+    std::vector<Vector2D> normals(stations.size());
+    std::vector<double> curvatures(stations.size());
+
+    curve.Point(stations, points);
+    curve.Normal(stations, normals);
+    curve.Curvature(stations, curvatures);
+
+    // Le chemin par lots doit reproduire le chemin unitaire au bit près
+    for (std::size_t i = 0; i < stations.size(); ++i) {
+        EXPECT_EQ(points[i], curve.Point(stations[i]));
+        EXPECT_EQ(normals[i], curve.Normal(stations[i]));
+        EXPECT_EQ(curvatures[i], curve.Curvature(stations[i]));
+    }
+}
+
+TEST(CurvedAlignmentTest, Bounds) {
+    // Demi-cercle parcouru dans le sens horaire de π/4 à -3π/4 : extrêmes atteints aux angles 0 et -π/2
+    Point2D center(100.0, 100.0);
+    CurvedAlignment curve(center, 50.0, -1.0, M_PI / 4.0, 50.0 * M_PI);
+    BoundingBox box = curve.Bounds();
+    EXPECT_DOUBLE_EQ(box.MaxX, 150.0);
+    EXPECT_DOUBLE_EQ(box.MinY, 50.0);
+    EXPECT_NEAR(box.MinX, 100.0 - 50.0 * std::sqrt(0.5), 1e-9);
+    EXPECT_NEAR(box.MaxY, 100.0 + 50.0 * std::sqrt(0.5), 1e-9);
+
+    // Plus d'un tour : cercle complet
+    CurvedAlignment loop(center, 50.0, 1.0, 0.3, 50.0 * 7.0);
+    box = loop.Bounds();
+    EXPECT_DOUBLE_EQ(box.MinX, 50.0);
+    EXPECT_DOUBLE_EQ(box.MinY, 50.0);
+    EXPECT_DOUBLE_EQ(box.MaxX, 150.0);
+    EXPECT_DOUBLE_EQ(box.MaxY, 150.0);
+}
+
+TEST(CurvedAlignmentTest, PointCountLargeThrow) {
+    // Flèche supérieure au rayon : le demi-angle est limité au quart de cercle
+    CurvedAlignment curve(Point2D(0.0, 0.0), 10.0, 1.0, 0.0, 5.0 * M_PI);
+    for (double maxThrow : {10.0, 25.0, 1E6}) {
+        const std::size_t count = curve.PointCount(maxThrow);
+        EXPECT_EQ(count, 2u) << maxThrow;
+        std::vector<Point2D> points(count);
+        curve.Points(maxThrow, points);
+        EXPECT_NEAR(points.back().Y, 10.0, 1e-9);
+    }
+    EXPECT_THROW(curve.PointCount(0.0), std::runtime_error);
+    EXPECT_THROW(curve.PointCount(-1.0), std::runtime_error);
+}
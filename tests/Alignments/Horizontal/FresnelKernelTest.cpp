@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+#include "LineaCore/Geometry/Alignments/Horizontal/FresnelKernel.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+using namespace LineaCore::Geometry::Alignments::Horizontal;
+
+namespace {
+
+// Référence haute précision : quadrature de Gauss-Legendre composite (5 points) en long double
+void ReferencePoint(long double t, long double& x, long double& y) {
+    static const long double nodes[5] = {
+        0.0L,
+        -0.5384693101056830910363144L, 0.5384693101056830910363144L,
+        -0.9061798459386639927976269L, 0.9061798459386639927976269L
+    };
+    static const long double weights[5] = {
+        0.5688888888888888888888889L,
+        0.4786286704993664680412915L, 0.4786286704993664680412915L,
+        0.2369268850561890875142640L, 0.2369268850561890875142640L
+    };
+    const int panels = 1000;
+    const long double h = t / panels;
+    x = 0.0L;
+    y = 0.0L;
+    for (int i = 0; i < panels; ++i) {
+        const long double mid = (i + 0.5L) * h;
+        for (int k = 0; k < 5; ++k) {
+            const long double u = mid + nodes[k] * h / 2.0L;
+            x += weights[k] * std::cos(u * u / 2.0L) * h / 2.0L;
+            y += weights[k] * std::sin(u * u / 2.0L) * h / 2.0L;
+        }
+    }
+}
+
+// Erreur maximale tolérée sur la clotoïde unitaire selon la plage d'abscisses
+double MaxError(double t) {
+    double absT = std::fabs(t);
+    if (absT <= 2.0) {
+        return 1e-13;
+    }
+    if (absT <= 3.0) {
+        return 1e-6;
+    }
+    return 1e-3;
+}
+
+std::vector<double> SampleAbscissas(double tMax, int count) {
+    std::vector<double> t;
+    for (int i = 0; i <= count; ++i) {
+        t.push_back(-tMax + 2.0 * tMax * i / count);
+    }
+    return t;
+}
+
+} // namespace
+
+TEST(FresnelKernelTest, ScalarAccuracyAgainstReference) {
+    for (double t : SampleAbscissas(10.0, 401)) {
+        double x, y;
+        FresnelKernel::Evaluate(t, x, y);
+        long double rx, ry;
+        ReferencePoint(t, rx, ry);
+        EXPECT_NEAR(x, static_cast<double>(rx), MaxError(t)) << "t = " << t;
+        EXPECT_NEAR(y, static_cast<double>(ry), MaxError(t)) << "t = " << t;
+    }
+}
+
+TEST(FresnelKernelTest, OddSymmetry) {
+    for (double t : {0.01, 0.3, 1.0, 2.5, 3.6, 7.0}) {
+        double xp, yp, xm, ym;
+        FresnelKernel::Evaluate(t, xp, yp);
+        FresnelKernel::Evaluate(-t, xm, ym);
+        EXPECT_EQ(xp, -xm);
+        EXPECT_EQ(yp, -ym);
+    }
+}
+
+TEST(FresnelKernelTest, VectorImplementationsMatchScalar) {
+    // Taille impaire pour couvrir le traitement de fin de tableau
+    std::vector<double> t = SampleAbscissas(8.0, 1000);
+    t.push_back(0.123);
+    t.push_back(4.5);
+
+    std::vector<double> xs(t.size()), ys(t.size());
+    FresnelKernel::Evaluate(FresnelKernel::Implementation::Scalar, t, xs, ys);
+
+    for (auto implementation : {FresnelKernel::Implementation::AVX2, FresnelKernel::Implementation::AVX512}) {
+        if (!FresnelKernel::IsSupported(implementation)) {
+            continue;
+        }
+        std::vector<double> xv(t.size()), yv(t.size());
+        FresnelKernel::Evaluate(implementation, t, xv, yv);
+        for (std::size_t i = 0; i < t.size(); ++i) {
+            // Seul l'arrondi diffère (FMA) : écart relatif à l'échelle des termes de la série
+            double tolerance = 1e-15 * std::exp(std::min(t[i] * t[i], 4.0 * 3.1416) / 2.0);
+            EXPECT_NEAR(xv[i], xs[i], tolerance) << "t = " << t[i];
+            EXPECT_NEAR(yv[i], ys[i], tolerance) << "t = " << t[i];
+        }
+    }
+}
+
+TEST(FresnelKernelTest, ActiveImplementationIsSupported) {
+    EXPECT_TRUE(FresnelKernel::IsSupported(FresnelKernel::Implementation::Scalar));
+    EXPECT_TRUE(FresnelKernel::IsSupported(FresnelKernel::ActiveImplementation()));
+}
+
+TEST(FresnelKernelTest, SizeMismatch) {
+    std::vector<double> t(5, 0.5), x(5), y(4);
+    EXPECT_THROW(FresnelKernel::Evaluate(t, x, y), std::runtime_error);
+}
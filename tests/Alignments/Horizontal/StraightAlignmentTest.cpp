@@ -4,8 +4,10 @@
 #include <gtest/gtest.h>
 #include <fstream>
 #include <sstream>
+#include <vector>
 
 using namespace LineaCore::Geometry::Alignments::Horizontal;
+using namespace LineaCore::Geometry;
 
 TEST(StraightAlignmentTest, ReadWriteLandXML) {
     // Chemin vers le fichier d'exemple
@@ -67,3 +69,42 @@ TEST(StraightAlignmentTest, ReadWriteLandXML) {
     EXPECT_NE(outputContent.find("1319630.077000"), std::string::npos);
     EXPECT_NE(outputContent.find("6248132.874953"), std::string::npos);
 }
+
+TEST(StraightAlignmentTest, BatchEvaluationMatchesScalar) {
+    StraightAlignment line(Point2D(1320073.617574, 6248433.993484), Vector2D(-443.540574, -301.118531));
+
+    std::vector<double> stations;
+    for (int i = 0; i <= 1000; ++i) {
+        stations.push_back(line.Length() * i / 1000.0);
+    }
+    std::vector<Point2D> points(stations.size());
+    std::vector<Vector2D> normals(stations.size());
+    std::vector<double> curvatures(stations.size());
+
+    line.Point(stations, points);
+    line.Normal(stations, normals);
+    line.Curvature(stations, curvatures);
+
+    // Le chemin par lots doit reproduire le chemin unitaire au bit près
+    for (std::size_t i = 0; i < stations.size(); ++i) {
+        EXPECT_EQ(points[i], line.Point(stations[i]));
+        EXPECT_EQ(normals[i], line.Normal(stations[i]));
+        EXPECT_EQ(curvatures[i], line.Curvature(stations[i]));
+    }
+}
+
+TEST(StraightAlignmentTest, BatchEvaluationSizeMismatch) {
+    StraightAlignment line(Point2D(0.0, 0.0), Vector2D(10.0, 0.0));
+    std::vector<double> stations = {0.0, 5.0, 10.0};
+    std::vector<Point2D> points(2);
+    EXPECT_THROW(line.Point(stations, points), std::runtime_error);
+}
+
+TEST(StraightAlignmentTest, Bounds) {
+    StraightAlignment line(Point2D(0.0, 0.0), Vector2D(-3.0, 4.0));
+    BoundingBox box = line.Bounds();
+    EXPECT_DOUBLE_EQ(box.MinX, -3.0);
+    EXPECT_DOUBLE_EQ(box.MinY, 0.0);
+    EXPECT_DOUBLE_EQ(box.MaxX, 0.0);
+    EXPECT_DOUBLE_EQ(box.MaxY, 4.0);
+}
@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+#include "LineaCore/Geometry/Alignments/OffsetCurves.hpp"
+#include "LineaCore/Geometry/Alignments/Horizontal/CurvedAlignment.hpp"
+#include "LineaCore/LandXML/LandXMLAlignmentLoader.hpp"
+#include "ExampleFiles.hpp"
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace LineaCore::Geometry::Alignments;
+using namespace LineaCore::Geometry::Alignments::Horizontal;
+using namespace LineaCore::Geometry;
+using namespace LineaCore::Tests;
+
+namespace {
+
+// Arc à gauche (R = 250, centre à l'origine) puis arc à droite (R = 120, centre (-500, 200))
+Alignment TwoArcs() {
+    Alignment alignment("Test", 100.0);
+    alignment.AddElement(std::make_unique<CurvedAlignment>(Point2D(0.0, 0.0), 250.0, 1.0, 0.3, 300.0));
+    alignment.AddElement(std::make_unique<CurvedAlignment>(Point2D(-500.0, 200.0), 120.0, -1.0, 2.0, 200.0));
+    return alignment;
+}
+
+// Vérifie la flèche des segments dont les deux extrémités sont sur le cercle (centre, rayon)
+std::size_t ExpectChordErrors(const std::vector<Point2D>& polyline, const Point2D& centre, double radius, double maxThrow) {
+    std::size_t count = 0;
+    double largest = 0.0;
+    for (std::size_t j = 0; j + 1 < polyline.size(); ++j) {
+        if (std::fabs((polyline[j] - centre).Length() - radius) > 1e-8 || std::fabs((polyline[j + 1] - centre).Length() - radius) > 1e-8) {
+            continue;
+        }
+        const Point2D middle((polyline[j].X + polyline[j + 1].X) / 2.0, (polyline[j].Y + polyline[j + 1].Y) / 2.0);
+        const double error = radius - (middle - centre).Length();
+        EXPECT_LE(error, maxThrow) << j;
+        largest = std::max(largest, error);
+        ++count;
+    }
+    EXPECT_GT(largest, maxThrow / 4.0);
+    return count;
+}
+
+} // namespace
+
+TEST(OffsetCurvesTest, PointsMatchScalarEvaluation) {
+    for (const char* fileName : {"TAE_Centre_01_01.xml", "v1.xml"}) {
+        std::vector<Alignment> alignments = LineaCore::LandXML::LandXMLAlignmentLoader::ReadFile(ExamplesDir + "/" + fileName, 1);
+        Alignment& alignment = alignments.front();
+        ASSERT_TRUE(alignment.TryEnableApproximants(1e-7));
+
+        std::mt19937 generator(7);
+        std::uniform_real_distribution<double> distribution(alignment.StaStart() - 5.0, alignment.StaEnd() + 5.0);
+        std::vector<double> stations(2000);
+        for (double& s : stations) {
+            s = distribution(generator);
+        }
+        std::sort(stations.begin(), stations.begin() + 1000);
+
+        const std::vector<double> offsets{-2.5, -0.7175, 0.0, 0.7175, 2.5};
+        const std::vector<std::vector<Point2D>> curves = OffsetCurves(alignment, offsets).Points(stations);
+        ASSERT_EQ(curves.size(), offsets.size());
+        for (std::size_t k = 0; k < offsets.size(); ++k) {
+            ASSERT_EQ(curves[k].size(), stations.size());
+            for (std::size_t j = 0; j < stations.size(); ++j) {
+                const double s = stations[j];
+                const double side = alignment.Element(alignment.ElementIndex(s)).NormalSide();
+                const Point2D expected = alignment.Point(s) + alignment.Normal(s) * (side * offsets[k]);
+                EXPECT_LE((curves[k][j] - expected).Length(), 1e-6) << fileName << " " << s;
+            }
+        }
+    }
+}
+
+TEST(OffsetCurvesTest, ExternalChainage) {
+    const Alignment alignment = ReadFirstAlignment("v1.xml");
+    ASSERT_EQ(alignment.StationEquations().EquationCount(), 1u);
+    const StationEquation& equation = alignment.StationEquations().Equations()[0];
+
+    std::vector<double> external;
+    for (double station = equation.StaInternal - 500.0; station <= equation.StaAhead + 500.0; station += 2.1) {
+        if (station < equation.StaInternal || station >= equation.StaAhead) {
+            external.push_back(station);
+        }
+    }
+    std::vector<double> internal(external.size());
+    alignment.StationEquations().InternalStations(external, internal);
+
+    OffsetCurves curves(alignment, {-1.5, 2.0});
+    const std::vector<std::vector<Point2D>> reference = curves.Points(internal);
+    curves.SetInputStationType(StationType::External);
+    EXPECT_EQ(curves.Points(external), reference);
+    const std::vector<double> missing{0.5 * (equation.StaInternal + equation.StaAhead)};
+    EXPECT_THROW(curves.Points(missing), std::runtime_error);
+}
+
+TEST(OffsetCurvesTest, PositiveOffsetsAreOnTheRight) {
+    const Alignment alignment = TwoArcs();
+    const OffsetCurves curves(alignment, {1.5});
+    for (const double s : {150.0, 300.0, 450.0, 550.0}) {
+        const std::vector<double> stations{s};
+        const Point2D offsetPoint = curves.Points(stations)[0][0];
+        const Vector2D tangent = alignment.Point(s + 1e-4) - alignment.Point(s - 1e-4);
+        const Vector2D towardOffset = offsetPoint - alignment.Point(s);
+        // Produit vectoriel tangente × décalage négatif : décalage à droite
+        EXPECT_LT(tangent.X * towardOffset.Y - tangent.Y * towardOffset.X, 0.0) << s;
+        EXPECT_NEAR(towardOffset.Length(), 1.5, 1e-9) << s;
+    }
+}
+
+TEST(OffsetCurvesTest, TessellationChordErrorPerOffset) {
+    const Alignment alignment = TwoArcs();
+    const std::vector<double> offsets{-3.0, 3.0, 3.0};
+    const std::vector<double> maxThrows{1e-3, 1e-3, 1e-2};
+    const OffsetCurves curves(alignment, offsets);
+    const std::vector<std::vector<Point2D>> polylines = curves.Tessellate(maxThrows);
+    ASSERT_EQ(polylines.size(), offsets.size());
+
+    for (std::size_t k = 0; k < offsets.size(); ++k) {
+        // Décalage à droite : extérieur de l'arc à gauche, intérieur de l'arc à droite
+        EXPECT_GT(ExpectChordErrors(polylines[k], Point2D(0.0, 0.0), 250.0 + offsets[k], maxThrows[k]), 0u) << k;
+        EXPECT_GT(ExpectChordErrors(polylines[k], Point2D(-500.0, 200.0), 120.0 - offsets[k], maxThrows[k]), 0u) << k;
+
+        const std::vector<double> ends{alignment.StaStart(), alignment.StaEnd()};
+        const std::vector<std::vector<Point2D>> expected = OffsetCurves(alignment, {offsets[k]}).Points(ends);
+        EXPECT_LE((polylines[k].front() - expected[0][0]).Length(), 1e-9);
+        EXPECT_LE((polylines[k].back() - expected[0][1]).Length(), 1e-9);
+    }
+    // Une flèche plus grande demande moins de sommets
+    EXPECT_LT(polylines[2].size(), polylines[1].size());
+
+    std::vector<double> tooFew{1e-3};
+    EXPECT_THROW(curves.Tessellate(tooFew), std::runtime_error);
+    EXPECT_THROW(curves.Tessellate(0.0), std::runtime_error);
+    EXPECT_THROW(OffsetCurves(alignment, {-300.0}).Tessellate(1e-3), std::runtime_error);
+}
+
+TEST(OffsetCurvesTest, InvalidArguments) {
+    const Alignment alignment = TwoArcs();
+    const std::vector<double> stations{200.0, 300.0};
+    std::vector<Point2D> output(stations.size());
+    std::vector<Point2D> tooShort(1);
+    const OffsetCurves curves(alignment, {1.0});
+
+    const std::vector<std::span<Point2D>> wrongCount{output, output};
+    EXPECT_THROW(curves.Points(stations, wrongCount), std::runtime_error);
+    const std::vector<std::span<Point2D>> wrongSize{tooShort};
+    EXPECT_THROW(curves.Points(stations, wrongSize), std::runtime_error);
+    EXPECT_THROW(OffsetCurves(alignment, {std::nan("")}), std::runtime_error);
+    EXPECT_THROW(OffsetCurves(Alignment(), {1.0}).Points(stations), std::runtime_error);
+}
@@ -0,0 +1,199 @@
+#include <gtest/gtest.h>
+#include "LineaCore/Geometry/Alignments/PackedAlignmentFile.hpp"
+#include "ExampleFiles.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace LineaCore::Geometry::Alignments;
+using namespace LineaCore::Geometry;
+using namespace LineaCore::Tests;
+
+namespace {
+
+// Répertoire temporaire propre à chaque test
+class PackedAlignmentFileTest : public ::testing::Test {
+protected:
+    std::filesystem::path _directory;
+
+    void SetUp() override {
+        _directory = std::filesystem::temp_directory_path() /
+                     ("LineaCorePackedAlignmentFileTest_" + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()));
+        std::filesystem::remove_all(_directory);
+        std::filesystem::create_directories(_directory);
+    }
+
+    void TearDown() override {
+        std::error_code error;
+        std::filesystem::remove_all(_directory, error);
+    }
+
+    std::string Path(const std::string& name) const {
+        return (_directory / name).string();
+    }
+
+    std::string CopyExample(const std::string& name) const {
+        std::filesystem::copy_file(ExamplesDir + "/" + name, _directory / name);
+        return Path(name);
+    }
+};
+
+// Modifie les octets d'un fichier à une position donnée
+void Patch(const std::string& fileName, std::streamoff position, const std::string& bytes) {
+    std::fstream stream(fileName, std::ios::binary | std::ios::in | std::ios::out);
+    stream.seekp(position);
+    stream.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+}
+
+} // namespace
+
+TEST_F(PackedAlignmentFileTest, LoadOrBuildMatchesAlignment) {
+    const std::string xml = CopyExample("TAE_Centre_01_01.xml");
+    Alignment alignment = ReadFirstAlignment(xml);
+
+    bool rebuilt = false;
+    PackedAlignmentFile file = PackedAlignmentFile::LoadOrBuild(xml, Path("TAE.lcal"), &rebuilt);
+    EXPECT_TRUE(rebuilt);
+    ASSERT_EQ(file.AlignmentCount(), 1u);
+    EXPECT_EQ(file.Name(0), alignment.Name());
+    EXPECT_EQ(file.SourceHash(), PackedAlignmentFile::HashFile(xml));
+
+    const PackedAlignmentView& view = file.View(0);
+    ASSERT_EQ(view.ElementCount(), alignment.ElementCount());
+    EXPECT_DOUBLE_EQ(view.StaStart(), alignment.StaStart());
+    EXPECT_DOUBLE_EQ(view.StaEnd(), alignment.StaEnd());
+    for (double station = alignment.StaStart(); station < alignment.StaEnd(); station += 7.3) {
+        EXPECT_LT((view.Point(station) - alignment.Point(station)).Length(), 1e-9) << station;
+    }
+
+    // Deuxième ouverture : le cache est réutilisé tel quel
+    PackedAlignmentFile warm = PackedAlignmentFile::LoadOrBuild(xml, Path("TAE.lcal"), &rebuilt);
+    EXPECT_FALSE(rebuilt);
+    const double station = alignment.StaStart() + 1234.5;
+    EXPECT_EQ(warm.View(0).Point(station), view.Point(station));
+}
+
+TEST_F(PackedAlignmentFileTest, SeveralAlignments) {
+    const std::string xml = CopyExample("M3C_TRACE_PROFIL_REFERENCE_v01.01.xml");
+    PackedAlignmentFile file = PackedAlignmentFile::LoadOrBuild(xml, Path("M3C.lcal"));
+    ASSERT_EQ(file.AlignmentCount(), 2u);
+    for (std::size_t i = 0; i < file.AlignmentCount(); ++i) {
+        EXPECT_FALSE(file.Name(i).empty());
+        EXPECT_GT(file.View(i).ElementCount(), 0u);
+    }
+
+    // Déplacement : les vues restent valides
+    PackedAlignmentFile moved = std::move(file);
+    EXPECT_GT(moved.View(1).Length(), 0.0);
+}
+
+TEST_F(PackedAlignmentFileTest, StaleCacheIsRebuilt) {
+    const std::string xml = CopyExample("TAE_Centre_01_01.xml");
+    const std::string cache = Path("TAE.lcal");
+    PackedAlignmentFile::LoadOrBuild(xml, cache);
+
+    std::unique_ptr<PackedAlignmentFile> file;
+    EXPECT_TRUE(PackedAlignmentFile::TryOpen(cache, PackedAlignmentFile::HashFile(xml), file));
+    ASSERT_NE(file, nullptr);
+    EXPECT_FALSE(PackedAlignmentFile::TryOpen(cache, PackedAlignmentFile::HashFile(xml) + 1, file));
+    EXPECT_EQ(file, nullptr);
+    EXPECT_FALSE(PackedAlignmentFile::TryOpen(Path("Missing.lcal"), 0, file));
+
+    // Modification de la source : l'empreinte change
+    std::ofstream(xml, std::ios::app) << "\n<!-- modifié -->\n";
+    bool rebuilt = false;
+    PackedAlignmentFile::LoadOrBuild(xml, cache, &rebuilt);
+    EXPECT_TRUE(rebuilt);
+}
+
+TEST_F(PackedAlignmentFileTest, WriteAndOpen) {
+    PackedAlignment packed("Test", 100.0);
+    packed.AddLine(PackedLine{0.0, 0.0, 1.0, 0.0, 50.0});
+    packed.AddArc(PackedArc{50.0, 100.0, 100.0, 1.0, -1.5707963267948966, 25.0});
+    std::vector<PackedAlignment> alignments;
+    alignments.push_back(std::move(packed));
+    PackedAlignmentFile::Write(Path("Test.lcal"), alignments, 42);
+
+    PackedAlignmentFile file(Path("Test.lcal"));
+    EXPECT_EQ(file.SourceHash(), 42u);
+    ASSERT_EQ(file.AlignmentCount(), 1u);
+    EXPECT_EQ(file.Name(0), "Test");
+    EXPECT_EQ(file.View(0).Lines().size(), 1u);
+    EXPECT_EQ(file.View(0).Arcs().size(), 1u);
+    EXPECT_DOUBLE_EQ(file.View(0).StaEnd(), 175.0);
+    EXPECT_EQ(file.View(0).Point(120.0), alignments[0].View().Point(120.0));
+    EXPECT_EQ(file.View(0).Point(160.0), alignments[0].View().Point(160.0));
+    EXPECT_THROW(file.View(1), std::out_of_range);
+}
+
+TEST_F(PackedAlignmentFileTest, WriteLeavesNoTemporaryFile) {
+    PackedAlignment packed("Test", 0.0);
+    packed.AddLine(PackedLine{0.0, 0.0, 1.0, 0.0, 50.0});
+    std::vector<PackedAlignment> alignments;
+    alignments.push_back(std::move(packed));
+
+    // Écrivains concurrents du même cache : chacun a son fichier temporaire, le dernier renommage l'emporte
+    std::vector<std::thread> writers;
+    for (int k = 0; k < 8; ++k) {
+        writers.emplace_back([&] { PackedAlignmentFile::Write(Path("Test.lcal"), alignments, 42); });
+    }
+    for (std::thread& writer : writers) {
+        writer.join();
+    }
+    EXPECT_EQ(PackedAlignmentFile(Path("Test.lcal")).AlignmentCount(), 1u);
+
+    // Échec du renommage : la cible est un répertoire non vide
+    std::filesystem::create_directories(_directory / "Blocked.lcal" / "Content");
+    EXPECT_THROW(PackedAlignmentFile::Write(Path("Blocked.lcal"), alignments, 42), std::runtime_error);
+
+    std::vector<std::string> names;
+    for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(_directory)) {
+        names.push_back(entry.path().filename().string());
+    }
+    std::sort(names.begin(), names.end());
+    EXPECT_EQ(names, (std::vector<std::string>{"Blocked.lcal", "Test.lcal"}));
+}
+
+TEST_F(PackedAlignmentFileTest, InvalidFiles) {
+    PackedAlignment packed("Test", 0.0);
+    packed.AddLine(PackedLine{0.0, 0.0, 1.0, 0.0, 50.0});
+    std::vector<PackedAlignment> alignments;
+    alignments.push_back(std::move(packed));
+    const std::string reference = Path("Reference.lcal");
+    PackedAlignmentFile::Write(reference, alignments, 1);
+
+    auto copy = [&](const std::string& name) {
+        std::filesystem::copy_file(reference, Path(name));
+        return Path(name);
+    };
+
+    EXPECT_THROW(PackedAlignmentFile(Path("Missing.lcal")), std::runtime_error);
+
+    const std::string empty = Path("Empty.lcal");
+    std::ofstream(empty).close();
+    EXPECT_THROW(PackedAlignmentFile{empty}, std::runtime_error);
+
+    const std::string magic = copy("Magic.lcal");
+    Patch(magic, 0, "X");
+    EXPECT_THROW(PackedAlignmentFile{magic}, std::runtime_error);
+
+    const std::string version = copy("Version.lcal");
+    Patch(version, 8, std::string("\x63\0\0\0", 4));
+    EXPECT_THROW(PackedAlignmentFile{version}, std::runtime_error);
+
+    const std::string endian = copy("Endian.lcal");
+    Patch(endian, 12, std::string("\x01\x02\x03\x04", 4));
+    EXPECT_THROW(PackedAlignmentFile{endian}, std::runtime_error);
+
+    const std::string truncated = copy("Truncated.lcal");
+    std::filesystem::resize_file(truncated, std::filesystem::file_size(truncated) - 8);
+    EXPECT_THROW(PackedAlignmentFile{truncated}, std::runtime_error);
+
+    std::unique_ptr<PackedAlignmentFile> file;
+    EXPECT_FALSE(PackedAlignmentFile::TryOpen(truncated, 1, file));
+    EXPECT_TRUE(PackedAlignmentFile::TryOpen(reference, 1, file));
+}
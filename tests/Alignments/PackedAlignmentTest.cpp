@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include "LineaCore/Geometry/Alignments/PackedAlignment.hpp"
+#include "LineaCore/Geometry/Alignments/Horizontal/StraightAlignment.hpp"
+#include "LineaCore/Geometry/Alignments/Horizontal/CurvedAlignment.hpp"
+#include "LineaCore/Geometry/Alignments/Horizontal/ClotoideTransition.hpp"
+#include "ExampleFiles.hpp"
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace LineaCore::Geometry::Alignments;
+using namespace LineaCore::Geometry::Alignments::Horizontal;
+using namespace LineaCore::Geometry;
+using namespace LineaCore::Tests;
+
+namespace {
+
+Alignment MakeMixedAlignment() {
+    Alignment alignment("Mixed", 100.0);
+    alignment.AddElement(std::make_unique<StraightAlignment>(Point2D(0.0, 0.0), Vector2D(100.0, 0.0)));
+    alignment.AddElement(std::make_unique<ClotoideTransition>(50.0, 0.0, 25.0, Vector2D(1.0, 0.0), Vector2D(100.0, 0.0)));
+    alignment.AddElement(std::make_unique<CurvedAlignment>(Point2D(100.0, 100.0), -100.0, 0.5, 40.0));
+    return alignment;
+}
+
+} // namespace
+
+TEST(PackedAlignmentTest, LayoutIsCompact) {
+    EXPECT_EQ(sizeof(PackedLine), 5 * sizeof(double));
+    EXPECT_EQ(sizeof(PackedArc), 6 * sizeof(double));
+    EXPECT_EQ(sizeof(PackedClothoid), 64u);
+    EXPECT_EQ(sizeof(PackedElementRef), 8u);
+    EXPECT_LT(sizeof(PackedLine), sizeof(StraightAlignment));
+    EXPECT_LT(sizeof(PackedArc), sizeof(CurvedAlignment));
+    EXPECT_LT(sizeof(PackedClothoid), sizeof(ClotoideTransition));
+}
+
+TEST(PackedAlignmentTest, ScalarEvaluationMatchesAlignment) {
+    Alignment alignment = MakeMixedAlignment();
+    PackedAlignment packed = PackedAlignment::FromAlignment(alignment);
+    PackedAlignmentView view = packed.View();
+
+    ASSERT_EQ(view.ElementCount(), 3u);
+    EXPECT_EQ(view.StaStart(), alignment.StaStart());
+    EXPECT_EQ(view.StaEnd(), alignment.StaEnd());
+    EXPECT_EQ(view.Lines().size(), 1u);
+    EXPECT_EQ(view.Arcs().size(), 1u);
+    EXPECT_EQ(view.Clothoids().size(), 1u);
+
+    for (double station = 90.0; station <= 275.0; station += 0.37) {
+        EXPECT_EQ(view.ElementIndex(station), alignment.ElementIndex(station)) << station;
+        EXPECT_EQ(view.Point(station), alignment.Point(station)) << station;
+        EXPECT_EQ(view.Normal(station).X, alignment.Normal(station).X) << station;
+        EXPECT_EQ(view.Normal(station).Y, alignment.Normal(station).Y) << station;
+        EXPECT_EQ(view.Curvature(station), alignment.Curvature(station)) << station;
+    }
+}
+
+TEST(PackedAlignmentTest, BatchEvaluationOnExampleAlignment) {
+    Alignment alignment = ReadFirstAlignment("TAE_Centre_01_01.xml");
+    PackedAlignment packed = PackedAlignment::FromAlignment(alignment);
+    PackedAlignmentView view = packed.View();
+    ASSERT_EQ(view.ElementCount(), alignment.ElementCount());
+    EXPECT_LT(packed.MemoryUsage(), alignment.ElementCount() * (sizeof(ClotoideTransition) + sizeof(double)));
+
+    // Stations croissantes débordant aux deux extrémités, puis mélangées
+    std::vector<double> stations;
+    for (double station = alignment.StaStart() - 5.0; station <= alignment.StaEnd() + 5.0; station += 0.5) {
+        stations.push_back(station);
+    }
+    std::mt19937 generator(7);
+    std::vector<double> shuffled = stations;
+    std::shuffle(shuffled.begin(), shuffled.end(), generator);
+
+    for (const std::vector<double>* input : {&stations, &shuffled}) {
+        std::vector<Point2D> points(input->size());
+        std::vector<Vector2D> normals(input->size());
+        std::vector<double> curvatures(input->size());
+        view.Point(*input, points);
+        view.Normal(*input, normals);
+        view.Curvature(*input, curvatures);
+        for (std::size_t i = 0; i < input->size(); ++i) {
+            const double station = (*input)[i];
+            const Point2D expected = alignment.Point(station);
+            // Les clotoïdes passent par le noyau de Fresnel vectoriel : écart d'arrondi seulement
+            EXPECT_NEAR(points[i].X, expected.X, 1e-8) << station;
+            EXPECT_NEAR(points[i].Y, expected.Y, 1e-8) << station;
+            EXPECT_EQ(normals[i].X, alignment.Normal(station).X) << station;
+            EXPECT_EQ(normals[i].Y, alignment.Normal(station).Y) << station;
+            EXPECT_EQ(curvatures[i], alignment.Curvature(station)) << station;
+        }
+    }
+}
+
+TEST(PackedAlignmentTest, RoundTripToAlignment) {
+    Alignment alignment = MakeMixedAlignment();
+    Alignment rebuilt = PackedAlignment::FromAlignment(alignment).ToAlignment();
+
+    ASSERT_EQ(rebuilt.ElementCount(), alignment.ElementCount());
+    EXPECT_EQ(rebuilt.Name(), alignment.Name());
+    for (std::size_t i = 0; i < alignment.ElementCount(); ++i) {
+        EXPECT_EQ(rebuilt.Element(i).Type(), alignment.Element(i).Type());
+        EXPECT_EQ(rebuilt.ElementStation(i), alignment.ElementStation(i));
+    }
+    for (double station = 100.0; station <= 265.0; station += 1.1) {
+        EXPECT_NEAR(rebuilt.Point(station).X, alignment.Point(station).X, 1e-12) << station;
+        EXPECT_NEAR(rebuilt.Point(station).Y, alignment.Point(station).Y, 1e-12) << station;
+    }
+}
+
+TEST(PackedAlignmentTest, Errors) {
+    PackedAlignment empty("Empty", 0.0);
+    EXPECT_THROW(empty.View().ElementIndex(0.0), std::runtime_error);
+
+    std::vector<double> stations = {0.0, 10.0};
+    std::vector<PackedElementRef> elements = {{PackedElementRef::Kind::Arc, 0}};
+    EXPECT_THROW(PackedAlignmentView(stations, elements, {}, {}, {}), std::runtime_error);
+
+    PackedAlignment packed = PackedAlignment::FromAlignment(MakeMixedAlignment());
+    PackedAlignmentView view = packed.View();
+    std::vector<double> s(3, 120.0);
+    std::vector<Point2D> points(2);
+    EXPECT_THROW(view.Point(s, points), std::runtime_error);
+}
@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+#include "LineaCore/Geometry/Alignments/SegmentIntersector.hpp"
+#include "LineaCore/Geometry/Alignments/Horizontal/ClotoideTransition.hpp"
+#include "LineaCore/Geometry/Alignments/Horizontal/CurvedAlignment.hpp"
+#include "LineaCore/Geometry/Alignments/Horizontal/StraightAlignment.hpp"
+#include "LineaCore/LandXML/LandXMLAlignmentLoader.hpp"
+#include "ExampleFiles.hpp"
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace LineaCore::Geometry::Alignments;
+using namespace LineaCore::Geometry::Alignments::Horizontal;
+using namespace LineaCore::Geometry;
+using namespace LineaCore::Tests;
+
+namespace {
+
+// Le croisement est sur l'axe et sur son segment
+void ExpectOnBoth(const Alignment& alignment, const SegmentIntersector& intersector, const std::vector<std::vector<Point2D>>& polylines,
+                  const SegmentCrossing& crossing) {
+    ASSERT_LT(crossing.Polyline, intersector.PolylineCount());
+    const Point2D& a = polylines[crossing.Polyline][crossing.Segment];
+    const Point2D& b = polylines[crossing.Polyline][crossing.Segment + 1];
+    EXPECT_LE((alignment.Point(crossing.Station) - crossing.Point).Length(), 1e-7) << crossing.Station;
+    EXPECT_LE((a + (b - a) * crossing.Parameter - crossing.Point).Length(), 1e-7) << crossing.Station;
+    EXPECT_GE(crossing.Parameter, 0.0);
+    EXPECT_LE(crossing.Parameter, 1.0);
+}
+
+} // namespace
+
+TEST(SegmentIntersectorTest, LineArcAndClothoid) {
+    Alignment alignment("Test", 10.0);
+    alignment.AddElement(std::make_unique<StraightAlignment>(Point2D(0.0, 0.0), Vector2D(1.0, 0.0), 100.0));
+    alignment.AddElement(std::make_unique<ClotoideTransition>(50.0, 0.0, 25.0, Vector2D(1.0, 0.0), Vector2D(100.0, 0.0)));
+    alignment.AddElement(std::make_unique<CurvedAlignment>(Point2D(0.0, 200.0), 50.0, 1.0, -M_PI / 2.0, 50.0 * M_PI));
+
+    const std::vector<std::vector<Point2D>> polylines{
+        {Point2D(20.0, -5.0), Point2D(20.0, 5.0)},                          // Droite, perpendiculaire
+        {Point2D(110.0, -10.0), Point2D(125.0, 10.0)},                      // Clotoïde
+        {Point2D(-100.0, 200.0), Point2D(100.0, 200.0)},                    // Diamètre du cercle, un seul croisement sur l'arc
+        {Point2D(40.0, 10.0), Point2D(50.0, 0.0), Point2D(60.0, 10.0)},     // Sommet sur l'axe, reporté une fois
+        {Point2D(0.0, 30.0), Point2D(90.0, 30.0)}};                         // Aucun croisement
+    const SegmentIntersector intersector(polylines);
+    EXPECT_EQ(intersector.PolylineCount(), polylines.size());
+    EXPECT_EQ(intersector.SegmentCount(), 6u);
+
+    const std::vector<SegmentCrossing> crossings = intersector.Intersect(alignment, 0.01, 1);
+    ASSERT_EQ(crossings.size(), 4u);
+    EXPECT_NEAR(crossings[0].Station, 30.0, 1e-12);
+    EXPECT_NEAR(crossings[0].Angle, M_PI / 2.0, 1e-12);
+    EXPECT_EQ(crossings[1].Polyline, 3u);
+    EXPECT_NEAR(crossings[1].Station, 60.0, 1e-12);
+    EXPECT_NEAR(std::fabs(crossings[1].Angle), M_PI / 4.0, 1e-12);
+    EXPECT_EQ(crossings[2].Polyline, 1u);
+    EXPECT_EQ(crossings[3].Polyline, 2u);
+    EXPECT_NEAR(crossings[3].Point.X, 50.0, 1e-9);
+    EXPECT_NEAR(crossings[3].Point.Y, 200.0, 1e-9);
+    for (const SegmentCrossing& crossing : crossings) {
+        ExpectOnBoth(alignment, intersector, polylines, crossing);
+    }
+}
+
+TEST(SegmentIntersectorTest, RandomSegmentsAgainstTessellation) {
+    const std::vector<Alignment> alignments = LineaCore::LandXML::LandXMLAlignmentLoader::ReadFile(ExamplesDir + "/TAE_Centre_01_01.xml", 1);
+    const Alignment& alignment = alignments.front();
+
+    // Segments aléatoires au voisinage de l'axe
+    std::mt19937 generator(11);
+    std::uniform_real_distribution<double> station(alignment.StaStart(), alignment.StaEnd());
+    std::uniform_real_distribution<double> offset(-60.0, 60.0);
+    std::vector<std::vector<Point2D>> polylines(2000);
+    for (std::vector<Point2D>& polyline : polylines) {
+        const Point2D centre = alignment.Point(station(generator));
+        polyline = {centre + Vector2D(offset(generator), offset(generator)), centre + Vector2D(offset(generator), offset(generator))};
+    }
+    const SegmentIntersector intersector(polylines);
+    const std::vector<SegmentCrossing> crossings = intersector.Intersect(alignment, 0.01, 1);
+    ASSERT_GT(crossings.size(), 100u);
+    for (std::size_t k = 0; k < crossings.size(); ++k) {
+        ExpectOnBoth(alignment, intersector, polylines, crossings[k]);
+        if (k > 0) {
+            EXPECT_LE(crossings[k - 1].Station, crossings[k].Station);
+        }
+    }
+
+    // Nombre de croisements de la discrétisation fine de l'axe avec chaque segment
+    const std::vector<Point2D> vertices = alignment.Points(1e-4, 1);
+    std::size_t expected = 0;
+    for (const std::vector<Point2D>& polyline : polylines) {
+        const Point2D& a = polyline[0];
+        const Vector2D d = polyline[1] - a;
+        for (std::size_t k = 0; k + 1 < vertices.size(); ++k) {
+            const Vector2D e = vertices[k + 1] - vertices[k];
+            const double det = d / e;
+            if (det == 0.0) {
+                continue;
+            }
+            const double t = ((vertices[k] - a) / e) / det;
+            const double u = ((vertices[k] - a) / d) / det;
+            if (t >= 0.0 && t < 1.0 && u >= 0.0 && u < 1.0) {
+                ++expected;
+            }
+        }
+    }
+    EXPECT_EQ(crossings.size(), expected);
+
+    // Résultats indépendants du nombre de threads
+    const std::vector<SegmentCrossing> parallel = intersector.Intersect(alignment, 0.01, 4);
+    ASSERT_EQ(parallel.size(), crossings.size());
+    for (std::size_t k = 0; k < crossings.size(); ++k) {
+        EXPECT_EQ(parallel[k].Station, crossings[k].Station);
+        EXPECT_EQ(parallel[k].Polyline, crossings[k].Polyline);
+    }
+}
+
+TEST(SegmentIntersectorTest, ShortSegmentsNearClothoidOrigin) {
+    // Segments courts de part et d'autre de la courbe, là où le pas angulaire constant de
+    // ClotoideTransition::Points s'écarte le plus de la clotoïde
+    Alignment alignment("Test", 0.0);
+    alignment.AddElement(std::make_unique<ClotoideTransition>(50.0, 0.0, 25.0, Vector2D(1.0, 0.0), Vector2D(0.0, 0.0)));
+    const HorizontalAlignment& clotoide = alignment.Element(0);
+
+    std::vector<Point2D> starts, ends;
+    for (int i = 1; i <= 200; ++i) {
+        const double s = 25.0 * i / 201.0;
+        const Point2D p = clotoide.Point(s);
+        const Vector2D n = clotoide.Normal(s) * 0.02;
+        starts.push_back(p - n);
+        ends.push_back(p + n);
+    }
+    const SegmentIntersector intersector(starts, ends);
+    const std::vector<SegmentCrossing> crossings = intersector.Intersect(alignment, 0.1, 1);
+    ASSERT_EQ(crossings.size(), starts.size());
+    for (std::size_t i = 0; i < crossings.size(); ++i) {
+        EXPECT_EQ(crossings[i].Polyline, i);
+        EXPECT_NEAR(crossings[i].Station, 25.0 * (i + 1) / 201.0, 1e-9);
+    }
+}
+
+TEST(SegmentIntersectorTest, IsolatedSegmentsAndErrors) {
+    Alignment alignment("Test", 0.0);
+    alignment.AddElement(std::make_unique<StraightAlignment>(Point2D(0.0, 0.0), Vector2D(1.0, 0.0), 100.0));
+    const std::vector<Point2D> starts{Point2D(10.0, -1.0), Point2D(20.0, 1.0), Point2D(30.0, 0.0)};
+    const std::vector<Point2D> ends{Point2D(10.0, 1.0), Point2D(20.0, 0.0), Point2D(30.0, 0.0)};
+    const SegmentIntersector intersector(starts, ends);
+    EXPECT_EQ(intersector.PolylineCount(), 3u);
+
+    // Le segment qui finit sur l'axe le croise ; le segment dégénéré est ignoré
+    const std::vector<SegmentCrossing> crossings = intersector.Intersect(alignment);
+    ASSERT_EQ(crossings.size(), 2u);
+    EXPECT_EQ(crossings[0].Polyline, 0u);
+    EXPECT_EQ(crossings[1].Polyline, 1u);
+    EXPECT_DOUBLE_EQ(crossings[1].Parameter, 1.0);
+    EXPECT_NEAR(crossings[1].Angle, -M_PI / 2.0, 1e-12);
+
+    EXPECT_THROW(intersector.Intersect(alignment, 0.0), std::runtime_error);
+    EXPECT_THROW(intersector.Intersect(alignment, std::numeric_limits<double>::infinity()), std::runtime_error);
+    EXPECT_THROW(SegmentIntersector(starts, std::vector<Point2D>(1)), std::runtime_error);
+    EXPECT_TRUE(SegmentIntersector(std::vector<std::vector<Point2D>>{}).Intersect(alignment).empty());
+}
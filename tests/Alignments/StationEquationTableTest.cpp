@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+#include "LineaCore/Geometry/Alignments/StationEquationTable.hpp"
+#include "LineaCore/Geometry/Alignments/Alignment.hpp"
+#include "ExampleFiles.hpp"
+#include <libxml/xmlreader.h>
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace LineaCore::Geometry::Alignments;
+using namespace LineaCore::Tests;
+
+namespace {
+
+// Saut vers l'avant à 1000 (1000 → 1200), puis recul à 2000 (2200 → 2150)
+StationEquationTable MakeTable() {
+    return StationEquationTable({
+        {1000.0, 1000.0, 1200.0},
+        {2000.0, 2200.0, 2150.0},
+    });
+}
+
+} // namespace
+
+TEST(StationEquationTableTest, Empty) {
+    const StationEquationTable table;
+    EXPECT_EQ(table.EquationCount(), 0u);
+    EXPECT_TRUE(table.IsIncreasing());
+    EXPECT_DOUBLE_EQ(table.ExternalStation(123.5), 123.5);
+    EXPECT_DOUBLE_EQ(table.InternalStation(123.5), 123.5);
+}
+
+TEST(StationEquationTableTest, Conversions) {
+    const StationEquationTable table = MakeTable();
+    EXPECT_FALSE(table.IsIncreasing());
+    EXPECT_EQ(table.Zone(500.0), 0u);
+    EXPECT_EQ(table.Zone(1000.0), 1u);
+    EXPECT_EQ(table.Zone(2500.0), 2u);
+
+    EXPECT_DOUBLE_EQ(table.ExternalStation(500.0), 500.0);
+    EXPECT_DOUBLE_EQ(table.ExternalStation(1000.0), 1200.0);
+    EXPECT_DOUBLE_EQ(table.ExternalStation(1500.0), 1700.0);
+    EXPECT_DOUBLE_EQ(table.ExternalStation(2000.0), 2150.0);
+    EXPECT_DOUBLE_EQ(table.ExternalStation(2500.0), 2650.0);
+
+    EXPECT_DOUBLE_EQ(table.InternalStation(500.0), 500.0);
+    EXPECT_DOUBLE_EQ(table.InternalStation(1700.0), 1500.0);
+    EXPECT_DOUBLE_EQ(table.InternalStation(2650.0), 2500.0);
+    // Chaînage présent deux fois : la première zone est retenue
+    EXPECT_DOUBLE_EQ(table.InternalStation(2175.0), 1975.0);
+    // Saut vers l'avant : chaînage inexistant
+    EXPECT_THROW(table.InternalStation(1100.0), std::runtime_error);
+
+    // Deux équations à la même station interne
+    EXPECT_THROW(StationEquationTable({{1000.0, 1000.0, 1200.0}, {1000.0, 1200.0, 1300.0}}), std::runtime_error);
+}
+
+TEST(StationEquationTableTest, UnorderedEquations) {
+    // Équations dans l'ordre inverse de l'axe : triées par station interne
+    const StationEquationTable reference = MakeTable();
+    const StationEquationTable table({{2000.0, 2200.0, 2150.0}, {1000.0, 1000.0, 1200.0}});
+    ASSERT_EQ(table.EquationCount(), 2u);
+    EXPECT_DOUBLE_EQ(table.Equations()[0].StaInternal, 1000.0);
+    EXPECT_DOUBLE_EQ(table.Equations()[1].StaInternal, 2000.0);
+    for (double station : {500.0, 1000.0, 1500.0, 2000.0, 2500.0}) {
+        EXPECT_DOUBLE_EQ(table.ExternalStation(station), reference.ExternalStation(station)) << station;
+    }
+    EXPECT_DOUBLE_EQ(table.InternalStation(2175.0), 1975.0);
+    EXPECT_DOUBLE_EQ(table.StaBackDeviation(0), 0.0);
+    EXPECT_DOUBLE_EQ(table.StaBackDeviation(1), 0.0);
+}
+
+TEST(StationEquationTableTest, StaBackDeviation) {
+    // StaBack incohérent avec la zone précédente (2200 attendu) : conservé, les conversions utilisent StaAhead
+    const StationEquationTable table({{1000.0, 1000.0, 1200.0}, {2000.0, 2000.0, 2150.0}});
+    EXPECT_DOUBLE_EQ(table.StaBackDeviation(0), 0.0);
+    EXPECT_DOUBLE_EQ(table.StaBackDeviation(1), -200.0);
+    EXPECT_DOUBLE_EQ(table.ExternalStation(2500.0), 2650.0);
+    EXPECT_THROW(table.StaBackDeviation(2), std::out_of_range);
+}
+
+TEST(StationEquationTableTest, BatchMatchesScalar) {
+    std::vector<StationEquation> equations;
+    for (int k = 1; k <= 40; ++k) {
+        equations.push_back({1000.0 * k, 1000.0 * k + 10.0 * (k - 1), 1000.0 * k + 10.0 * k});
+    }
+    for (const std::size_t count : {std::size_t(2), std::size_t(16), std::size_t(40)}) {
+        const StationEquationTable table(std::vector<StationEquation>(equations.begin(), equations.begin() + count));
+        ASSERT_TRUE(table.IsIncreasing());
+
+        std::mt19937 generator(static_cast<unsigned>(count));
+        std::uniform_real_distribution<double> distribution(0.0, 1000.0 * (count + 1));
+        std::vector<double> internal(1000);
+        for (double& s : internal) {
+            s = distribution(generator);
+        }
+        internal.push_back(1000.0);   // Station d'une équation
+        // Stations triées : parcours des zones par le curseur
+        std::vector<double> sorted = internal;
+        std::sort(sorted.begin(), sorted.end());
+        internal.insert(internal.end(), sorted.begin(), sorted.end());
+
+        std::vector<double> external(internal.size()), back(internal.size());
+        table.ExternalStations(internal, external);
+        for (std::size_t i = 0; i < internal.size(); ++i) {
+            ASSERT_EQ(external[i], table.ExternalStation(internal[i])) << count << " " << internal[i];
+        }
+
+        // Stations externes hors des sauts
+        for (std::size_t i = 0; i < external.size(); ++i) {
+            const double zoneStart = table.Zone(internal[i]) == 0 ? 0.0 : equations[table.Zone(internal[i]) - 1].StaAhead;
+            external[i] = std::max(external[i], zoneStart);
+        }
+        table.InternalStations(external, back);
+        for (std::size_t i = 0; i < external.size(); ++i) {
+            ASSERT_EQ(back[i], table.InternalStation(external[i])) << count << " " << external[i];
+        }
+
+        // Conversion en place
+        std::vector<double> inPlace = internal;
+        table.ExternalStations(inPlace, inPlace);
+        for (std::size_t i = 0; i < internal.size(); ++i) {
+            ASSERT_EQ(inPlace[i], table.ExternalStation(internal[i]));
+        }
+
+        std::vector<double> missing = {500.0, 1005.0};
+        EXPECT_THROW(table.InternalStations(missing, missing), std::runtime_error);
+    }
+}
+
+TEST(StationEquationTableTest, ExampleFile) {
+    xmlTextReaderPtr reader = xmlReaderForFile((ExamplesDir + "/v1.xml").c_str(), nullptr, 0);
+    ASSERT_NE(reader, nullptr);
+    Alignment alignment;
+    while (xmlTextReaderRead(reader) == 1) {
+        if (xmlTextReaderNodeType(reader) == XML_READER_TYPE_ELEMENT &&
+            std::strcmp(reinterpret_cast<const char*>(xmlTextReaderConstLocalName(reader)), "Alignment") == 0) {
+            alignment.ReadLandXML(reader);
+            break;
+        }
+    }
+    xmlFreeTextReader(reader);
+
+    ASSERT_EQ(alignment.StationEquations().EquationCount(), 1u);
+    const StationEquation& equation = alignment.StationEquations().Equations()[0];
+    EXPECT_DOUBLE_EQ(equation.StaInternal, 481719.6449434);
+    EXPECT_DOUBLE_EQ(equation.StaAhead, 482000.0);
+    EXPECT_DOUBLE_EQ(alignment.ExternalStation(alignment.StaStart()), alignment.StaStart());
+    EXPECT_NEAR(alignment.ExternalStation(481800.0), 482000.0 + 481800.0 - 481719.6449434, 1e-9);
+    EXPECT_NEAR(alignment.InternalStation(482100.0), 481819.6449434, 1e-9);
+    EXPECT_NEAR(alignment.InternalStation(alignment.ExternalStation(alignment.StaEnd())), alignment.StaEnd(), 1e-9);
+}
@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+#include "LineaCore/Geometry/Alignments/TessellationCache.hpp"
+#include "LineaCore/Geometry/Alignments/Horizontal/StraightAlignment.hpp"
+#include "LineaCore/Geometry/Alignments/Horizontal/CurvedAlignment.hpp"
+#include "LineaCore/Geometry/Alignments/Horizontal/ClotoideTransition.hpp"
+#include <algorithm>
+#include <limits>
+#include <cmath>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace LineaCore::Geometry::Alignments;
+using namespace LineaCore::Geometry::Alignments::Horizontal;
+using namespace LineaCore::Geometry;
+
+TEST(TessellationCacheTest, LevelNeverExceedsRequestedThrow) {
+    TessellationCache cache(1u << 20, 0.001);
+    EXPECT_EQ(cache.Level(0.001), 0);
+    EXPECT_EQ(cache.Level(0.002), 1);
+    EXPECT_EQ(cache.Level(0.0039), 1);
+    EXPECT_EQ(cache.Level(0.0005), -1);
+    for (double maxThrow : {1e-6, 3e-4, 0.01, 0.07, 0.1, 2.5}) {
+        const int level = cache.Level(maxThrow);
+        EXPECT_LE(cache.LevelThrow(level), maxThrow);
+        EXPECT_GT(cache.LevelThrow(level + 1), maxThrow);
+    }
+    EXPECT_THROW(cache.Level(0.0), std::runtime_error);
+    EXPECT_THROW(cache.Level(-1.0), std::runtime_error);
+}
+
+TEST(TessellationCacheTest, HitsShareTheSamePolyline) {
+    TessellationCache cache(1u << 20, 0.001);
+    CurvedAlignment curve(Point2D(0.0, 0.0), 500.0, 0.0, 300.0);
+
+    auto first = cache.Points(curve, 0.01);
+    auto second = cache.Points(curve, 0.012);   // Même niveau de détail
+    auto finer = cache.Points(curve, 0.005);
+
+    EXPECT_EQ(first.get(), second.get());
+    EXPECT_NE(first.get(), finer.get());
+    EXPECT_EQ(*first, curve.Points(cache.LevelThrow(cache.Level(0.01))));
+
+    TessellationCache::Statistics statistics = cache.GetStatistics();
+    EXPECT_EQ(statistics.Hits, 1u);
+    EXPECT_EQ(statistics.Misses, 2u);
+    EXPECT_EQ(statistics.Entries, 2u);
+    EXPECT_GT(statistics.Bytes, 0u);
+}
+
+TEST(TessellationCacheTest, ClotoideThrowWithinTolerance) {
+    // La flèche servie est respectée jusqu'à l'origine de la clotoïde, où la courbure est nulle
+    TessellationCache cache(1u << 20, 0.001);
+    ClotoideTransition clotoide(200.0, 0.0, 120.0, Vector2D(1.0, 0.0), Vector2D(0.0, 0.0));
+    for (double maxThrow : {0.1, 0.01, 0.001}) {
+        auto points = cache.Points(clotoide, maxThrow);
+        ASSERT_GE(points->size(), 2u);
+        EXPECT_EQ(points->front(), clotoide.Point(0.0));
+        EXPECT_EQ(points->back(), clotoide.Point(clotoide.Length()));
+
+        // Distance de points denses de la courbe à la polyligne
+        double worst = 0.0;
+        for (int i = 0; i <= 4000; ++i) {
+            const Point2D p = clotoide.Point(clotoide.Length() * i / 4000.0);
+            double distance = std::numeric_limits<double>::infinity();
+            for (std::size_t k = 0; k + 1 < points->size(); ++k) {
+                const Vector2D chord = (*points)[k + 1] - (*points)[k];
+                const double t = std::clamp(((p - (*points)[k]) * chord) / (chord * chord), 0.0, 1.0);
+                distance = std::min(distance, (p - ((*points)[k] + chord * t)).Length());
+            }
+            worst = std::max(worst, distance);
+        }
+        EXPECT_LE(worst, cache.LevelThrow(cache.Level(maxThrow)) * (1.0 + 1e-9)) << maxThrow;
+    }
+}
+
+TEST(TessellationCacheTest, WarmAndInvalidate) {
+    TessellationCache cache(1u << 20, 0.001);
+    Alignment alignment("Warm", 0.0);
+    alignment.AddElement(std::make_unique<StraightAlignment>(Point2D(0.0, 0.0), Vector2D(100.0, 0.0)));
+    alignment.AddElement(std::make_unique<CurvedAlignment>(Point2D(100.0, 500.0), 500.0, -std::acos(-1.0) / 2.0, 200.0));
+
+    cache.Warm(alignment, 0.001, 0.1);   // Niveaux 0 à 6
+    EXPECT_EQ(cache.GetStatistics().Entries, 14u);
+
+    cache.Points(alignment.Element(1), 0.05);
+    EXPECT_EQ(cache.GetStatistics().Hits, 1u);
+
+    cache.Invalidate(alignment.Element(1));
+    EXPECT_EQ(cache.GetStatistics().Entries, 7u);
+    cache.Clear();
+    EXPECT_EQ(cache.GetStatistics().Entries, 0u);
+    EXPECT_EQ(cache.GetStatistics().Bytes, 0u);
+}
+
+TEST(TessellationCacheTest, LeastRecentlyUsedEviction) {
+    CurvedAlignment a(Point2D(0.0, 0.0), 100.0, 0.0, 300.0);
+    CurvedAlignment b(Point2D(0.0, 0.0), 100.0, 1.0, 300.0);
+    CurvedAlignment c(Point2D(0.0, 0.0), 100.0, 2.0, 300.0);
+
+    // Budget suffisant pour deux discrétisations de même taille, pas pour trois
+    TessellationCache probe(1u << 20, 0.001);
+    probe.Points(a, 0.001);
+    const std::size_t entryBytes = probe.GetStatistics().Bytes;
+    TessellationCache cache(2 * entryBytes + entryBytes / 2, 0.001);
+
+    auto keep = cache.Points(a, 0.001);
+    cache.Points(b, 0.001);
+    cache.Points(a, 0.001);   // a devient le plus récent
+    cache.Points(c, 0.001);   // b est évincé
+
+    TessellationCache::Statistics statistics = cache.GetStatistics();
+    EXPECT_EQ(statistics.Evictions, 1u);
+    EXPECT_EQ(statistics.Entries, 2u);
+    EXPECT_LE(statistics.Bytes, 2 * entryBytes + entryBytes / 2);
+
+    cache.Points(a, 0.001);
+    EXPECT_EQ(cache.GetStatistics().Hits, 2u);
+    cache.Points(b, 0.001);
+    EXPECT_EQ(cache.GetStatistics().Misses, 4u);
+
+    // Une polyligne évincée reste valide pour ses détenteurs
+    cache.Clear();
+    EXPECT_EQ(*keep, a.Points(0.001));
+}
+
+TEST(TessellationCacheTest, ConcurrentRequests) {
+    TessellationCache cache(1u << 20, 0.001);
+    std::vector<CurvedAlignment> curves;
+    for (int i = 0; i < 8; ++i) {
+        curves.emplace_back(Point2D(0.0, 0.0), 100.0 + 50.0 * i, 0.0, 250.0);
+    }
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&]() {
+            for (int repeat = 0; repeat < 200; ++repeat) {
+                for (const CurvedAlignment& curve : curves) {
+                    auto points = cache.Points(curve, 0.004);
+                    ASSERT_FALSE(points->empty());
+                }
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    TessellationCache::Statistics statistics = cache.GetStatistics();
+    EXPECT_EQ(statistics.Hits + statistics.Misses, 4u * 200u * 8u);
+    EXPECT_EQ(statistics.Entries, 8u);
+}
@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+#include "LineaCore/Geometry/Alignments/UniformGrid.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace LineaCore::Geometry::Alignments;
+using namespace LineaCore::Geometry;
+
+TEST(UniformGridTest, CandidatesCoverEveryOverlappingBox) {
+    std::mt19937 random(42);
+    std::uniform_real_distribution<double> position(0.0, 1000.0);
+    std::uniform_real_distribution<double> size(0.0, 40.0);
+    std::vector<BoundingBox> boxes(500);
+    for (BoundingBox& box : boxes) {
+        const double x = position(random), y = position(random);
+        box = BoundingBox(x, y, x + size(random), y + size(random));
+    }
+    const UniformGrid grid(boxes, 4);
+    EXPECT_EQ(grid.ItemCount(), boxes.size());
+
+    VisitStamps visited;
+    std::vector<std::uint32_t> candidates;
+    for (int query = 0; query < 200; ++query) {
+        const double x = position(random) - 100.0, y = position(random) - 100.0;
+        const BoundingBox box(x, y, x + 5.0 * size(random), y + 5.0 * size(random));
+        grid.Candidates(box, visited, candidates);
+
+        std::vector<std::uint32_t> sorted = candidates;
+        std::sort(sorted.begin(), sorted.end());
+        EXPECT_EQ(std::adjacent_find(sorted.begin(), sorted.end()), sorted.end()) << "Duplicate candidate";
+        for (std::size_t i = 0; i < boxes.size(); ++i) {
+            if (boxes[i].Intersects(box)) {
+                EXPECT_TRUE(std::binary_search(sorted.begin(), sorted.end(), static_cast<std::uint32_t>(i))) << "Box " << i << ", query " << query;
+            }
+        }
+    }
+}
+
+TEST(UniformGridTest, QueriesOutsideOrEmptyGrid) {
+    const std::vector<BoundingBox> boxes = {BoundingBox(0.0, 0.0, 10.0, 10.0), BoundingBox(20.0, 20.0, 30.0, 30.0)};
+    const UniformGrid grid(boxes, 4);
+    VisitStamps visited;
+    std::vector<std::uint32_t> candidates = {7};
+    grid.Candidates(BoundingBox(100.0, 100.0, 200.0, 200.0), visited, candidates);
+    EXPECT_TRUE(candidates.empty());
+    grid.Candidates(BoundingBox(-1E300, -1E300, 1E300, 1E300), visited, candidates);
+    EXPECT_EQ(candidates.size(), 2u);
+
+    const UniformGrid empty;
+    EXPECT_EQ(empty.Columns() * empty.Rows(), 1u);
+    empty.Candidates(BoundingBox(-1.0, -1.0, 1.0, 1.0), visited, candidates);
+    EXPECT_TRUE(candidates.empty());
+}
@@ -0,0 +1,223 @@
+#include <gtest/gtest.h>
+#include "LineaCore/Geometry/Alignments/Vertical/VerticalAlignment.hpp"
+#include "LineaCore/Geometry/Alignments/Alignment.hpp"
+#include "LineaCore/LandXML/LandXMLAlignmentLoader.hpp"
+#include "ExampleFiles.hpp"
+#include <libxml/xmlreader.h>
+#include <libxml/xmlwriter.h>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace LineaCore::Geometry::Alignments;
+using namespace LineaCore::Geometry::Alignments::Vertical;
+using namespace LineaCore::LandXML;
+using namespace LineaCore::Tests;
+
+namespace {
+
+using CurveType = VerticalPVI::CurveType;
+
+// Profil 0 → 1000 : pente 2 %, parabole de 200 m en 300 (-1 %), cercle de 5000 m en 700 (+1,5 %)
+VerticalAlignment MakeProfile() {
+    return VerticalAlignment("Test", {
+        {0.0, 100.0},
+        {300.0, 106.0, CurveType::Parabola, 200.0},
+        {700.0, 102.0, CurveType::Circle, 0.0, 5000.0},
+        {1000.0, 106.5},
+    });
+}
+
+VerticalAlignment ReadProfile(const std::string& xml) {
+    xmlTextReaderPtr reader = xmlReaderForMemory(xml.data(), static_cast<int>(xml.size()), nullptr, nullptr, 0);
+    VerticalAlignment profile;
+    try {
+        while (xmlTextReaderRead(reader) == 1) {
+            if (xmlTextReaderNodeType(reader) == XML_READER_TYPE_ELEMENT &&
+                std::strcmp(reinterpret_cast<const char*>(xmlTextReaderConstLocalName(reader)), "ProfAlign") == 0) {
+                profile.ReadLandXML(reader);
+                break;
+            }
+        }
+    } catch (...) {
+        xmlFreeTextReader(reader);
+        throw;
+    }
+    xmlFreeTextReader(reader);
+    return profile;
+}
+
+} // namespace
+
+TEST(VerticalAlignmentTest, Tangents) {
+    const VerticalAlignment profile = MakeProfile();
+    EXPECT_EQ(profile.Name(), "Test");
+    EXPECT_DOUBLE_EQ(profile.StaStart(), 0.0);
+    EXPECT_DOUBLE_EQ(profile.StaEnd(), 1000.0);
+
+    EXPECT_NEAR(profile.Elevation(100.0), 102.0, 1e-12);
+    EXPECT_NEAR(profile.Grade(100.0), 0.02, 1e-15);
+    EXPECT_DOUBLE_EQ(profile.VerticalCurvature(100.0), 0.0);
+    EXPECT_NEAR(profile.Elevation(500.0), 104.0, 1e-12);
+    EXPECT_NEAR(profile.Grade(500.0), -0.01, 1e-15);
+
+    // Prolongement des pentes extrêmes
+    EXPECT_NEAR(profile.Elevation(-100.0), 98.0, 1e-12);
+    EXPECT_NEAR(profile.Elevation(1100.0), 108.0, 1e-12);
+}
+
+TEST(VerticalAlignmentTest, Parabola) {
+    const VerticalAlignment profile = MakeProfile();
+    // Flèche au PVI : (g2 - g1)·L / 8
+    EXPECT_NEAR(profile.Elevation(300.0), 106.0 - 0.03 * 200.0 / 8.0, 1e-12);
+    EXPECT_NEAR(profile.Grade(300.0), 0.005, 1e-15);
+    EXPECT_NEAR(profile.Grade(250.0), 0.0125, 1e-15);
+    const double c = -0.03 / 200.0;
+    EXPECT_NEAR(profile.VerticalCurvature(300.0), c / std::pow(1.0 + 0.005 * 0.005, 1.5), 1e-15);
+    EXPECT_LT(profile.VerticalCurvature(300.0), 0.0);   // Point haut
+}
+
+TEST(VerticalAlignmentTest, Circle) {
+    const VerticalAlignment profile = MakeProfile();
+    const double theta1 = std::atan(-0.01), theta2 = std::atan(0.015);
+    const double tangentLength = 5000.0 * std::tan((theta2 - theta1) / 2.0);
+    const double begin = 700.0 - tangentLength * std::cos(theta1);
+    const double end = 700.0 + tangentLength * std::cos(theta2);
+    EXPECT_NEAR(profile.PVIs()[2].Length, end - begin, 1e-9);
+
+    // Point bas : la courbure vaut 1 / R, le point le plus bas a une pente nulle
+    EXPECT_NEAR(profile.VerticalCurvature(700.0), 1.0 / 5000.0, 1e-15);
+    const double lowest = begin + 5000.0 * std::sin(-theta1);
+    EXPECT_NEAR(profile.Grade(lowest), 0.0, 1e-12);
+
+    // Distance au centre constante
+    const double centerStation = lowest;
+    const double centerElevation = profile.Elevation(lowest) + 5000.0;
+    for (double s = begin; s <= end; s += 10.0) {
+        const double ds = s - centerStation, dz = profile.Elevation(s) - centerElevation;
+        EXPECT_NEAR(std::sqrt(ds * ds + dz * dz), 5000.0, 1e-7) << s;
+    }
+}
+
+TEST(VerticalAlignmentTest, Continuity) {
+    const VerticalAlignment profile = MakeProfile();
+    const std::span<const double> stations = profile.SegmentStations();
+    ASSERT_EQ(profile.SegmentCount(), 5u);
+    ASSERT_EQ(stations.size(), 6u);
+    for (std::size_t i = 1; i + 1 < stations.size(); ++i) {
+        const double s = stations[i];
+        EXPECT_EQ(profile.SegmentIndex(s), i);
+        EXPECT_NEAR(profile.Elevation(s - 1e-9), profile.Elevation(s), 1e-8) << s;
+        EXPECT_NEAR(profile.Grade(s - 1e-9), profile.Grade(s), 1e-9) << s;
+    }
+}
+
+TEST(VerticalAlignmentTest, BatchMatchesScalar) {
+    const VerticalAlignment profile = MakeProfile();
+    std::vector<double> stations;
+    for (double s = -50.0; s <= 1050.0; s += 0.5) {
+        stations.push_back(s);
+    }
+    // Stations non triées à la fin du lot
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<double> distribution(-50.0, 1050.0);
+    for (int i = 0; i < 500; ++i) {
+        stations.push_back(distribution(generator));
+    }
+
+    std::vector<double> elevations(stations.size()), grades(stations.size()), curvatures(stations.size());
+    profile.Elevation(stations, elevations);
+    profile.Grade(stations, grades);
+    profile.VerticalCurvature(stations, curvatures);
+    for (std::size_t i = 0; i < stations.size(); ++i) {
+        EXPECT_DOUBLE_EQ(elevations[i], profile.Elevation(stations[i])) << stations[i];
+        EXPECT_DOUBLE_EQ(grades[i], profile.Grade(stations[i])) << stations[i];
+        EXPECT_DOUBLE_EQ(curvatures[i], profile.VerticalCurvature(stations[i])) << stations[i];
+    }
+
+    std::vector<double> tooShort(3);
+    EXPECT_THROW(profile.Elevation(stations, tooShort), std::runtime_error);
+}
+
+TEST(VerticalAlignmentTest, InvalidProfiles) {
+    EXPECT_THROW(VerticalAlignment("A", {{0.0, 0.0}}), std::runtime_error);
+    EXPECT_THROW(VerticalAlignment("A", {{0.0, 0.0}, {0.0, 1.0}}), std::runtime_error);
+    EXPECT_THROW(VerticalAlignment("A", {{0.0, 0.0, CurveType::Parabola, 10.0}, {100.0, 1.0}}), std::runtime_error);
+    EXPECT_THROW(VerticalAlignment("A", {
+        {0.0, 0.0},
+        {100.0, 2.0, CurveType::Parabola, 120.0},
+        {150.0, 0.0, CurveType::Parabola, 120.0},
+        {300.0, 1.0},
+    }), std::runtime_error);
+    EXPECT_THROW(VerticalAlignment().Elevation(0.0), std::runtime_error);
+}
+
+TEST(VerticalAlignmentTest, ReadWriteLandXML) {
+    const VerticalAlignment profile = ReadProfile(
+        "<ProfAlign name=\"P\">"
+        "<PVI>0 100</PVI>"
+        "<ParaCurve length=\"200\">300 106</ParaCurve>"
+        "<CircCurve radius=\"-5000\" length=\"125\">700 102</CircCurve>"
+        "<Feature><Property label=\"a\" value=\"b\"/></Feature>"
+        "<PVI>1000 106.5</PVI>"
+        "</ProfAlign>");
+    const VerticalAlignment expected = MakeProfile();
+    ASSERT_EQ(profile.PVIs().size(), 4u);
+    for (double s = 0.0; s <= 1000.0; s += 25.0) {
+        EXPECT_DOUBLE_EQ(profile.Elevation(s), expected.Elevation(s)) << s;
+    }
+
+    xmlBufferPtr buffer = xmlBufferCreate();
+    xmlTextWriterPtr writer = xmlNewTextWriterMemory(buffer, 0);
+    profile.WriteLandXML(writer);
+    xmlFreeTextWriter(writer);
+    const std::string xml(reinterpret_cast<const char*>(xmlBufferContent(buffer)));
+    xmlBufferFree(buffer);
+    EXPECT_NE(xml.find("radius=\"-5000\""), std::string::npos) << xml;
+
+    const VerticalAlignment reread = ReadProfile(xml);
+    EXPECT_EQ(reread.Name(), "P");
+    for (double s = 0.0; s <= 1000.0; s += 25.0) {
+        EXPECT_NEAR(reread.Elevation(s), profile.Elevation(s), 1e-9) << s;
+    }
+
+    EXPECT_THROW(ReadProfile("<ProfAlign name=\"P\"><PVI>0 0</PVI><UnsymParaCurve lengthIn=\"1\" lengthOut=\"2\">5 1</UnsymParaCurve><PVI>10 0</PVI></ProfAlign>"),
+                 std::runtime_error);
+}
+
+TEST(VerticalAlignmentTest, ExampleFiles) {
+    for (const char* fileName : {"TAE_Centre_01_01.xml", "v1.xml", "M3C_TRACE_PROFIL_REFERENCE_v01.01.xml"}) {
+        const std::vector<Alignment> alignments = LandXMLAlignmentLoader::ReadFile(ExamplesDir + "/" + fileName, 1);
+        ASSERT_FALSE(alignments.empty()) << fileName;
+        std::size_t profileCount = 0;
+        for (const Alignment& alignment : alignments) {
+            for (std::size_t p = 0; p < alignment.ProfileCount(); ++p) {
+                const VerticalAlignment& profile = alignment.Profile(p);
+                ++profileCount;
+                // Les PVI sans raccordement sont sur le profil
+                for (const VerticalPVI& pvi : profile.PVIs()) {
+                    if (pvi.Curve == CurveType::None) {
+                        EXPECT_NEAR(profile.Elevation(pvi.Station), pvi.Elevation, 1e-9) << fileName;
+                    }
+                }
+                for (std::size_t i = 1; i + 1 < profile.SegmentStations().size(); ++i) {
+                    const double s = profile.SegmentStations()[i];
+                    EXPECT_NEAR(profile.Elevation(s - 1e-7), profile.Elevation(s), 1e-6) << fileName << " " << s;
+                }
+            }
+        }
+        EXPECT_GT(profileCount, 0u) << fileName;
+    }
+
+    // Longueurs des raccordements circulaires de v1.xml : projection horizontale
+    const std::vector<Alignment> alignments = LandXMLAlignmentLoader::ReadFile(ExamplesDir + "/v1.xml", 1);
+    ASSERT_EQ(alignments.front().ProfileCount(), 1u);
+    const VerticalAlignment& profile = alignments.front().Profile(0);
+    EXPECT_EQ(profile.Name(), "PL_V1_00");
+    EXPECT_EQ(profile.PVIs()[2].Curve, CurveType::Circle);
+    EXPECT_NEAR(profile.PVIs()[2].Length, 89.2635625, 1e-3);
+    EXPECT_GT(profile.VerticalCurvature(profile.PVIs()[2].Station), 0.0);
+}
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include "LineaCore/Geometry/Alignments/ViewportTessellator.hpp"
+#include "LineaCore/Geometry/Alignments/AlignmentProjector.hpp"
+#include "LineaCore/Geometry/Alignments/Horizontal/CurvedAlignment.hpp"
+#include "ExampleFiles.hpp"
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace LineaCore::Geometry::Alignments;
+using namespace LineaCore::Geometry::Alignments::Horizontal;
+using namespace LineaCore::Geometry;
+using namespace LineaCore::Tests;
+
+namespace {
+
+double PolylineLength(const std::vector<Point2D>& points) {
+    double length = 0.0;
+    for (std::size_t i = 0; i + 1 < points.size(); ++i) {
+        length += (points[i + 1] - points[i]).Length();
+    }
+    return length;
+}
+
+} // namespace
+
+TEST(ViewportTessellatorTest, WholeAlignmentIsOneContinuousPolyline) {
+    const Alignment alignment = ReadFirstAlignment("TAE_Centre_01_01.xml");
+    const ViewportTessellator tessellator(alignment);
+    const BoundingBox window = BoundsTree(alignment).Bounds().Inflated(1.0);
+
+    const double pixelSize = 0.2;
+    const std::vector<std::vector<Point2D>> polylines = tessellator.Tessellate(window, pixelSize);
+    ASSERT_EQ(polylines.size(), 1u);
+    const std::vector<Point2D>& points = polylines.front();
+    EXPECT_LE((points.front() - alignment.Point(alignment.StaStart())).Length(), 1e-9);
+    EXPECT_LE((points.back() - alignment.Point(alignment.StaEnd())).Length(), 1e-9);
+
+    // Sommets sur l'axe, milieux des segments à moins de la flèche (0,5 pixel)
+    const AlignmentProjector projector(alignment);
+    const double maxThrow = 0.5 * pixelSize;
+    for (std::size_t i = 0; i + 1 < points.size(); ++i) {
+        const Point2D middle = points[i] + (points[i + 1] - points[i]) * 0.5;
+        EXPECT_LE((middle - alignment.Point(projector.Project(middle).Station)).Length(), maxThrow + 1e-9) << i;
+        EXPECT_GT((points[i + 1] - points[i]).Length(), 0.0) << i;
+    }
+    EXPECT_NEAR(PolylineLength(points), alignment.Length(), 1e-3 * alignment.Length());
+}
+
+TEST(ViewportTessellatorTest, ClippedToWindow) {
+    const Alignment alignment = ReadFirstAlignment("TAE_Centre_01_01.xml");
+    const ViewportTessellator tessellator(alignment);
+    const double pixelSize = 0.05;
+
+    // Fenêtre de 300 m centrée sur un point de l'axe, comparée à la découpe de la discrétisation complète
+    const Point2D centre = alignment.Point(alignment.StaStart() + 0.4 * alignment.Length());
+    const BoundingBox window(centre.X - 150.0, centre.Y - 100.0, centre.X + 150.0, centre.Y + 100.0);
+    const std::vector<std::vector<Point2D>> polylines = tessellator.Tessellate(window, pixelSize);
+    ASSERT_FALSE(polylines.empty());
+
+    double visibleLength = 0.0;
+    for (const std::vector<Point2D>& polyline : polylines) {
+        ASSERT_GE(polyline.size(), 2u);
+        for (const Point2D& p : polyline) {
+            EXPECT_TRUE(window.Inflated(1e-9).Contains(p));
+        }
+        visibleLength += PolylineLength(polyline);
+    }
+
+    double expectedLength = 0.0;
+    const std::vector<Point2D> all = alignment.Points(0.5 * pixelSize, 1);
+    for (std::size_t i = 0; i + 1 < all.size(); ++i) {
+        // Longueur visible de chaque segment, par échantillonnage au centimètre
+        const int sampleCount = static_cast<int>(std::ceil((all[i + 1] - all[i]).Length() / 0.01));
+        const Vector2D step = (all[i + 1] - all[i]) * (1.0 / sampleCount);
+        for (int k = 0; k < sampleCount; ++k) {
+            if (window.Contains(all[i] + step * (k + 0.5))) {
+                expectedLength += step.Length();
+            }
+        }
+    }
+    EXPECT_NEAR(visibleLength, expectedLength, 1e-3 * expectedLength);
+}
+
+TEST(ViewportTessellatorTest, OnlyVisibleVerticesAreProduced) {
+    // Arc de 60 km de rayon 10 km : une fenêtre de 10 m ne voit que quelques segments
+    Alignment alignment("Arc", 0.0);
+    alignment.AddElement(std::make_unique<CurvedAlignment>(Point2D(0.0, 0.0), 10000.0, 1.0, 0.0, 60000.0));
+    const ViewportTessellator tessellator(alignment);
+
+    const double pixelSize = 0.01;   // Flèche de 5 mm : segments d'environ 20 m
+    const BoundingBox window(-5.0, 9995.0, 5.0, 10005.0);
+    const std::vector<std::vector<Point2D>> polylines = tessellator.Tessellate(window, pixelSize);
+    ASSERT_EQ(polylines.size(), 1u);
+    EXPECT_LE(polylines.front().size(), 3u);
+    EXPECT_NEAR(polylines.front().front().X, 5.0, 1e-9);
+    EXPECT_NEAR(polylines.front().back().X, -5.0, 1e-9);
+    for (const Point2D& p : polylines.front()) {
+        EXPECT_NEAR((p - Point2D(0.0, 0.0)).Length(), 10000.0, 0.5 * pixelSize);
+    }
+
+    // Fenêtre à l'intérieur du cercle : aucune polyligne
+    EXPECT_TRUE(tessellator.Tessellate(BoundingBox(-100.0, -100.0, 100.0, 100.0), pixelSize).empty());
+}
+
+TEST(ViewportTessellatorTest, InvalidArguments) {
+    Alignment alignment("Arc", 0.0);
+    alignment.AddElement(std::make_unique<CurvedAlignment>(Point2D(0.0, 0.0), 100.0, 1.0, 0.0, 100.0));
+    const ViewportTessellator tessellator(alignment);
+    const BoundingBox window(-200.0, -200.0, 200.0, 200.0);
+    EXPECT_THROW(tessellator.Tessellate(BoundingBox(), 1.0), std::runtime_error);
+    EXPECT_THROW(tessellator.Tessellate(window, 0.0), std::runtime_error);
+    EXPECT_THROW(tessellator.Tessellate(window, 1.0, -0.5), std::runtime_error);
+    EXPECT_THROW(tessellator.Tessellate(window, std::numeric_limits<double>::infinity()), std::runtime_error);
+    EXPECT_TRUE(ViewportTessellator{Alignment()}.Tessellate(window, 1.0).empty());
+}
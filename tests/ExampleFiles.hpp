@@ -0,0 +1,27 @@
+// ExampleFiles.hpp
+#pragma once
+
+#include "LineaCore/Geometry/Alignments/Alignment.hpp"
+#include "LineaCore/LandXML/LandXMLAlignmentLoader.hpp"
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace LineaCore::Tests {
+
+// Répertoire des fichiers LandXML d'exemple, défini par CMake
+inline const std::string ExamplesDir = LINEACORE_EXAMPLES_DIR;
+
+// Lit le premier <Alignment> d'un fichier LandXML ; un chemin relatif désigne un fichier d'exemple
+inline Geometry::Alignments::Alignment ReadFirstAlignment(const std::string& fileName) {
+    const std::string path = std::filesystem::path(fileName).is_absolute() ? fileName : ExamplesDir + "/" + fileName;
+    std::vector<Geometry::Alignments::Alignment> alignments = LandXML::LandXMLAlignmentLoader::ReadFile(path, 1);
+    if (alignments.empty()) {
+        throw std::runtime_error("No <Alignment> in " + path);
+    }
+    return std::move(alignments.front());
+}
+
+} // namespace LineaCore::Tests
@@ -0,0 +1,48 @@
+#include <gtest/gtest.h>
+#include "LineaCore/Geometry/BoundingBox.hpp"
+#include "LineaCore/Geometry/Point2D.hpp"
+
+using namespace LineaCore::Geometry;
+
+TEST(BoundingBoxTest, DefaultConstructorIsEmpty) {
+    BoundingBox box;
+    EXPECT_TRUE(box.IsEmpty());
+    EXPECT_FALSE(box.Contains(Point2D(0.0, 0.0)));
+    EXPECT_FALSE(box.Intersects(BoundingBox(-1.0, -1.0, 1.0, 1.0)));
+}
+
+TEST(BoundingBoxTest, Extend) {
+    BoundingBox box;
+    box.Extend(Point2D(1.0, 2.0));
+    EXPECT_FALSE(box.IsEmpty());
+    EXPECT_EQ(box.Width(), 0.0);
+    box.Extend(Point2D(-3.0, 5.0));
+    box.Extend(BoundingBox(0.0, -1.0, 2.0, 0.0));
+    EXPECT_EQ(box.MinX, -3.0);
+    EXPECT_EQ(box.MinY, -1.0);
+    EXPECT_EQ(box.MaxX, 2.0);
+    EXPECT_EQ(box.MaxY, 5.0);
+
+    // Une boîte vide ne modifie rien
+    box.Extend(BoundingBox());
+    EXPECT_EQ(box.Width(), 5.0);
+    EXPECT_EQ(box.Height(), 6.0);
+}
+
+TEST(BoundingBoxTest, IntersectsAndContains) {
+    BoundingBox box(0.0, 0.0, 10.0, 5.0);
+    EXPECT_TRUE(box.Contains(Point2D(10.0, 5.0)));
+    EXPECT_FALSE(box.Contains(Point2D(10.1, 5.0)));
+    EXPECT_TRUE(box.Intersects(BoundingBox(10.0, 5.0, 12.0, 6.0)));
+    EXPECT_FALSE(box.Intersects(BoundingBox(10.5, 0.0, 12.0, 6.0)));
+    EXPECT_TRUE(box.Inflated(0.5).Intersects(BoundingBox(10.5, 0.0, 12.0, 6.0)));
+}
+
+TEST(BoundingBoxTest, Distance) {
+    BoundingBox box(0.0, 0.0, 10.0, 5.0);
+    EXPECT_EQ(box.Distance(Point2D(5.0, 2.0)), 0.0);
+    EXPECT_DOUBLE_EQ(box.Distance(Point2D(13.0, 9.0)), 5.0);
+    EXPECT_DOUBLE_EQ(box.Distance(Point2D(-2.0, 3.0)), 2.0);
+    EXPECT_DOUBLE_EQ(box.Distance(BoundingBox(13.0, 9.0, 20.0, 20.0)), 5.0);
+    EXPECT_EQ(box.Distance(BoundingBox(5.0, 4.0, 20.0, 20.0)), 0.0);
+}
@@ -0,0 +1,116 @@
+#include "LineaCore/LandXML/LandXMLAlignmentLoader.hpp"
+#include "ExampleFiles.hpp"
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace LineaCore::LandXML;
+using namespace LineaCore::Geometry::Alignments;
+using namespace LineaCore::Tests;
+
+namespace {
+
+void ExpectSameAlignments(const std::vector<Alignment>& actual, const std::vector<Alignment>& expected) {
+    ASSERT_EQ(actual.size(), expected.size());
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(actual[i].Name(), expected[i].Name());
+        EXPECT_EQ(actual[i].StaStart(), expected[i].StaStart());
+        ASSERT_EQ(actual[i].ElementCount(), expected[i].ElementCount());
+        for (std::size_t j = 0; j < expected[i].ElementCount(); ++j) {
+            EXPECT_EQ(actual[i].ElementStation(j), expected[i].ElementStation(j));
+            EXPECT_EQ(actual[i].Element(j).Type(), expected[i].Element(j).Type());
+            EXPECT_EQ(actual[i].Element(j).getStartingPoint(), expected[i].Element(j).getStartingPoint());
+            EXPECT_EQ(actual[i].Element(j).getEndingPoint(), expected[i].Element(j).getEndingPoint());
+        }
+    }
+}
+
+const char* Document = R"(<?xml version="1.0" encoding="utf-8"?>
+<LandXML xmlns="http://www.landxml.org/schema/LandXML-1.2">
+  <!-- <Alignment name="Commentaire"> -->
+  <Alignments>
+    <Alignment name="A" staStart="0" desc="a > b">
+      <CoordGeom>
+        <Line><Start>0 0</Start><End>0 100</End></Line>
+      </CoordGeom>
+    </Alignment>
+    <![CDATA[ </Alignment> ]]>
+    <Alignment name='B' staStart="10"/>
+    <Alignment name="C" staStart="20">
+      <CoordGeom>
+        <Line><Start>0 100</Start><End>50 100</End></Line>
+        <Line><Start>50 100</Start><End>50 200</End></Line>
+      </CoordGeom>
+    </Alignment>
+  </Alignments>
+</LandXML>
+)";
+
+} // namespace
+
+TEST(LandXMLAlignmentLoaderTest, ParallelMatchesSequential) {
+    for (const char* fileName : {"M3C_TRACE_PROFIL_REFERENCE_v01.01.xml", "Toutes les voies et Surfaces.xml",
+                                 "TAE_Centre_01_01_Test.xml", "TAE_Centre_01_01.xml", "v1.xml"}) {
+        SCOPED_TRACE(fileName);
+        const std::vector<Alignment> sequential = LandXMLAlignmentLoader::ReadFile(ExamplesDir + "/" + fileName, 1);
+        EXPECT_FALSE(sequential.empty());
+        ExpectSameAlignments(LandXMLAlignmentLoader::ReadFile(ExamplesDir + "/" + fileName, 4), sequential);
+    }
+}
+
+TEST(LandXMLAlignmentLoaderTest, FindAlignmentRanges) {
+    const std::string document = Document;
+    std::vector<AlignmentRange> ranges;
+    std::string encoding;
+    ASSERT_TRUE(LandXMLAlignmentLoader::TryFindAlignmentRanges(document, ranges, encoding));
+    EXPECT_EQ(encoding, "utf-8");
+    ASSERT_EQ(ranges.size(), 3u);
+    EXPECT_EQ(document.substr(ranges[0].Begin, 31), "<Alignment name=\"A\" staStart=\"0");
+    EXPECT_EQ(document.substr(ranges[0].End - 12), "</Alignment>" + document.substr(ranges[0].End));
+    EXPECT_EQ(ranges[0].Line, 5);
+    EXPECT_EQ(document.substr(ranges[1].Begin, ranges[1].End - ranges[1].Begin), "<Alignment name='B' staStart=\"10\"/>");
+    EXPECT_EQ(ranges[1].Line, 11);
+    EXPECT_EQ(ranges[2].Line, 12);
+
+    const std::vector<Alignment> alignments = LandXMLAlignmentLoader::ReadMemory(document, 3);
+    ExpectSameAlignments(alignments, LandXMLAlignmentLoader::ReadMemory(document, 1));
+    ASSERT_EQ(alignments.size(), 3u);
+    EXPECT_EQ(alignments[1].Name(), "B");
+    EXPECT_EQ(alignments[2].ElementCount(), 2u);
+}
+
+TEST(LandXMLAlignmentLoaderTest, UnsplittableDocumentsAreReadSequentially) {
+    std::vector<AlignmentRange> ranges;
+    std::string encoding;
+    const std::string prefixed = R"(<lx:LandXML xmlns:lx="x"><lx:Alignment name="A" staStart="0"/><lx:Alignment name="B" staStart="0"/></lx:LandXML>)";
+    EXPECT_FALSE(LandXMLAlignmentLoader::TryFindAlignmentRanges(prefixed, ranges, encoding));
+    EXPECT_EQ(LandXMLAlignmentLoader::ReadMemory(prefixed, 2).size(), 2u);
+
+    const std::string doctype = R"(<!DOCTYPE LandXML><LandXML><Alignment name="A" staStart="0"/><Alignment name="B" staStart="0"/></LandXML>)";
+    EXPECT_FALSE(LandXMLAlignmentLoader::TryFindAlignmentRanges(doctype, ranges, encoding));
+    EXPECT_EQ(LandXMLAlignmentLoader::ReadMemory(doctype, 2).size(), 2u);
+
+    EXPECT_FALSE(LandXMLAlignmentLoader::TryFindAlignmentRanges("<LandXML><Alignment name=\"A\">", ranges, encoding));
+}
+
+TEST(LandXMLAlignmentLoaderTest, Errors) {
+    EXPECT_THROW(LandXMLAlignmentLoader::ReadFile(ExamplesDir + "/Missing.xml"), std::runtime_error);
+
+    // Erreur dans le deuxième axe : même message en lecture séquentielle et parallèle
+    std::string document = Document;
+    document.replace(document.find("<End>50 100</End>"), 17, "<End>50 100</Fin>");
+    std::string sequentialMessage, parallelMessage;
+    try {
+        LandXMLAlignmentLoader::ReadMemory(document, 1);
+    } catch (const std::runtime_error& ex) {
+        sequentialMessage = ex.what();
+    }
+    try {
+        LandXMLAlignmentLoader::ReadMemory(document, 3);
+    } catch (const std::runtime_error& ex) {
+        parallelMessage = ex.what();
+    }
+    EXPECT_EQ(sequentialMessage, "LandXML parse error near line 14");
+    EXPECT_EQ(parallelMessage, sequentialMessage);
+}
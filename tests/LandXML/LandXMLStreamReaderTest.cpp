@@ -0,0 +1,131 @@
+#include "LineaCore/LandXML/LandXMLStreamReader.hpp"
+#include "LineaCore/Geometry/Alignments/Alignment.hpp"
+#include "ExampleFiles.hpp"
+#include <gtest/gtest.h>
+#include <libxml/xmlreader.h>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace LineaCore::LandXML;
+using namespace LineaCore::Geometry::Alignments;
+using namespace LineaCore::Tests;
+
+TEST(LandXMLStreamReaderTest, ElementsMatchAlignmentReader) {
+    Alignment alignment = ReadFirstAlignment("TAE_Centre_01_01.xml");
+
+    std::vector<std::string> events;
+    std::size_t count = 0;
+    LandXMLStreamReader::Callbacks callbacks;
+    callbacks.AlignmentBegin = [&](const StreamedAlignment& a) {
+        events.push_back("begin " + a.Name);
+        EXPECT_DOUBLE_EQ(a.StaStart, alignment.StaStart());
+        EXPECT_NEAR(a.DeclaredLength, 17208.956844189459, 1e-9);
+    };
+    callbacks.Element = [&](StreamedElement&& e) {
+        ASSERT_LT(count, alignment.ElementCount());
+        EXPECT_EQ(e.ElementIndex, count);
+        EXPECT_EQ(e.Alignment->Name, alignment.Name());
+        EXPECT_EQ(e.Station, alignment.ElementStation(count));
+        EXPECT_EQ(e.Element->Type(), alignment.Element(count).Type());
+        EXPECT_EQ(e.Element->getEndingPoint(), alignment.Element(count).getEndingPoint());
+        ++count;
+    };
+    callbacks.AlignmentEnd = [&](const StreamedAlignment& a) { events.push_back("end " + a.Name); };
+
+    LandXMLStreamReader::ReadFile(ExamplesDir + "/TAE_Centre_01_01.xml", callbacks);
+    EXPECT_EQ(count, alignment.ElementCount());
+    ASSERT_EQ(events.size(), 2u);
+    EXPECT_EQ(events[0], "begin " + alignment.Name());
+    EXPECT_EQ(events[1], "end " + alignment.Name());
+}
+
+TEST(LandXMLStreamReaderTest, SeveralAlignments) {
+    std::vector<std::size_t> elementCounts;
+    LandXMLStreamReader::Callbacks callbacks;
+    callbacks.AlignmentBegin = [&](const StreamedAlignment& a) {
+        EXPECT_EQ(a.Index, elementCounts.size());
+        elementCounts.push_back(0);
+    };
+    callbacks.Element = [&](StreamedElement&& e) {
+        EXPECT_EQ(e.Alignment->Index + 1, elementCounts.size());
+        ++elementCounts.back();
+    };
+
+    LandXMLStreamReader::ReadFile(ExamplesDir + "/M3C_TRACE_PROFIL_REFERENCE_v01.01.xml", callbacks);
+    ASSERT_EQ(elementCounts.size(), 2u);
+    EXPECT_GT(elementCounts[0], 0u);
+    EXPECT_GT(elementCounts[1], 0u);
+}
+
+TEST(LandXMLStreamReaderTest, OptionalDeclaredLength) {
+    // Attribut length absent ou vide : NaN, comme pour Alignment::ReadLandXML
+    const char* xml = R"(<LandXML><Alignments>)"
+                      R"(<Alignment name="A" staStart="0"/>)"
+                      R"(<Alignment name="B" staStart="0" length=""/>)"
+                      R"(<Alignment name="C" staStart="0" length="12.5"/>)"
+                      R"(</Alignments></LandXML>)";
+    std::vector<double> lengths;
+    LandXMLStreamReader::Callbacks callbacks;
+    callbacks.AlignmentBegin = [&](const StreamedAlignment& a) { lengths.push_back(a.DeclaredLength); };
+    callbacks.Element = [](StreamedElement&&) {};
+    xmlTextReaderPtr reader = xmlReaderForMemory(xml, static_cast<int>(std::strlen(xml)), nullptr, nullptr, 0);
+    ASSERT_NE(reader, nullptr);
+    LandXMLStreamReader::Read(reader, callbacks);
+    xmlFreeTextReader(reader);
+
+    ASSERT_EQ(lengths.size(), 3u);
+    EXPECT_TRUE(std::isnan(lengths[0]));
+    EXPECT_TRUE(std::isnan(lengths[1]));
+    EXPECT_EQ(lengths[2], 12.5);
+}
+
+TEST(LandXMLStreamReaderTest, BoundedQueue) {
+    std::vector<double> expected;
+    LandXMLStreamReader::Callbacks callbacks;
+    callbacks.Element = [&](StreamedElement&& e) { expected.push_back(e.Station); };
+    LandXMLStreamReader::ReadFile(ExamplesDir + "/TAE_Centre_01_01.xml", callbacks);
+
+    StreamedElementQueue queue(4);
+    std::thread producer = LandXMLStreamReader::ReadFileAsync(ExamplesDir + "/TAE_Centre_01_01.xml", queue);
+    std::vector<double> stations;
+    StreamedElement element;
+    while (queue.Pop(element)) {
+        stations.push_back(element.Station);
+    }
+    producer.join();
+    EXPECT_EQ(stations, expected);
+}
+
+TEST(LandXMLStreamReaderTest, CancelStopsProducer) {
+    StreamedElementQueue queue(2);
+    std::thread producer = LandXMLStreamReader::ReadFileAsync(ExamplesDir + "/TAE_Centre_01_01.xml", queue);
+    StreamedElement element;
+    ASSERT_TRUE(queue.Pop(element));
+    queue.Cancel();
+    producer.join();
+    EXPECT_FALSE(queue.Pop(element));
+}
+
+TEST(LandXMLStreamReaderTest, Errors) {
+    LandXMLStreamReader::Callbacks callbacks;
+    callbacks.Element = [](StreamedElement&&) {};
+    EXPECT_THROW(LandXMLStreamReader::ReadFile(ExamplesDir + "/Missing.xml", callbacks), std::runtime_error);
+
+    const char* malformed = R"(<LandXML><Alignments><Alignment name="A" staStart="0"><CoordGeom></Alignment></LandXML>)";
+    xmlTextReaderPtr reader = xmlReaderForMemory(malformed, static_cast<int>(std::strlen(malformed)), nullptr, nullptr, 0);
+    ASSERT_NE(reader, nullptr);
+    EXPECT_THROW(LandXMLStreamReader::Read(reader, callbacks), std::runtime_error);
+    xmlFreeTextReader(reader);
+
+    // L'erreur du producteur est transmise au consommateur
+    StreamedElementQueue queue(2);
+    std::thread producer = LandXMLStreamReader::ReadFileAsync(ExamplesDir + "/Missing.xml", queue);
+    StreamedElement element;
+    EXPECT_THROW(queue.Pop(element), std::runtime_error);
+    producer.join();
+
+    EXPECT_THROW(StreamedElementQueue(0), std::runtime_error);
+}
@@ -2,8 +2,11 @@
 #include "LineaCore/Geometry/Point2D.hpp"
 #include <gtest/gtest.h>
 #include <libxml/xmlreader.h>
+#include <cmath>
+#include <cstdlib>
 #include <limits>
 #include <cstring>
+#include <utility>
 
 using namespace LineaCore::LandXML;
 using namespace LineaCore::Geometry;
@@ -94,3 +97,115 @@ TEST(XMLUtilsTest, ReadContentAsPoint2D_Invalid) {
 
     xmlFreeTextReader(reader);
 }
+
+TEST(XMLUtilsTest, ReadAttributeAsDouble_Formats) {
+    const char* xml = R"(<TestElement a="+1.5" b="-INF" c="INF" d=" 1e3" e="-0.25" f="1.5 " g="1,5" />)";
+    xmlTextReaderPtr reader = xmlReaderForMemory(xml, strlen(xml), nullptr, nullptr, 0);
+    ASSERT_NE(reader, nullptr);
+
+    xmlTextReaderRead(reader);
+    EXPECT_DOUBLE_EQ(XMLUtils::ReadAttributeAsDouble(reader, "a"), 1.5);
+    EXPECT_EQ(XMLUtils::ReadAttributeAsDouble(reader, "b"), -std::numeric_limits<double>::infinity());
+    EXPECT_EQ(XMLUtils::ReadAttributeAsDouble(reader, "c"), std::numeric_limits<double>::infinity());
+    EXPECT_DOUBLE_EQ(XMLUtils::ReadAttributeAsDouble(reader, "d"), 1000.0);
+    EXPECT_DOUBLE_EQ(XMLUtils::ReadAttributeAsDouble(reader, "e"), -0.25);
+    EXPECT_THROW(XMLUtils::ReadAttributeAsDouble(reader, "f"), std::runtime_error);
+    EXPECT_THROW(XMLUtils::ReadAttributeAsDouble(reader, "g"), std::runtime_error);
+    // Le lecteur reste sur l'élément après la lecture des attributs
+    EXPECT_EQ(xmlTextReaderNodeType(reader), XML_READER_TYPE_ELEMENT);
+    EXPECT_EQ(XMLUtils::ReadAttributeAsString(reader, "a"), "+1.5");
+
+    xmlFreeTextReader(reader);
+}
+
+TEST(XMLUtilsTest, ReadContentAsPoint2D_Formats) {
+    const char* xml = R"(<Root><P> 6248132.874953
+        1319630.077 12.5 </P><Q/><R>12.5</R><S>1.5e1	-2</S></Root>)";
+    xmlTextReaderPtr reader = xmlReaderForMemory(xml, strlen(xml), nullptr, nullptr, 0);
+    ASSERT_NE(reader, nullptr);
+
+    auto moveTo = [reader](const char* name) {
+        while (xmlTextReaderRead(reader) == 1) {
+            if (xmlTextReaderNodeType(reader) == XML_READER_TYPE_ELEMENT &&
+                strcmp(reinterpret_cast<const char*>(xmlTextReaderConstName(reader)), name) == 0) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    // Une troisième valeur (altitude) est ignorée
+    ASSERT_TRUE(moveTo("P"));
+    Point2D point = XMLUtils::ReadContentAsPoint2D(reader, "P");
+    EXPECT_EQ(point.X, 1319630.077);
+    EXPECT_EQ(point.Y, 6248132.874953);
+
+    ASSERT_TRUE(moveTo("Q"));
+    EXPECT_THROW(XMLUtils::ReadContentAsPoint2D(reader, "Q"), std::runtime_error);
+    ASSERT_TRUE(moveTo("R"));
+    EXPECT_THROW(XMLUtils::ReadContentAsPoint2D(reader, "R"), std::runtime_error);
+    ASSERT_TRUE(moveTo("S"));
+    point = XMLUtils::ReadContentAsPoint2D(reader, "S");
+    EXPECT_EQ(point.X, -2.0);
+    EXPECT_EQ(point.Y, 15.0);
+
+    xmlFreeTextReader(reader);
+}
+
+TEST(XMLUtilsTest, ReadContentAsNumbers) {
+    const char* xml = R"(<Root><PVI> 300
+        106.5 </PVI><A>1 2 3</A><B>1</B><C/><D>1 x</D></Root>)";
+    xmlTextReaderPtr reader = xmlReaderForMemory(xml, strlen(xml), nullptr, nullptr, 0);
+    ASSERT_NE(reader, nullptr);
+
+    auto moveTo = [reader](const char* name) {
+        while (xmlTextReaderRead(reader) == 1) {
+            if (xmlTextReaderNodeType(reader) == XML_READER_TYPE_ELEMENT &&
+                strcmp(reinterpret_cast<const char*>(xmlTextReaderConstName(reader)), name) == 0) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    // Valeurs dans l'ordre du document, sans permutation
+    double values[2] = {0.0, 0.0};
+    ASSERT_TRUE(moveTo("PVI"));
+    XMLUtils::ReadContentAsNumbers(reader, "PVI", values);
+    EXPECT_EQ(values[0], 300.0);
+    EXPECT_EQ(values[1], 106.5);
+
+    // Trop ou trop peu de valeurs, contenu absent ou non numérique
+    for (const char* name : {"A", "B", "C", "D"}) {
+        ASSERT_TRUE(moveTo(name));
+        try {
+            XMLUtils::ReadContentAsNumbers(reader, name, values);
+            ADD_FAILURE() << name;
+        } catch (const std::runtime_error& ex) {
+            EXPECT_EQ(std::string(ex.what()).find("Northing"), std::string::npos) << ex.what();
+        }
+    }
+
+    xmlFreeTextReader(reader);
+}
+
+TEST(XMLUtilsTest, ParseNumber_OutOfRange) {
+    // Hors des limites des doubles : ±infini ou zéro signé, comme strtod
+    const std::pair<const char*, double> cases[] = {
+        {"1e400", std::numeric_limits<double>::infinity()},
+        {"-1.5E+400", -std::numeric_limits<double>::infinity()},
+        {"0.0001e-400", 0.0},
+        {"-1e-400", -0.0},
+        {"0.5e-330", 0.0},
+        {"12345e-330", 0.0},
+        {"0.00001e315", std::numeric_limits<double>::infinity()},
+    };
+    for (const auto& [text, expected] : cases) {
+        double value = 1.0;
+        const char* last = text + strlen(text);
+        EXPECT_EQ(XMLUtils::ParseNumber(text, last, value), last) << text;
+        EXPECT_EQ(value, expected) << text;
+        EXPECT_EQ(std::signbit(value), std::signbit(expected)) << text;
+        EXPECT_EQ(value, std::strtod(text, nullptr)) << text;
+    }
+}
@@ -0,0 +1,25 @@
+#include <gtest/gtest.h>
+#include "LineaCore/Utils/JsonUtils.hpp"
+#include <limits>
+#include <string>
+
+using namespace LineaCore::Utils;
+
+TEST(JsonUtilsTest, String) {
+    EXPECT_EQ(JsonUtils::String(""), "\"\"");
+    EXPECT_EQ(JsonUtils::String("Voie 1"), "\"Voie 1\"");
+    EXPECT_EQ(JsonUtils::String("a\"b\\c"), "\"a\\\"b\\\\c\"");
+    EXPECT_EQ(JsonUtils::String(std::string("a\nb\tc\x01", 6)), "\"a\\u000ab\\u0009c\\u0001\"");
+    // Les caractères UTF-8 sont conservés
+    EXPECT_EQ(JsonUtils::String("Déclivité"), "\"Déclivité\"");
+}
+
+TEST(JsonUtilsTest, Number) {
+    EXPECT_EQ(JsonUtils::Number(0.0), "0");
+    EXPECT_EQ(JsonUtils::Number(-2.5), "-2.5");
+    EXPECT_EQ(JsonUtils::Number(477736.0975757), "477736.097576");
+    EXPECT_EQ(JsonUtils::Number(477736.0975757, 6), "477736");
+    EXPECT_EQ(JsonUtils::Number(1e-5), "1e-05");
+    EXPECT_EQ(JsonUtils::Number(std::numeric_limits<double>::quiet_NaN()), "null");
+    EXPECT_EQ(JsonUtils::Number(std::numeric_limits<double>::infinity()), "null");
+}
@@ -0,0 +1,111 @@
+// LineaCoreValidate.cpp
+// Contrôle de continuité (G0/G1/G2) et des valeurs déclarées de fichiers LandXML, avec rapport JSON.
+
+#include "LineaCore/Geometry/Alignments/ContinuityValidator.hpp"
+#include <algorithm>
+#include <cctype>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+using namespace LineaCore::Geometry::Alignments;
+
+struct Options {
+    std::vector<std::string> Files;
+    ContinuityTolerances Tolerances;
+    unsigned Threads = 0;
+    std::string Output;
+};
+
+bool IsLandXMLFile(const std::filesystem::path& path) {
+    std::string extension = path.extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return extension == ".xml";
+}
+
+// Les répertoires sont parcourus récursivement ; leurs fichiers .xml sont contrôlés dans l'ordre des noms
+void AddInput(const std::string& argument, std::vector<std::string>& files) {
+    if (!std::filesystem::is_directory(argument)) {
+        files.push_back(argument);
+        return;
+    }
+    std::vector<std::string> found;
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(argument)) {
+        if (entry.is_regular_file() && IsLandXMLFile(entry.path())) {
+            found.push_back(entry.path().string());
+        }
+    }
+    std::sort(found.begin(), found.end());
+    files.insert(files.end(), found.begin(), found.end());
+}
+
+bool ParseOptions(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string argument = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (argument == "--threads" && hasValue) {
+            options.Threads = static_cast<unsigned>(std::max(0, std::stoi(argv[++i])));
+        } else if (argument == "--position" && hasValue) {
+            options.Tolerances.Position = std::stod(argv[++i]);
+        } else if (argument == "--angle" && hasValue) {
+            options.Tolerances.Angle = std::stod(argv[++i]);
+        } else if (argument == "--curvature" && hasValue) {
+            options.Tolerances.Curvature = std::stod(argv[++i]);
+        } else if (argument == "--length" && hasValue) {
+            options.Tolerances.Length = std::stod(argv[++i]);
+        } else if (argument == "--out" && hasValue) {
+            options.Output = argv[++i];
+        } else if (!argument.empty() && argument[0] != '-') {
+            AddInput(argument, options.Files);
+        } else {
+            return false;
+        }
+    }
+    return !options.Files.empty();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    try {
+        if (!ParseOptions(argc, argv, options)) {
+            std::cerr << "Usage: " << argv[0] << " [--threads <n>] [--position <m>] [--angle <rad>] [--curvature <1/m>] [--length <m>]"
+                      << " [--out <file.json>] <file.xml|directory>...\n";
+            return 2;
+        }
+
+        const std::vector<FileContinuity> results = ContinuityValidator::ValidateFiles(options.Files, options.Tolerances, options.Threads);
+        if (options.Output.empty()) {
+            ContinuityValidator::WriteJson(std::cout, results, options.Tolerances);
+        } else {
+            std::ofstream stream(options.Output);
+            if (!stream) {
+                std::cerr << "Cannot write '" << options.Output << "'\n";
+                return 1;
+            }
+            ContinuityValidator::WriteJson(stream, results, options.Tolerances);
+        }
+
+        // Code de retour : 0 si tous les fichiers ont été lus sans écart hors tolérance
+        for (const FileContinuity& file : results) {
+            if (!file.Error.empty()) {
+                return 1;
+            }
+            for (const AlignmentContinuity& alignment : file.Alignments) {
+                if (!alignment.Issues.empty()) {
+                    return 1;
+                }
+            }
+        }
+    } catch (const std::exception& ex) {
+        std::cerr << "Error: " << ex.what() << "\n";
+        return 1;
+    }
+    return 0;
+}